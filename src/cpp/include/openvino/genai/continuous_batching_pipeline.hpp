@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 #include <optional>
+#include <vector>
 
 #include <openvino/runtime/tensor.hpp>
 
@@ -23,6 +26,31 @@
 
 namespace ov::genai {
 
+/**
+ * @brief Histogram of request latencies with fixed bucket boundaries in milliseconds.
+ * Bucket `i` counts values in (bucket_bounds_ms[i - 1], bucket_bounds_ms[i]], the last bucket counts values
+ * greater than bucket_bounds_ms.back().
+ */
+struct LatencyHistogram {
+    std::vector<float> bucket_bounds_ms = {10.0f, 25.0f, 50.0f, 100.0f, 250.0f, 500.0f, 1000.0f, 2500.0f, 5000.0f, 10000.0f};
+    std::vector<size_t> bucket_counts = std::vector<size_t>(bucket_bounds_ms.size() + 1, 0);
+    size_t num_samples = 0;
+    float sum_ms = 0.0f;
+    float max_ms = 0.0f;
+
+    void add(float value_ms) {
+        auto bucket_it = std::lower_bound(bucket_bounds_ms.begin(), bucket_bounds_ms.end(), value_ms);
+        bucket_counts[std::distance(bucket_bounds_ms.begin(), bucket_it)] += 1;
+        num_samples += 1;
+        sum_ms += value_ms;
+        max_ms = std::max(max_ms, value_ms);
+    }
+
+    float get_mean_ms() const {
+        return num_samples == 0 ? 0.0f : sum_ms / num_samples;
+    }
+};
+
 /**
  * @brief Contains general pipeline metrics, either aggregated throughout the lifetime of the generation pipeline
  * or measured at the previous generation step.
@@ -57,6 +85,41 @@ struct PipelineMetrics {
      * Duration of the last generation step in microseconds.
      */
     float inference_duration = 0.0;
+
+    /**
+     * Duration of the last generation step in microseconds, including scheduling, inference, sampling and other host work.
+     */
+    float step_duration = 0.0;
+
+    /**
+     * Duration of host work done at the last generation step while the inference was in flight, in microseconds.
+     * This time is hidden behind inference_duration unless it exceeds the inference itself.
+     */
+    float overlapped_host_duration = 0.0;
+
+    /**
+     * Duration of cache eviction bookkeeping (score registration and eviction decisions) at the last generation step
+     * in microseconds, 0 if SchedulerConfig::use_cache_eviction is off.
+     */
+    float cache_eviction_duration = 0.0;
+
+    /**
+     * Max number of prompt tokens allowed at the previous generation step by adaptive prefill chunking
+     * (see SchedulerConfig::target_inter_token_latency_ms), 0 if adaptive prefill chunking is disabled.
+     */
+    size_t prefill_token_budget = 0;
+
+    /**
+     * Time to first token histograms aggregated throughout the lifetime of the pipeline, per request priority class
+     * (see GenerationConfig::priority).
+     */
+    std::map<size_t, LatencyHistogram> ttft_per_priority;
+
+    /**
+     * End-to-end request latency (from add_request to the last generated token) histograms aggregated throughout
+     * the lifetime of the pipeline, per request priority class (see GenerationConfig::priority).
+     */
+    std::map<size_t, LatencyHistogram> e2e_latency_per_priority;
 };
 
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
@@ -68,11 +131,15 @@ protected:
     class ContinuousBatchingForPromptLookupImpl;
     class SpeculativeDecodingImpl;
     class PromptLookupImpl;
+    class ContinuousBatchingReplicaImpl;
+    class DataParallelImpl;
 
     friend class ContinuousBatchingForSpeculativeDecodingImpl;
     friend class ContinuousBatchingForPromptLookupImpl;
     friend class SpeculativeDecodingImpl;
     friend class PromptLookupImpl;
+    friend class ContinuousBatchingReplicaImpl;
+    friend class DataParallelImpl;
 
     std::shared_ptr<IContinuousBatchingPipeline> m_impl;
 
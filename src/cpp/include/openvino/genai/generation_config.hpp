@@ -275,10 +275,18 @@ operator|(const StructuredOutputConfig::CompoundGrammar& lhs,
  * @param assistant_confidence_threshold the lower token probability of candidate to be validated by main model in case of dynamic strategy candidates number update.
  * @param num_assistant_tokens the defined candidates number to be generated by draft model/prompt lookup in case of static strategy candidates number update.
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
+ * @param adaptive_num_assistant_tokens whether to adjust the number of candidates online from the observed acceptance rate and the relative
+ *        cost of draft and main model steps, with `num_assistant_tokens` as an upper bound (default: false).
  *
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
  * 
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
+ *
+ * Continuous batching scheduling parameters:
+ * @param priority scheduling priority of the request. Requests with higher priority are admitted to prefill first and are preempted last
+ *        when KV cache is exhausted. Requests with equal priority are processed in arrival order (default: 0).
+ * @param ttft_target_ms target time to first token in milliseconds. Among requests with equal priority, the ones with the smallest
+ *        remaining slack to this target are scheduled first. 0 means no target (default: 0).
  */
 class OPENVINO_GENAI_EXPORTS GenerationConfig {
 public:
@@ -325,6 +333,7 @@ public:
     float assistant_confidence_threshold = 0.f;
     size_t num_assistant_tokens = 0;
     size_t max_ngram_size = 0;
+    bool adaptive_num_assistant_tokens = false;
 
     // Structured output parameters
     std::optional<StructuredOutputConfig> structured_output_config;
@@ -334,6 +343,10 @@ public:
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
+    // Continuous batching scheduling parameters
+    size_t priority = 0;
+    size_t ttft_target_ms = 0;
+
 
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
@@ -397,6 +410,7 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
 static constexpr ov::Property<float> assistant_confidence_threshold{"assistant_confidence_threshold"};
 static constexpr ov::Property<size_t> num_assistant_tokens{"num_assistant_tokens"};
 static constexpr ov::Property<size_t> max_ngram_size{"max_ngram_size"};
+static constexpr ov::Property<bool> adaptive_num_assistant_tokens{"adaptive_num_assistant_tokens"};
 
 static constexpr ov::Property<StructuredOutputConfig> structured_output_config{"structured_output_config"};
 static constexpr ov::Property<std::string> regex{"regex"};
@@ -406,6 +420,9 @@ static constexpr ov::Property<std::string> backend{"backend"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
+static constexpr ov::Property<size_t> priority{"priority"};
+static constexpr ov::Property<size_t> ttft_target_ms{"ttft_target_ms"};
+
 // Predefined Configs
 
 OPENVINO_DEPRECATED("Please, use individual parameters instead of predefined configs. This method will be removed in 2026.0.0 release")
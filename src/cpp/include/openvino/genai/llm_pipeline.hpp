@@ -338,6 +338,14 @@ static constexpr ov::Property<SchedulerConfig> scheduler_config{"scheduler_confi
 */
 static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 
+/**
+* @brief data_parallel_replicas property sets the number of continuous batching pipeline replicas served behind a single pipeline object.
+* Each replica has its own infer request, KV cache of `SchedulerConfig::cache_size` / `num_kv_blocks` size and scheduler,
+* while the compiled model is shared. New requests are routed to replicas by KV cache usage and prompt prefix affinity.
+* Default is 1 (no data parallelism).
+*/
+static constexpr ov::Property<size_t> data_parallel_replicas{"data_parallel_replicas"};
+
 /**
 * @brief enable enable_save_ov_model property serves to serialize ov model (xml/bin) generated from gguf model on disk for re-use.
 * Set `true` to activate this mode.
@@ -345,6 +353,14 @@ static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 */
 static constexpr ov::Property<bool> enable_save_ov_model{"enable_save_ov_model"};
 
+/**
+* @brief gguf_cache_dir property sets a directory where OpenVINO models converted from GGUF files are cached.
+* Next pipelines created from the same GGUF file read the cached model instead of converting it again.
+* Cached models are keyed by the size, modification time and sampled content of the GGUF files.
+* Models compiled for pipelines created from GGUF files are cached in the same directory unless ov::cache_dir is set.
+*/
+static constexpr ov::Property<std::string> gguf_cache_dir{"gguf_cache_dir"};
+
 
 }  // namespace genai
 }  // namespace ov
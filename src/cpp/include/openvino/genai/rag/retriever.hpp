@@ -0,0 +1,119 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/rag/text_rerank_pipeline.hpp"
+#include "openvino/genai/rag/vector_index.hpp"
+
+namespace ov {
+namespace genai {
+
+struct RetrievedDocument {
+    size_t id;
+    std::string text;
+    /**
+     * @brief Rerank score if the retriever has a rerank pipeline, VectorIndex::search() score otherwise
+     */
+    float score;
+};
+
+struct RetrievalMetrics {
+    /**
+     * @brief Duration of query embedding in microseconds
+     */
+    float embedding_duration = 0.0;
+
+    /**
+     * @brief Duration of vector index search in microseconds
+     */
+    float search_duration = 0.0;
+
+    /**
+     * @brief Duration of reranking of found documents in microseconds, 0 without rerank pipeline
+     */
+    float rerank_duration = 0.0;
+};
+
+struct RetrievalResults {
+    /**
+     * @brief Retrieved documents, most relevant first
+     */
+    std::vector<RetrievedDocument> documents;
+    RetrievalMetrics metrics;
+};
+
+/**
+ * @brief Finds documents relevant to a query: embeds the query, searches the vector index and optionally reranks
+ * found documents. Pipelines and index are not owned and must outlive the retriever.
+ * retrieve() can be called from several threads at once.
+ */
+class OPENVINO_GENAI_EXPORTS Retriever {
+public:
+    struct OPENVINO_GENAI_EXPORTS Config {
+        /**
+         * @brief Number of documents found in the vector index. All of them are reranked if the retriever
+         * has a rerank pipeline, which returns TextRerankPipeline::Config::top_n of them.
+         */
+        size_t top_k = 10;
+    };
+
+    /**
+     * @brief Constructs a retriever without reranking
+     *
+     * @param embedding_pipeline Pipeline to embed documents and queries, its embeddings must match the index config
+     * @param index Vector index of documents
+     * @param config Retriever configuration
+     * @param documents Texts of documents already in the index, id of a document is its position
+     */
+    Retriever(TextEmbeddingPipeline& embedding_pipeline,
+              VectorIndex& index,
+              const Config& config,
+              const std::vector<std::string>& documents = {});
+
+    /**
+     * @brief Constructs a retriever which reranks documents found in the index
+     *
+     * @param embedding_pipeline Pipeline to embed documents and queries, its embeddings must match the index config
+     * @param index Vector index of documents
+     * @param rerank_pipeline Pipeline to rerank found documents
+     * @param config Retriever configuration
+     * @param documents Texts of documents already in the index, id of a document is its position
+     */
+    Retriever(TextEmbeddingPipeline& embedding_pipeline,
+              VectorIndex& index,
+              TextRerankPipeline& rerank_pipeline,
+              const Config& config,
+              const std::vector<std::string>& documents = {});
+
+    /**
+     * @brief Embeds documents and adds them to the index
+     *
+     * @return Ids of added documents
+     */
+    std::vector<size_t> add_documents(const std::vector<std::string>& texts);
+
+    /**
+     * @brief Removes documents from the index
+     */
+    void remove_documents(const std::vector<size_t>& ids);
+
+    /**
+     * @brief Finds documents relevant to the query
+     */
+    RetrievalResults retrieve(const std::string& query);
+
+    ~Retriever();
+
+private:
+    class RetrieverImpl;
+    std::unique_ptr<RetrieverImpl> m_impl;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <optional>
 #include <variant>
 
@@ -16,6 +17,33 @@ using EmbeddingResult = std::variant<std::vector<float>, std::vector<int8_t>, st
 using EmbeddingResults =
     std::variant<std::vector<std::vector<float>>, std::vector<std::vector<int8_t>>, std::vector<std::vector<uint8_t>>>;
 
+struct EmbeddingCacheMetrics {
+    /**
+     * @brief Number of texts whose embeddings were found in the cache
+     */
+    size_t num_hits = 0;
+
+    /**
+     * @brief Number of texts which were embedded by the model
+     */
+    size_t num_misses = 0;
+
+    /**
+     * @brief Number of cached embeddings
+     */
+    size_t num_entries = 0;
+
+    /**
+     * @brief Size of cached embeddings in bytes, including embeddings mapped from the cache file
+     */
+    size_t size_bytes = 0;
+
+    float get_hit_ratio() const {
+        const size_t num_lookups = num_hits + num_misses;
+        return num_lookups > 0 ? static_cast<float>(num_hits) / num_lookups : 0.0f;
+    }
+};
+
 class OPENVINO_GENAI_EXPORTS TextEmbeddingPipeline {
 public:
     enum class PoolingType {
@@ -29,6 +57,22 @@ public:
         MEAN = 1,
     };
 
+    enum class QuantizationType {
+        /**
+         * @brief Embeddings are returned as float values
+         */
+        NONE = 0,
+        /**
+         * @brief Normalized embeddings are scaled by 127 and rounded to int8 values
+         */
+        INT8 = 1,
+        /**
+         * @brief Signs of embedding values are packed into uint8 values, 8 values per byte, first value in the most
+         * significant bit. Bit is set for positive values.
+         */
+        BINARY = 2,
+    };
+
     struct OPENVINO_GENAI_EXPORTS Config {
         /**
          * @brief Maximum length of tokens passed to the embedding model
@@ -48,6 +92,14 @@ public:
          */
         std::optional<size_t> batch_size;
 
+        /**
+         * @brief Maximum number of tokens, including padding, in one inference of embed_documents.
+         * If set and batch_size is not set, documents are sorted by token length and split into micro-batches
+         * of documents of similar length within this budget, which are inferred concurrently. Embeddings are
+         * returned in the original order of documents.
+         */
+        std::optional<size_t> max_batch_tokens;
+
         /**
          * @brief Pooling strategy applied to model output tensor
          */
@@ -58,6 +110,13 @@ public:
          */
         bool normalize = true;
 
+        /**
+         * @brief Quantization applied to embeddings after pooling and normalization inside the model.
+         * INT8 quantization requires normalize to be 'true'. BINARY quantization requires embedding size to be a
+         * multiple of 8.
+         */
+        QuantizationType quantization_type = QuantizationType::NONE;
+
         /**
          * @brief Instruction to use for embedding a query
          */
@@ -68,6 +127,20 @@ public:
          */
         std::optional<std::string> embed_instruction;
 
+        /**
+         * @brief Budget in bytes of the cache of embeddings. If set, embeddings are cached by a hash of the text with
+         * instruction and of the model with its configuration, texts found in the cache are not embedded again.
+         * The least recently used embeddings are evicted above the budget. Can't be used with batch_size.
+         */
+        std::optional<size_t> max_cache_bytes;
+
+        /**
+         * @brief Path to the file of the embedding cache. If the file exists, the cache is filled from it at
+         * construction of the pipeline, embeddings are memory mapped from the file. save_cache() writes the file.
+         * Requires max_cache_bytes.
+         */
+        std::optional<std::string> cache_path;
+
         /**
          * @brief Constructs text embedding pipeline configuration
          */
@@ -131,10 +204,25 @@ public:
         : TextEmbeddingPipeline(models_path, device, ov::AnyMap{std::forward<Properties>(properties)...}) {}
 
     /**
-     * @brief Computes embeddings for a vector of texts
+     * @brief Computes embeddings for a vector of texts. Can be called from several threads at once, concurrent calls
+     * are inferred on separate infer requests, up to ov::optimal_number_of_infer_requests of the compiled model.
      */
     EmbeddingResults embed_documents(const std::vector<std::string>& texts);
 
+    /**
+     * @brief Asynchronously computes embeddings for a vector of texts. Any number of calls can be active, the pipeline
+     * must outlive the returned future.
+     */
+    std::future<EmbeddingResults> embed_documents_async(const std::vector<std::string>& texts);
+
+    /**
+     * @brief Computes embeddings for a vector of texts and returns them as a contiguous tensor of shape
+     * [number of texts, embedding size]. Element type is f32, i8 or u8 according to Config::quantization_type.
+     * If texts are not split into micro-batches, the tensor is the model output itself and is not copied.
+     * Can be called from several threads at once.
+     */
+    ov::Tensor embed_documents_tensor(const std::vector<std::string>& texts);
+
     /**
      * @brief Asynchronously computes embeddings for a vector of texts. Only one method of async family can be active.
      */
@@ -146,10 +234,16 @@ public:
     EmbeddingResults wait_embed_documents();
 
     /**
-     * @brief Computes embedding for a query
+     * @brief Computes embedding for a query. Can be called from several threads at once.
      */
     EmbeddingResult embed_query(const std::string& text);
 
+    /**
+     * @brief Asynchronously computes embedding for a query. Any number of calls can be active, the pipeline must
+     * outlive the returned future.
+     */
+    std::future<EmbeddingResult> embed_query_async(const std::string& text);
+
     /**
      * @brief Asynchronously computes embeddings for a query. Only one method of async family can be active.
      */
@@ -160,6 +254,17 @@ public:
      */
     EmbeddingResult wait_embed_query();
 
+    /**
+     * @brief Writes the embedding cache to Config::cache_path
+     */
+    void save_cache() const;
+
+    /**
+     * @brief Returns hits and misses of the embedding cache since construction of the pipeline and its size.
+     * Metrics are empty if the cache is disabled.
+     */
+    EmbeddingCacheMetrics get_cache_metrics() const;
+
     ~TextEmbeddingPipeline();
 
 private:
@@ -177,6 +282,11 @@ static constexpr ov::Property<bool> normalize{"normalize"};
  */
 static constexpr ov::Property<TextEmbeddingPipeline::PoolingType> pooling_type{"pooling_type"};
 
+/**
+ * @brief Quantization applied to embeddings inside the model
+ */
+static constexpr ov::Property<TextEmbeddingPipeline::QuantizationType> quantization_type{"quantization_type"};
+
 /**
  * @brief Instruction to use for embedding query
  */
@@ -194,5 +304,21 @@ static constexpr ov::Property<std::string> embed_instruction{"embed_instruction"
  */
 static constexpr ov::Property<size_t> batch_size{"batch_size"};
 
+/**
+ * @brief Maximum number of tokens, including padding, in one inference of embed_documents.
+ * Documents are split into micro-batches of documents of similar length within this budget.
+ */
+static constexpr ov::Property<size_t> max_batch_tokens{"max_batch_tokens"};
+
+/**
+ * @brief Budget in bytes of the cache of embeddings
+ */
+static constexpr ov::Property<size_t> max_cache_bytes{"max_cache_bytes"};
+
+/**
+ * @brief Path to the file of the embedding cache
+ */
+static constexpr ov::Property<std::string> cache_path{"cache_path"};
+
 }  // namespace genai
 }  // namespace ov
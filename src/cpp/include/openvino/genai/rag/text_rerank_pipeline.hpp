@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <future>
+
 #include "openvino/genai/tokenizer.hpp"
 
 namespace ov {
@@ -17,10 +19,32 @@ public:
         size_t top_n = 3;
 
         /**
-         * @brief Maximum length of tokens passed to the rerank model
+         * @brief Maximum length of tokens passed to the rerank model. For decoder rerankers it limits tokens of
+         * a document, the shared prompt prefix with the query is not truncated.
          */
         std::optional<size_t> max_length;
 
+        /**
+         * @brief Maximum number of tokens, including padding, in one inference of rerank.
+         * If set, texts are sorted by token length and split into micro-batches of texts of similar length within
+         * this budget, which are inferred concurrently. For decoder rerankers the budget doesn't include the shared
+         * prompt prefix.
+         */
+        std::optional<size_t> max_batch_tokens;
+
+        /**
+         * @brief If set, reranking stops once top_n texts have score not less than this value, remaining texts are
+         * not scored. Texts are split into micro-batches in the given order, e.g. retrieval order, instead of sorting
+         * by length. Requires max_batch_tokens.
+         */
+        std::optional<float> early_stop_score;
+
+        /**
+         * @brief Instruction in the prompt of decoder rerankers, e.g. Qwen3-Reranker.
+         * Default instruction is used if not set. Ignored by cross-encoder rerankers.
+         */
+        std::optional<std::string> instruction;
+
         /**
          * @brief Constructs text rerank pipeline configuration
          */
@@ -37,10 +61,19 @@ public:
          * ov::genai::TextRerankPipeline::Config config({{"top_n", 3}});
          */
         explicit Config(const ov::AnyMap& properties);
+
+        /**
+         * @brief checks that are no conflicting parameters
+         * @throws Exception if config is invalid.
+         */
+        void validate() const;
     };
 
     /**
      * @brief Constructs a pipeline from xml/bin files, tokenizer and configuration in the same dir.
+     * Cross-encoder models score query and text pairs. Decoder models (architecture *ForCausalLM in config.json,
+     * exported with KV cache as stateful model) score probability of "yes" answer in Qwen3-Reranker prompt format.
+     * The prompt prefix with the query is inferred once per rerank call and its KV cache is reused for all texts.
      *
      * @param models_path Path to the directory containing model xml/bin files and tokenizer
      * @param device Device
@@ -76,10 +109,18 @@ public:
         : TextRerankPipeline(models_path, device, ov::AnyMap{std::forward<Properties>(properties)...}) {}
 
     /**
-     * @brief Reranks a vector of texts based on the query.
+     * @brief Reranks a vector of texts based on the query. Can be called from several threads at once, concurrent
+     * calls are inferred on separate infer requests, up to ov::optimal_number_of_infer_requests of the compiled model.
      */
     std::vector<std::pair<size_t, float>> rerank(const std::string& query, const std::vector<std::string>& texts);
 
+    /**
+     * @brief Asynchronously reranks a vector of texts based on the query. Any number of calls can be active, the
+     * pipeline must outlive the returned future.
+     */
+    std::future<std::vector<std::pair<size_t, float>>> rerank_async(const std::string& query,
+                                                                    const std::vector<std::string>& texts);
+
     /**
      * @brief Asynchronously reranks a vector of texts based on the query. Only one method of async family can be
      * active.
@@ -103,5 +144,15 @@ private:
  */
 static constexpr ov::Property<size_t> top_n{"top_n"};
 
+/**
+ * @brief Score which stops reranking once top_n texts reach it
+ */
+static constexpr ov::Property<float> early_stop_score{"early_stop_score"};
+
+/**
+ * @brief Instruction in the prompt of decoder rerankers
+ */
+static constexpr ov::Property<std::string> instruction{"instruction"};
+
 }  // namespace genai
 }  // namespace ov
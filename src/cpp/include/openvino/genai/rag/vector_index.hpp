@@ -0,0 +1,149 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/genai/visibility.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief In-process approximate nearest neighbour index of embeddings based on HNSW graph
+ * (Hierarchical Navigable Small World, https://arxiv.org/abs/1603.09320).
+ * Search can be called from several threads at once, add and remove wait for running searches.
+ */
+class OPENVINO_GENAI_EXPORTS VectorIndex {
+public:
+    enum class Metric {
+        /**
+         * @brief Dot product of vectors, equals to cosine similarity for normalized embeddings
+         */
+        INNER_PRODUCT = 0,
+        /**
+         * @brief Squared euclidean distance
+         */
+        L2 = 1,
+        /**
+         * @brief Number of different bits, for embeddings with TextEmbeddingPipeline::QuantizationType::BINARY
+         */
+        HAMMING = 2,
+    };
+
+    struct OPENVINO_GENAI_EXPORTS Config {
+        /**
+         * @brief Element type of vectors: f32, i8 for TextEmbeddingPipeline::QuantizationType::INT8 or
+         * u8 for TextEmbeddingPipeline::QuantizationType::BINARY embeddings
+         */
+        ov::element::Type element_type = ov::element::f32;
+
+        /**
+         * @brief Distance between vectors. HAMMING is used with u8 element type only, other metrics with f32 and i8.
+         */
+        Metric metric = Metric::INNER_PRODUCT;
+
+        /**
+         * @brief Number of neighbours of a vector in upper graph layers, twice as many in the bottom layer.
+         * Larger values improve recall at the cost of memory and add time.
+         */
+        size_t max_neighbours = 16;
+
+        /**
+         * @brief Number of candidates considered while linking an added vector
+         */
+        size_t ef_construction = 200;
+
+        /**
+         * @brief Number of candidates considered by search, at least k of search is used.
+         * Larger values improve recall at the cost of search time.
+         */
+        size_t ef_search = 64;
+
+        /**
+         * @brief checks that are no conflicting parameters
+         * @throws Exception if config is invalid.
+         */
+        void validate() const;
+    };
+
+    /**
+     * @brief Constructs an empty index
+     *
+     * @param dimension Number of elements in a vector, number of bytes for u8 element type
+     * @param config Index configuration
+     */
+    VectorIndex(size_t dimension, const Config& config);
+
+    /**
+     * @brief Constructs an empty index of f32 vectors with default configuration
+     *
+     * @param dimension Number of elements in a vector
+     */
+    explicit VectorIndex(size_t dimension);
+
+    /**
+     * @brief Loads an index written by save(). Vectors are memory mapped from the file, not read to memory.
+     * The file must not be modified while the index exists.
+     *
+     * @param path Path to the index file
+     */
+    explicit VectorIndex(const std::filesystem::path& path);
+
+    /**
+     * @brief Adds vectors to the index
+     *
+     * @param ids Identifiers of vectors, which are returned by search. Identifiers of vectors in the index can't be reused.
+     * @param vectors Tensor of [ids.size(), dimension] shape, e.g. TextEmbeddingPipeline::embed_documents_tensor() output
+     */
+    void add(const std::vector<size_t>& ids, const ov::Tensor& vectors);
+
+    /**
+     * @brief Removes vectors from search results. Removed vectors are kept in the graph to preserve its connectivity.
+     */
+    void remove(const std::vector<size_t>& ids);
+
+    /**
+     * @brief Finds vectors nearest to the query
+     *
+     * @param query Tensor of [dimension] or [1, dimension] shape
+     * @param k Number of vectors to return
+     * @return Pairs of identifiers and scores of found vectors, most similar first. Score is dot product for
+     * INNER_PRODUCT metric and negated distance for L2 and HAMMING metrics, so higher score is always more similar.
+     */
+    std::vector<std::pair<size_t, float>> search(const ov::Tensor& query, size_t k) const;
+
+    /**
+     * @brief Finds vectors nearest to the query embedding, e.g. TextEmbeddingPipeline::embed_query() output
+     */
+    std::vector<std::pair<size_t, float>> search(const EmbeddingResult& query, size_t k) const;
+
+    /**
+     * @brief Writes the index to a file. If the index is loaded from the same file, its vectors are read to memory
+     * and the file is no longer mapped.
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Number of vectors in the index, except removed ones
+     */
+    size_t size() const;
+
+    size_t get_dimension() const;
+
+    const Config& get_config() const;
+
+    ~VectorIndex();
+
+private:
+    class VectorIndexImpl;
+    std::unique_ptr<VectorIndexImpl> m_impl;
+};
+
+}  // namespace genai
+}  // namespace ov
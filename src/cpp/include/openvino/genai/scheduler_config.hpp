@@ -29,6 +29,17 @@ struct SchedulerConfig {
     // If dynamic_split_fuse is turned off any prompt that is longer than batch size will lead to error.
     bool dynamic_split_fuse = true;
 
+    // Adaptive prefill chunking, applicable only when dynamic_split_fuse is turned on.
+    // When set to a non-zero value, the number of prompt tokens scheduled per step is tuned online from the measured
+    // inference durations to keep step latency (i.e. inter-token latency of generating requests) close to this value in milliseconds.
+    // The total number of tokens per step is still limited by max_num_batched_tokens.
+    float target_inter_token_latency_ms = 0.0f;
+
+    // Bounds of the number of prompt tokens scheduled per step by adaptive prefill chunking.
+    // max_prefill_chunk_size equal to zero means max_num_batched_tokens.
+    std::size_t min_prefill_chunk_size = 16;
+    std::size_t max_prefill_chunk_size = 0;
+
 
     /**
      * Whether to use cache eviction for all sequences processed by this pipeline. When cache eviction is enabled,
@@ -60,6 +71,21 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
+    // Enable sharing of prompt KV-blocks between requests with identical or overlapping prompts.
+    // When turned on, a request whose prompt shares at least one full KV-block with a prompt of another running request
+    // waits until the prefix is computed by that request and then reuses its KV-blocks instead of recomputing them.
+    // Works independently of enable_prefix_caching, but is not applied when cache eviction or LoRA adapters are used.
+    bool enable_prompt_deduplication = false;
+
+    // Size of host memory tier in GB, where contents of prefix cache KV-blocks are saved quantized when the blocks are
+    // overwritten by other sequences, and restored from when a new prompt continues a prefix restored from prefix caching.
+    // Extends the number of cached prompt blocks (e.g. of long documents queried several times) beyond KV-cache capacity.
+    // Requires enable_prefix_caching, supported for CPU device only. Zero turns the tier off.
+    std::size_t cold_cache_size = 0;
+
+    // Number of bits per KV-cache element in cold tier (8 or 4), blocks in quantized KV-cache precisions are kept as is.
+    std::size_t cold_cache_bits = 8;
+
     /** Whether to apply block-wise sparse attention to the prefill stage.
      */
     bool use_sparse_attention = false;
@@ -71,7 +97,11 @@ struct SchedulerConfig {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               enable_prompt_deduplication == other.enable_prompt_deduplication &&
+               cold_cache_size == other.cold_cache_size && cold_cache_bits == other.cold_cache_bits &&
+               target_inter_token_latency_ms == other.target_inter_token_latency_ms &&
+               min_prefill_chunk_size == other.min_prefill_chunk_size && max_prefill_chunk_size == other.max_prefill_chunk_size;
     }
 };
 }
@@ -0,0 +1,125 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Tunes the number of prompt tokens scheduled per step in dynamic split-fuse mode, so that the step latency (which is
+ * the inter-token latency observed by requests in the generation phase) stays close to a target value.
+ *
+ * Step latency is modelled as `fixed_cost + per_token_cost * num_scheduled_tokens`, the model parameters are fitted online
+ * by exponentially weighted least squares over the observed (number of scheduled tokens, inference duration) pairs.
+ */
+class AdaptivePrefillController {
+public:
+    AdaptivePrefillController() = default;
+
+    /**
+     * Constructs the AdaptivePrefillController.
+     * @param target_step_latency_ms Step latency to hold in milliseconds.
+     * @param min_prefill_chunk_size Minimal number of prompt tokens scheduled per step, guarantees progress of the prompt phase.
+     * @param max_prefill_chunk_size Maximal number of prompt tokens scheduled per step.
+     * @param forgetting_factor Weight decay applied to previous observations on each new observation, in (0, 1].
+     */
+    AdaptivePrefillController(float target_step_latency_ms,
+                              size_t min_prefill_chunk_size,
+                              size_t max_prefill_chunk_size,
+                              float forgetting_factor = 0.95f)
+        : m_target_step_latency_ms(target_step_latency_ms),
+          m_min_prefill_chunk_size(min_prefill_chunk_size),
+          m_max_prefill_chunk_size(max_prefill_chunk_size),
+          m_forgetting_factor(forgetting_factor) {
+        OPENVINO_ASSERT(target_step_latency_ms > 0.0f, "Target step latency must be positive, got ", target_step_latency_ms);
+        OPENVINO_ASSERT(min_prefill_chunk_size > 0 && min_prefill_chunk_size <= max_prefill_chunk_size,
+                        "Prefill chunk size bounds must satisfy 0 < min (", min_prefill_chunk_size, ") <= max (", max_prefill_chunk_size, ")");
+        OPENVINO_ASSERT(forgetting_factor > 0.0f && forgetting_factor <= 1.0f, "Forgetting factor must be in (0, 1], got ", forgetting_factor);
+    }
+
+    /**
+     * Registers a step observation.
+     * @param num_scheduled_tokens Total number of tokens (prompt and generation ones) inferred during the step.
+     * @param step_latency_ms Duration of the model inference of the step in milliseconds.
+     */
+    void register_step(size_t num_scheduled_tokens, float step_latency_ms) {
+        if (num_scheduled_tokens == 0) {
+            return;
+        }
+        const double x = static_cast<double>(num_scheduled_tokens), y = step_latency_ms;
+        m_sum_w = m_sum_w * m_forgetting_factor + 1.0;
+        m_sum_x = m_sum_x * m_forgetting_factor + x;
+        m_sum_y = m_sum_y * m_forgetting_factor + y;
+        m_sum_xx = m_sum_xx * m_forgetting_factor + x * x;
+        m_sum_xy = m_sum_xy * m_forgetting_factor + x * y;
+        _update_model();
+    }
+
+    /**
+     * @param num_generation_tokens Number of generation phase tokens already scheduled for the current step.
+     * @return Number of prompt tokens which can be added to the current step without exceeding the target latency,
+     * clamped to [min_prefill_chunk_size, max_prefill_chunk_size]. Returns max_prefill_chunk_size until the first step is registered.
+     */
+    size_t get_prefill_token_budget(size_t num_generation_tokens) {
+        size_t budget = m_max_prefill_chunk_size;
+        if (m_per_token_cost_ms > 0.0f) {
+            double max_step_tokens = (m_target_step_latency_ms - m_fixed_cost_ms) / m_per_token_cost_ms;
+            double prefill_tokens = std::floor(max_step_tokens - static_cast<double>(num_generation_tokens));
+            budget = prefill_tokens <= static_cast<double>(m_min_prefill_chunk_size) ? m_min_prefill_chunk_size :
+                     prefill_tokens >= static_cast<double>(m_max_prefill_chunk_size) ? m_max_prefill_chunk_size :
+                     static_cast<size_t>(prefill_tokens);
+        }
+        m_last_prefill_token_budget = budget;
+        return budget;
+    }
+
+    size_t get_last_prefill_token_budget() const {
+        return m_last_prefill_token_budget;
+    }
+
+    float get_fixed_cost_ms() const {
+        return m_fixed_cost_ms;
+    }
+
+    float get_per_token_cost_ms() const {
+        return m_per_token_cost_ms;
+    }
+
+private:
+    void _update_model() {
+        const double denominator = m_sum_w * m_sum_xx - m_sum_x * m_sum_x;
+        // require some spread of observed token counts before fitting the fixed cost, otherwise
+        // attribute the whole latency to scheduled tokens
+        if (std::abs(denominator) > 1e-6 * m_sum_w * m_sum_xx) {
+            double slope = (m_sum_w * m_sum_xy - m_sum_x * m_sum_y) / denominator;
+            double intercept = (m_sum_y - slope * m_sum_x) / m_sum_w;
+            if (slope > 0.0 && intercept >= 0.0) {
+                m_per_token_cost_ms = static_cast<float>(slope);
+                m_fixed_cost_ms = static_cast<float>(intercept);
+                return;
+            }
+        }
+        m_per_token_cost_ms = static_cast<float>(m_sum_y / m_sum_x);
+        m_fixed_cost_ms = 0.0f;
+    }
+
+    float m_target_step_latency_ms = 0.0f;
+    size_t m_min_prefill_chunk_size = 1;
+    size_t m_max_prefill_chunk_size = 1;
+    float m_forgetting_factor = 0.95f;
+
+    // exponentially weighted sums for least squares fit
+    double m_sum_w = 0.0, m_sum_x = 0.0, m_sum_y = 0.0, m_sum_xx = 0.0, m_sum_xy = 0.0;
+
+    float m_fixed_cost_ms = 0.0f;
+    float m_per_token_cost_ms = 0.0f;
+    size_t m_last_prefill_token_budget = 0;
+};
+
+}  // namespace ov::genai
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <fstream>
 #include <chrono>
+#include <utility>
 
 #include "sequence_group.hpp"
 
@@ -195,6 +196,9 @@ class BlockAllocator {
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
+    // previous hashes and indices of cached blocks reused for overwriting, collected if tracking is enabled
+    bool m_track_overwritten_blocks = false;
+    std::vector<std::pair<uint64_t, size_t>> m_overwritten_blocks;
 
 public:
     /**
@@ -436,6 +440,9 @@ public:
             // get least recently used block from store and reuse it
             BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
             cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
+            if (m_track_overwritten_blocks) {
+                m_overwritten_blocks.emplace_back(blocks_for_all_layers[0]->get_hash(), blocks_for_all_layers[0]->get_index());
+            }
 
             // update block with new hash
             for (auto& block : blocks_for_all_layers) {
@@ -448,6 +455,22 @@ public:
         return {};
     }
 
+    /**
+     * Enables collection of cached blocks which are reused for overwriting by allocate_block(hash, cached_blocks),
+     * so their contents can be saved before being overwritten.
+     */
+    void enable_overwritten_blocks_tracking() {
+        m_track_overwritten_blocks = true;
+    }
+
+    /**
+     * @return Pairs of previous hash and block index (same for all layers) of cached blocks reused for overwriting
+     * since the last call. Contents of the blocks are not overwritten until the next inference.
+     */
+    std::vector<std::pair<uint64_t, size_t>> pull_overwritten_blocks() {
+        return std::exchange(m_overwritten_blocks, {});
+    }
+
     /**
      * Returns the blocks corresponding to a given hash either from the internal allocator store,
      * or from the supplied storage map, or nothing if there are no blocks corresponding to this hash.
@@ -756,6 +779,21 @@ public:
         m_allocator.increase_kv_blocks_number(num_blocks);
     }
 
+    /**
+     * Enables collection of prefix cache blocks reused for overwriting, see BlockAllocator::enable_overwritten_blocks_tracking.
+     */
+    void enable_overwritten_blocks_tracking() {
+        m_allocator.enable_overwritten_blocks_tracking();
+    }
+
+    /**
+     * @return Pairs of previous hash and block index of prefix cache blocks reused for overwriting since the last call.
+     */
+    std::vector<std::pair<uint64_t, size_t>> pull_overwritten_blocks() {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        return m_allocator.pull_overwritten_blocks();
+    }
+
     /**
      * @return The total number of KV blocks .
      */
@@ -783,6 +821,31 @@ public:
         }
     }
 
+    /**
+     * @brief Forks leading blocks of a sequence to a sequence which has no blocks allocated yet,
+     * e.g. to share KV cache of a common prompt prefix between sequences of different sequence groups.
+     * @param parent_id Parent sequence identifier
+     * @param child_id Identifier of the sequence to receive the blocks.
+     * @param num_blocks Number of leading blocks of the parent sequence to be shared with the child sequence.
+     */
+    void fork_sequence(uint64_t parent_id, uint64_t child_id, size_t num_blocks) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        OPENVINO_ASSERT(m_block_table.count(parent_id) == 1, "sequence with id ", parent_id, " not found in BlockManager, but requested to fork");
+        auto& child_block_table = m_block_table[child_id];
+        OPENVINO_ASSERT(std::all_of(child_block_table.begin(), child_block_table.end(), [](const std::vector<KVCacheBlock::Ptr>& layer_blocks) { return layer_blocks.empty(); }),
+                        "sequence with id ", child_id, " already has allocated blocks");
+        child_block_table.resize(m_num_layers);
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            const auto& parent_layer_blocks = m_block_table[parent_id][layer_idx];
+            OPENVINO_ASSERT(num_blocks <= parent_layer_blocks.size());
+            child_block_table[layer_idx].reserve(num_blocks);
+            for (size_t block_idx = 0; block_idx < num_blocks; block_idx++) {
+                parent_layer_blocks[block_idx]->increment();
+                child_block_table[layer_idx].push_back(parent_layer_blocks[block_idx]);
+            }
+        }
+    }
+
     /**
      * @brief Frees all blocks for a given sequence.
      * @param seq_id Identifier of the sequence to free.
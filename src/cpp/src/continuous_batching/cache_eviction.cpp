@@ -3,33 +3,28 @@
 
 #include "continuous_batching/cache_eviction.hpp"
 
+#include <numeric>
+
+#include "openvino/core/parallel.hpp"
+
 namespace ov::genai {
 
     void EvictionScoreManager::remove_scores(const std::vector<size_t>& evicted_block_indices, size_t decoder_layer_idx) {
         if (evicted_block_indices.empty()) {
             return;
         }
-        const auto &accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
-        const auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
+        auto &accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
+        auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
+        const bool has_counters = m_aggregation_mode == AggregationMode::NORM_SUM;
 
-        if (m_aggregation_mode == AggregationMode::NORM_SUM) {
+        if (has_counters) {
             OPENVINO_ASSERT(
                     accumulated_scores_for_current_decoder_layer.size() == counter_for_current_decoder_layer.size());
         }
 
+        // compact the kept scores in place
         auto old_size = accumulated_scores_for_current_decoder_layer.size();
-        auto new_size =
-                accumulated_scores_for_current_decoder_layer.size() - evicted_block_indices.size() * m_block_size;
-
-        std::vector<double> new_scores;
-        new_scores.reserve(new_size);
-
-        std::vector<size_t> new_counter;
-
-        if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-            new_counter.reserve(new_size);
-        }
-
+        size_t new_size = 0;
         for (size_t token_idx = 0, evicted_block_idx = 0; token_idx < old_size;) {
             if (evicted_block_idx < evicted_block_indices.size() &&
                 token_idx == evicted_block_indices[evicted_block_idx] * m_block_size) {
@@ -37,15 +32,20 @@ namespace ov::genai {
                 token_idx += m_block_size;
                 continue;
             }
-            new_scores.push_back(accumulated_scores_for_current_decoder_layer[token_idx]);
-            if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-                new_counter.push_back(counter_for_current_decoder_layer[token_idx]);
+            accumulated_scores_for_current_decoder_layer[new_size] = accumulated_scores_for_current_decoder_layer[token_idx];
+            if (has_counters) {
+                counter_for_current_decoder_layer[new_size] = counter_for_current_decoder_layer[token_idx];
             }
+            ++new_size;
             ++token_idx;
         }
 
-        m_scores[decoder_layer_idx] = new_scores;
-        m_cache_counter[decoder_layer_idx] = new_counter;
+        accumulated_scores_for_current_decoder_layer.resize(new_size);
+        if (has_counters) {
+            counter_for_current_decoder_layer.resize(new_size);
+        } else {
+            counter_for_current_decoder_layer.clear();
+        }
     }
 
     void EvictionScoreManager::register_new_token_scores(
@@ -59,134 +59,140 @@ namespace ov::genai {
 
         // FIXME (vshampor): currently in terms of counters we do not discern between the cases when the last chunk has been prefill-only
         // or last-prefill-chunk-plus-one-generation_token
-        for (size_t decoder_layer_idx = 0; decoder_layer_idx < m_num_decoder_layers; decoder_layer_idx++) {
-
-            const auto &attention_scores = attention_scores_for_all_decoder_layers[decoder_layer_idx];
-            // "Start" tokens are never evicted, won't track scores for these
-            // "Recent" tokens are also not evicted just yet, but need to accumulate their scores since they may
-            // ultimately move into the "intermediate" eviction region of cache
-            // Taking the [1, start_size:seq_len] span of the attention scores:
-            auto attn_shape = attention_scores.get_shape();
-            size_t scores_size_in_tokens = attn_shape[0];
-            if (scores_size_in_tokens <= m_ignore_first_n_blocks * m_block_size) {
-                return;
-            }
+        // each layer only touches its own scores, counters and buffers
+        ov::parallel_for(m_num_decoder_layers, [&](size_t decoder_layer_idx) {
+            _register_new_token_scores_for_layer(attention_scores_for_all_decoder_layers[decoder_layer_idx], skipped_logical_block_ids, num_snapkv_scores, decoder_layer_idx);
+        });
+    }
 
-            std::set<size_t> skip_set_adjusted;
-            size_t num_skipped_blocks_in_ignore_area = 0;
-            for (size_t i = 0; i < m_ignore_first_n_blocks; i++) {
-                if (skipped_logical_block_ids.find(i) != skipped_logical_block_ids.end()) {
-                    num_skipped_blocks_in_ignore_area++;
-                }
+    void EvictionScoreManager::_register_new_token_scores_for_layer(
+            const AttentionScoresForCacheOfSubsequence& attention_scores,
+            const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores, size_t decoder_layer_idx) {
+        // "Start" tokens are never evicted, won't track scores for these
+        // "Recent" tokens are also not evicted just yet, but need to accumulate their scores since they may
+        // ultimately move into the "intermediate" eviction region of cache
+        // Taking the [1, start_size:seq_len] span of the attention scores:
+        auto attn_shape = attention_scores.get_shape();
+        size_t scores_size_in_tokens = attn_shape[0];
+        if (scores_size_in_tokens <= m_ignore_first_n_blocks * m_block_size) {
+            return;
+        }
+
+        std::set<size_t> skip_set_adjusted;
+        size_t num_skipped_blocks_in_ignore_area = 0;
+        for (size_t i = 0; i < m_ignore_first_n_blocks; i++) {
+            if (skipped_logical_block_ids.find(i) != skipped_logical_block_ids.end()) {
+                num_skipped_blocks_in_ignore_area++;
             }
+        }
 
-            OPENVINO_ASSERT(num_skipped_blocks_in_ignore_area <= m_ignore_first_n_blocks);
-            size_t start_token_offset_in_scores = (m_ignore_first_n_blocks - num_skipped_blocks_in_ignore_area) * m_block_size;
+        OPENVINO_ASSERT(num_skipped_blocks_in_ignore_area <= m_ignore_first_n_blocks);
+        size_t start_token_offset_in_scores = (m_ignore_first_n_blocks - num_skipped_blocks_in_ignore_area) * m_block_size;
 
-            for (size_t skipped_block_id : skipped_logical_block_ids) {
-                if (skipped_block_id >= m_ignore_first_n_blocks) {
-                    skip_set_adjusted.insert(skipped_block_id - m_ignore_first_n_blocks);
-                } // else do not include this block in the adjusted skip set since it is in the start area already
-            }
+        for (size_t skipped_block_id : skipped_logical_block_ids) {
+            if (skipped_block_id >= m_ignore_first_n_blocks) {
+                skip_set_adjusted.insert(skipped_block_id - m_ignore_first_n_blocks);
+            } // else do not include this block in the adjusted skip set since it is in the start area already
+        }
 
-            auto hh_score = ov::Tensor(
-                    attention_scores,
-                    ov::Coordinate{start_token_offset_in_scores},
-                    ov::Coordinate{scores_size_in_tokens}
-            );
-
-            std::vector<double> max_pooled_hh_scores(hh_score.get_size());
-            auto hh_score_data = hh_score.data<float>();
-            size_t num_hh_scores = hh_score.get_size();
-
-            for (size_t idx = 0; idx < num_hh_scores; idx++) {
-                size_t effective_window_size = m_max_pool_window_size;
-                size_t elements_left = num_hh_scores - idx;
-                if (elements_left < effective_window_size) {
-                    effective_window_size = elements_left;
-                }
-                auto max_val = hh_score_data[idx];
-                for (size_t window_idx = 1; window_idx < effective_window_size; window_idx++) {
-                    auto val = hh_score_data[idx + window_idx];
-                    max_val = std::max(val, max_val);
-                }
-                max_pooled_hh_scores[idx] = max_val;
+        auto hh_score = ov::Tensor(
+                attention_scores,
+                ov::Coordinate{start_token_offset_in_scores},
+                ov::Coordinate{scores_size_in_tokens}
+        );
+
+        auto& max_pooled_hh_scores = m_max_pooled_scores[decoder_layer_idx];
+        max_pooled_hh_scores.resize(hh_score.get_size());
+        auto hh_score_data = hh_score.data<float>();
+        size_t num_hh_scores = hh_score.get_size();
+
+        for (size_t idx = 0; idx < num_hh_scores; idx++) {
+            size_t effective_window_size = m_max_pool_window_size;
+            size_t elements_left = num_hh_scores - idx;
+            if (elements_left < effective_window_size) {
+                effective_window_size = elements_left;
             }
+            auto max_val = hh_score_data[idx];
+            for (size_t window_idx = 1; window_idx < effective_window_size; window_idx++) {
+                auto val = hh_score_data[idx + window_idx];
+                max_val = std::max(val, max_val);
+            }
+            max_pooled_hh_scores[idx] = max_val;
+        }
 
-            auto& accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
+        auto& accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
 
-            if (accumulated_scores_for_current_decoder_layer.empty()) {
-                if (m_snapkv_window_size != 0 && num_snapkv_scores == 0) {
-                    // SnapKV window not yet reached, no meaningful scores to accumulate
-                    continue;
+        if (accumulated_scores_for_current_decoder_layer.empty()) {
+            if (m_snapkv_window_size != 0 && num_snapkv_scores == 0) {
+                // SnapKV window not yet reached, no meaningful scores to accumulate
+                return;
+            }
+            // New sequence to track
+            if (skipped_logical_block_ids.empty()) {
+                accumulated_scores_for_current_decoder_layer = max_pooled_hh_scores;
+            }
+            else {
+                accumulated_scores_for_current_decoder_layer.resize(max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size(), 0.0);
+                size_t src_idx = 0;
+                for (size_t dst_idx = 0; dst_idx < accumulated_scores_for_current_decoder_layer.size(); dst_idx++) {
+                    size_t curr_logical_block_idx = dst_idx / m_block_size;
+                    if (skipped_logical_block_ids.find(curr_logical_block_idx) != skipped_logical_block_ids.end()) {
+                        dst_idx += m_block_size;
+                        continue;
+                    }
+                    accumulated_scores_for_current_decoder_layer[dst_idx] = accumulated_scores_for_current_decoder_layer[src_idx];
+                    src_idx++;
                 }
-                // New sequence to track
-                if (skipped_logical_block_ids.empty()) {
-                    accumulated_scores_for_current_decoder_layer = max_pooled_hh_scores;
+                OPENVINO_ASSERT(src_idx == max_pooled_hh_scores.size());
+            }
+
+            if (m_aggregation_mode == AggregationMode::NORM_SUM) {
+                std::size_t new_scores_size = num_hh_scores;
+                auto& counter = m_cache_counter[decoder_layer_idx];
+                counter.assign(new_scores_size, 0);
+                if (m_snapkv_window_size == 0) {
+                    // Will simulate that the tokens comprising the sequence were added one-by-one
+                    // from the standpoint of the occurrence tracker
+                    std::generate(counter.begin(), counter.begin() + new_scores_size,
+                                  [&new_scores_size] { return new_scores_size--; });
                 }
                 else {
-                    accumulated_scores_for_current_decoder_layer.resize(max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size(), 0.0);
-                    size_t src_idx = 0;
-                    for (size_t dst_idx = 0; dst_idx < accumulated_scores_for_current_decoder_layer.size(); dst_idx++) {
-                        size_t curr_logical_block_idx = dst_idx / m_block_size;
-                        if (skipped_logical_block_ids.find(curr_logical_block_idx) != skipped_logical_block_ids.end()) {
-                            dst_idx += m_block_size;
-                            continue;
-                        }
-                        accumulated_scores_for_current_decoder_layer[dst_idx] = accumulated_scores_for_current_decoder_layer[src_idx];
-                        src_idx++;
-                    }
-                    OPENVINO_ASSERT(src_idx == max_pooled_hh_scores.size());
+                    OPENVINO_ASSERT(num_snapkv_scores > 0);
+                    OPENVINO_ASSERT(new_scores_size >= num_snapkv_scores);
+                    std::fill(counter.begin(), counter.end() - num_snapkv_scores, num_snapkv_scores);
+                    std::iota(counter.rbegin(), counter.rbegin() + num_snapkv_scores, 1);
                 }
+            }
+        } else {
+            size_t old_size_in_tokens = accumulated_scores_for_current_decoder_layer.size();
+            size_t new_size_in_tokens = max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size();
 
-                if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-                    std::size_t new_scores_size = num_hh_scores;
-                    std::vector<std::size_t> counter(new_scores_size);
-                    if (m_snapkv_window_size == 0) {
-                        // Will simulate that the tokens comprising the sequence were added one-by-one
-                        // from the standpoint of the occurrence tracker
-                        std::generate(counter.begin(), counter.begin() + new_scores_size,
-                                      [&new_scores_size] { return new_scores_size--; });
+            OPENVINO_ASSERT(new_size_in_tokens >= old_size_in_tokens);
+            size_t num_new_tokens = new_size_in_tokens - old_size_in_tokens;
+            if (m_aggregation_mode == AggregationMode::NORM_SUM) {
+                auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
+                counter_for_current_decoder_layer.resize(new_size_in_tokens);
+                if (m_snapkv_window_size == 0 || m_num_registered_snapkv_aggregated_scores == m_snapkv_window_size) {
+                    // Increment occurrence counts of all currently tracked cache blocks
+                    for (auto it = counter_for_current_decoder_layer.begin();
+                         it != counter_for_current_decoder_layer.end(); it++) {
+                        *it += num_new_tokens;
                     }
-                    else {
-                        OPENVINO_ASSERT(num_snapkv_scores > 0);
-                        OPENVINO_ASSERT(new_scores_size >= num_snapkv_scores);
-                        std::fill(counter.begin(), counter.end() - num_snapkv_scores, num_snapkv_scores);
-                        std::iota(counter.rbegin(), counter.rbegin() + num_snapkv_scores, 1);
+                    // Add occurrence counts for new tokens like above
+                    for (size_t i = 0; i < num_new_tokens; i++) {
+                        auto idx = old_size_in_tokens + i;
+                        counter_for_current_decoder_layer[idx] = num_new_tokens - i;
                     }
-                    m_cache_counter[decoder_layer_idx] = counter;
                 }
-            } else {
-                size_t old_size_in_tokens = accumulated_scores_for_current_decoder_layer.size();
-                size_t new_size_in_tokens = max_pooled_hh_scores.size() + m_block_size * skipped_logical_block_ids.size();
-
-                OPENVINO_ASSERT(new_size_in_tokens >= old_size_in_tokens);
-                size_t num_new_tokens = new_size_in_tokens - old_size_in_tokens;
-                if (m_aggregation_mode == AggregationMode::NORM_SUM) {
-                    auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
-                    counter_for_current_decoder_layer.resize(new_size_in_tokens);
-                    if (m_snapkv_window_size == 0 || m_num_registered_snapkv_aggregated_scores == m_snapkv_window_size) {
-                        // Increment occurrence counts of all currently tracked cache blocks
-                        for (auto it = counter_for_current_decoder_layer.begin();
-                             it != counter_for_current_decoder_layer.end(); it++) {
-                            *it += num_new_tokens;
-                        }
-                        // Add occurrence counts for new tokens like above
-                        for (size_t i = 0; i < num_new_tokens; i++) {
-                            auto idx = old_size_in_tokens + i;
-                            counter_for_current_decoder_layer[idx] = num_new_tokens - i;
-                        }
-                    }
-                    else {
-                        OPENVINO_ASSERT(new_size_in_tokens >= m_num_registered_snapkv_aggregated_scores);
-                        std::fill(counter_for_current_decoder_layer.begin(), counter_for_current_decoder_layer.end() - m_num_registered_snapkv_aggregated_scores, m_num_registered_snapkv_aggregated_scores);
-                        std::iota(counter_for_current_decoder_layer.rbegin(), counter_for_current_decoder_layer.rbegin() + m_num_registered_snapkv_aggregated_scores, 1);
-                    }
-
+                else {
+                    OPENVINO_ASSERT(new_size_in_tokens >= m_num_registered_snapkv_aggregated_scores);
+                    std::fill(counter_for_current_decoder_layer.begin(), counter_for_current_decoder_layer.end() - m_num_registered_snapkv_aggregated_scores, m_num_registered_snapkv_aggregated_scores);
+                    std::iota(counter_for_current_decoder_layer.rbegin(), counter_for_current_decoder_layer.rbegin() + m_num_registered_snapkv_aggregated_scores, 1);
                 }
-                accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
-                add_with_skips(accumulated_scores_for_current_decoder_layer, max_pooled_hh_scores, skip_set_adjusted);
+
             }
+            accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
+            add_with_skips(accumulated_scores_for_current_decoder_layer, max_pooled_hh_scores, skip_set_adjusted);
         }
     }
 
@@ -194,7 +200,7 @@ namespace ov::genai {
         return m_scores[layer_idx].size();
     }
 
-    const std::vector<std::vector<double>>& EvictionScoreManager::get_scores() const {
+    const std::vector<std::vector<float>>& EvictionScoreManager::get_scores() const {
         return m_scores;
     }
 
@@ -202,7 +208,7 @@ namespace ov::genai {
         return m_cache_counter;
     }
 
-    void EvictionScoreManager::add_with_skips(std::vector<double>& dst, const std::vector<double>& src, const std::set<size_t>& skipped_logical_block_ids) const {
+    void EvictionScoreManager::add_with_skips(std::vector<float>& dst, const std::vector<float>& src, const std::set<size_t>& skipped_logical_block_ids) const {
             OPENVINO_ASSERT(skipped_logical_block_ids.size() * m_block_size + src.size() == dst.size());
             size_t src_idx = 0;
             for (size_t dst_idx = 0; dst_idx < dst.size(); dst_idx++) {
@@ -250,62 +256,81 @@ namespace ov::genai {
         // tokens was being computed.
 
         std::vector<std::set<size_t>> retval(m_num_decoder_layers);
-
-        const auto& scores = m_score_manager.get_scores();
-        for (size_t decoder_layer_idx = 0; decoder_layer_idx < scores.size(); decoder_layer_idx++) {
-            const auto &accumulated_scores_for_current_decoder_layer = scores[decoder_layer_idx];
-            auto scores_length = accumulated_scores_for_current_decoder_layer.size();
-            if (scores_length + m_eviction_config.get_start_size() <= get_max_cache_size_after_eviction()) {
-                // KV cache is not yet filled, keep all currently occupied blocks
-                continue;
+        std::vector<size_t> num_evicted_tokens_per_layer(m_num_decoder_layers, 0);
+        auto evict_for_layer = [&](size_t decoder_layer_idx) {
+            retval[decoder_layer_idx] = evict_logical_blocks_for_layer(decoder_layer_idx, num_evicted_tokens_per_layer[decoder_layer_idx]);
+        };
+
+        // random anchor points of KVCrush are drawn from a single generator, so the layers are processed in order
+        // to keep the results reproducible
+        const bool is_kvcrush_random = m_eviction_config.kvcrush_config.budget > 0 &&
+                                       m_eviction_config.kvcrush_config.anchor_point_mode == KVCrushAnchorPointMode::RANDOM;
+        if (is_kvcrush_random) {
+            for (size_t decoder_layer_idx = 0; decoder_layer_idx < m_num_decoder_layers; decoder_layer_idx++) {
+                evict_for_layer(decoder_layer_idx);
             }
+        } else {
+            ov::parallel_for(m_num_decoder_layers, evict_for_layer);
+        }
 
-            // Only the blocks in the "intermediate" part of the logical KV cache will be considered for eviction
-            auto scores_for_all_evictable_blocks = get_scores_for_all_evictable_blocks(decoder_layer_idx);
-            size_t num_blocks_to_evict = get_num_blocks_to_evict(decoder_layer_idx);
-            auto evicted_block_indices = get_indices_of_blocks_to_evict(scores_for_all_evictable_blocks, num_blocks_to_evict);
-
-            // KVCrush: start
-            bool should_apply_kvcrush = (m_eviction_config.kvcrush_config.budget > 0) &&
-                                        (evicted_block_indices.size() >= m_eviction_config.kvcrush_config.budget);
-            if (should_apply_kvcrush) {
-                size_t num_tokens_in_evictable_blocks = scores_for_all_evictable_blocks.size() * m_block_size;
-
-                auto kvcrush_retained_block_indices = m_kvcrush_algo.get_indices_of_blocks_to_retain_using_kvcrush(
-                    num_tokens_in_evictable_blocks,
-                    evicted_block_indices,
-                    m_score_manager.get_scores()[decoder_layer_idx]);
-
-                // Remove the indices in kvcrush_retained_block_indices from evicted_block_indices
-                if (!kvcrush_retained_block_indices.empty()) {
-                    // Convert both vectors to sets for efficient operations
-                    std::unordered_set<std::size_t> retained_set(kvcrush_retained_block_indices.begin(),
-                                                                 kvcrush_retained_block_indices.end());
-
-                    // Create a new vector containing only elements not in retained_set
-                    std::vector<std::size_t> filtered_evicted_indices;
-                    filtered_evicted_indices.reserve(evicted_block_indices.size());
-
-                    for (const auto& idx : evicted_block_indices) {
-                        if (retained_set.find(idx) == retained_set.end()) {
-                            filtered_evicted_indices.push_back(idx);
-                        }
+        m_num_evicted_tokens += std::accumulate(num_evicted_tokens_per_layer.begin(), num_evicted_tokens_per_layer.end(), size_t(0));
+        return retval;
+    }
+
+    std::set<std::size_t> CacheEvictionAlgorithm::evict_logical_blocks_for_layer(size_t decoder_layer_idx, size_t& num_evicted_tokens) {
+        std::set<size_t> retval;
+        const auto &accumulated_scores_for_current_decoder_layer = m_score_manager.get_scores()[decoder_layer_idx];
+        auto scores_length = accumulated_scores_for_current_decoder_layer.size();
+        if (scores_length + m_eviction_config.get_start_size() <= get_max_cache_size_after_eviction()) {
+            // KV cache is not yet filled, keep all currently occupied blocks
+            return retval;
+        }
+
+        // Only the blocks in the "intermediate" part of the logical KV cache will be considered for eviction
+        auto scores_for_all_evictable_blocks = get_scores_for_all_evictable_blocks(decoder_layer_idx);
+        size_t num_blocks_to_evict = get_num_blocks_to_evict(decoder_layer_idx);
+        auto evicted_block_indices = get_indices_of_blocks_to_evict(scores_for_all_evictable_blocks, num_blocks_to_evict);
+
+        // KVCrush: start
+        bool should_apply_kvcrush = (m_eviction_config.kvcrush_config.budget > 0) &&
+                                    (evicted_block_indices.size() >= m_eviction_config.kvcrush_config.budget);
+        if (should_apply_kvcrush) {
+            size_t num_tokens_in_evictable_blocks = scores_for_all_evictable_blocks.size() * m_block_size;
+
+            auto kvcrush_retained_block_indices = m_kvcrush_algo.get_indices_of_blocks_to_retain_using_kvcrush(
+                num_tokens_in_evictable_blocks,
+                evicted_block_indices,
+                m_score_manager.get_scores()[decoder_layer_idx]);
+
+            // Remove the indices in kvcrush_retained_block_indices from evicted_block_indices
+            if (!kvcrush_retained_block_indices.empty()) {
+                // Convert both vectors to sets for efficient operations
+                std::unordered_set<std::size_t> retained_set(kvcrush_retained_block_indices.begin(),
+                                                             kvcrush_retained_block_indices.end());
+
+                // Create a new vector containing only elements not in retained_set
+                std::vector<std::size_t> filtered_evicted_indices;
+                filtered_evicted_indices.reserve(evicted_block_indices.size());
+
+                for (const auto& idx : evicted_block_indices) {
+                    if (retained_set.find(idx) == retained_set.end()) {
+                        filtered_evicted_indices.push_back(idx);
                     }
-                    // Replace the original vector with the filtered one
-                    evicted_block_indices = std::move(filtered_evicted_indices);
                 }
+                // Replace the original vector with the filtered one
+                evicted_block_indices = std::move(filtered_evicted_indices);
             }
-            // KVCrush: end
+        }
+        // KVCrush: end
 
-            m_num_evicted_tokens += evicted_block_indices.size() * m_block_size;
+        num_evicted_tokens = evicted_block_indices.size() * m_block_size;
 
-            // No longer need to track the overall "heavy-hitter" attention scores for freshly evicted blocks
-            remove_scores_of_evicted_blocks(evicted_block_indices, decoder_layer_idx);
+        // No longer need to track the overall "heavy-hitter" attention scores for freshly evicted blocks
+        remove_scores_of_evicted_blocks(evicted_block_indices, decoder_layer_idx);
 
-            // Adjust indices to account for start area
-            for (auto &idx: evicted_block_indices) idx += get_num_blocks(m_eviction_config.get_start_size());
-            for (auto &idx: evicted_block_indices) retval[decoder_layer_idx].insert(idx);
-        }
+        // Adjust indices to account for start area
+        for (auto &idx: evicted_block_indices) idx += get_num_blocks(m_eviction_config.get_start_size());
+        for (auto &idx: evicted_block_indices) retval.insert(idx);
         return retval;
     }
 
@@ -354,7 +379,7 @@ namespace ov::genai {
         return num_evictable_blocks - num_evictable_blocks_to_keep_after_eviction;
     }
 
-    std::vector<double> CacheEvictionAlgorithm::get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const {
+    std::vector<float> CacheEvictionAlgorithm::get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const {
         const auto& accumulated_scores_for_current_decoder_layer = m_score_manager.get_scores()[decoder_layer_idx];
         auto num_tracked_tokens = accumulated_scores_for_current_decoder_layer.size();
         const auto& counter_for_current_decoder_layer = m_score_manager.get_counters()[decoder_layer_idx];
@@ -365,9 +390,9 @@ namespace ov::genai {
 
         size_t num_evictable_blocks = get_num_evictable_blocks(decoder_layer_idx);
 
-        std::vector<double> block_scores(num_evictable_blocks);
+        std::vector<float> block_scores(num_evictable_blocks);
         for (size_t i = 0; i < num_evictable_blocks; ++i) {
-            double normalized_accumulated_attn_score_for_block = 0.0;
+            float normalized_accumulated_attn_score_for_block = 0.0f;
             for (size_t j = 0; j < m_block_size; ++j) {
                 size_t token_offset = m_block_size * i + j;
                 if (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM) {
@@ -385,13 +410,13 @@ namespace ov::genai {
 
     std::vector<std::size_t>
     CacheEvictionAlgorithm::get_indices_of_blocks_to_evict(
-            const std::vector<double> &scores_for_each_evictable_block, size_t num_blocks_to_evict) const {
+            const std::vector<float> &scores_for_each_evictable_block, size_t num_blocks_to_evict) const {
         // Returned indices are offsets of blocks to evict, taken from the beginning of the "intermediate", evictable
         // part of the logical KV cache. Indices are sorted in the ascending order.
         auto current_num_evictable_blocks = scores_for_each_evictable_block.size();
         OPENVINO_ASSERT(current_num_evictable_blocks >= num_blocks_to_evict);
 
-        std::vector<std::pair<double, std::size_t>> evictable_block_score_and_index_pairs;
+        std::vector<std::pair<float, std::size_t>> evictable_block_score_and_index_pairs;
         evictable_block_score_and_index_pairs.reserve(current_num_evictable_blocks);
         for (std::size_t i = 0; i < current_num_evictable_blocks; ++i) {
             evictable_block_score_and_index_pairs.emplace_back(scores_for_each_evictable_block[i], i);
@@ -40,7 +40,7 @@ public:
      * `| L | L - 1 | ... | 2 | 1 |`,
      * where L is the prompt size of the sequence in tokens.
      */
-    explicit EvictionScoreManager(size_t block_size, size_t num_decoder_layers, size_t max_pool_window_size, AggregationMode aggregation_mode, size_t ignore_first_n_blocks = 0, size_t snapkv_window_size = 0) : m_block_size(block_size), m_num_decoder_layers(num_decoder_layers), m_scores(num_decoder_layers), m_cache_counter(num_decoder_layers), m_max_pool_window_size(max_pool_window_size), m_aggregation_mode(aggregation_mode), m_ignore_first_n_blocks(ignore_first_n_blocks), m_snapkv_window_size(snapkv_window_size), m_num_registered_snapkv_aggregated_scores(0) {}
+    explicit EvictionScoreManager(size_t block_size, size_t num_decoder_layers, size_t max_pool_window_size, AggregationMode aggregation_mode, size_t ignore_first_n_blocks = 0, size_t snapkv_window_size = 0) : m_block_size(block_size), m_num_decoder_layers(num_decoder_layers), m_scores(num_decoder_layers), m_cache_counter(num_decoder_layers), m_max_pooled_scores(num_decoder_layers), m_max_pool_window_size(max_pool_window_size), m_aggregation_mode(aggregation_mode), m_ignore_first_n_blocks(ignore_first_n_blocks), m_snapkv_window_size(snapkv_window_size), m_num_registered_snapkv_aggregated_scores(0) {}
 
     /**
      * Registers new token scores and aggregates them internally as necessary. The token scores provided may be corresponding not to all
@@ -52,6 +52,7 @@ public:
      * @param skipped_logical_block_ids Logical block indices which had been skipped during inference call that produced the new scores, and
      * which are missing from the new scores.
      * @param num_snapkv_scores Number of latest token scores that were aggregated together when computing the registered score. If SnapKV is not used, this should be set to 0.
+     * Decoder layers are processed in parallel.
      */
     void register_new_token_scores(const AttentionScoresForEachDecoderLayer& attention_scores_for_all_decoder_layers, const std::set<size_t>& skipped_logical_block_ids, size_t num_snapkv_scores = 0);
 
@@ -72,7 +73,7 @@ public:
      * and B is the block size.
      * @param skipped_logical_block_ids The set of logical block IDs that had been "skipped" from the src values.
      */
-    void add_with_skips(std::vector<double>& dst, const std::vector<double>& src, const std::set<size_t>& skipped_logical_block_ids) const;
+    void add_with_skips(std::vector<float>& dst, const std::vector<float>& src, const std::set<size_t>& skipped_logical_block_ids) const;
 
     /**
      * @param layer_idx The decoder layer index.
@@ -83,7 +84,7 @@ public:
     /**
      * @return Current scores for all decoder layers (0-th dimension) and tokens (1-st dimension).
      */
-    const std::vector<std::vector<double>>& get_scores() const;
+    const std::vector<std::vector<float>>& get_scores() const;
 
     /**
      * @return Current token occurence counters for all decoder layers (0-th dimension) and tokens (1-st dimension).
@@ -91,10 +92,15 @@ public:
     const std::vector<std::vector<size_t>>& get_counters() const;
 
 private:
+    void _register_new_token_scores_for_layer(const AttentionScoresForCacheOfSubsequence& attention_scores, const std::set<size_t>& skipped_logical_block_ids,
+                                              size_t num_snapkv_scores, size_t decoder_layer_idx);
+
     std::size_t m_block_size;
     std::size_t m_num_decoder_layers;
-    std::vector<std::vector<double>> m_scores;
+    std::vector<std::vector<float>> m_scores;
     std::vector<std::vector<size_t>> m_cache_counter;
+    // per-layer buffers for max pooled scores, reused across register calls
+    std::vector<std::vector<float>> m_max_pooled_scores;
     std::size_t m_max_pool_window_size;
     AggregationMode m_aggregation_mode;
     std::size_t m_ignore_first_n_blocks;
@@ -196,6 +202,8 @@ public:
      * Returns the per-layer sets of logical block indices that should be evicted according to the internally computed importance scores
      * and removes the corresponding blocks from the internal algorithm tracking.
      *
+     * Decoder layers are processed in parallel, unless KVCrush with the random anchor point mode is used.
+     *
      * @return A vector with size equal to the configured num_decoder_layers, where each entry is a set of logical indices that are to be
      * evicted by the external cache-controlling mechanism.
      */
@@ -209,9 +217,11 @@ private:
 
     CacheEvictionRange get_evictable_block_range(size_t layer_idx) const;
 
-    std::vector<double> get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const;
+    std::vector<float> get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const;
+
+    std::vector<std::size_t> get_indices_of_blocks_to_evict(const std::vector<float>& scores_for_each_evictable_block, size_t num_blocks_to_evict) const;
 
-    std::vector<std::size_t> get_indices_of_blocks_to_evict(const std::vector<double>& scores_for_each_evictable_block, size_t num_blocks_to_evict) const;
+    std::set<std::size_t> evict_logical_blocks_for_layer(size_t decoder_layer_idx, size_t& num_evicted_tokens);
 
     void remove_scores_of_evicted_blocks(const std::vector<std::size_t>& evicted_block_indices, size_t decoder_layer_idx);
 
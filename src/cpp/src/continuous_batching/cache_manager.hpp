@@ -5,8 +5,10 @@
 
 #include <vector>
 #include <list>
+#include <optional>
 
 #include "openvino/runtime/tensor.hpp"
+#include "continuous_batching/host_memory.hpp"
 
 namespace ov::genai {
 
@@ -20,20 +22,38 @@ class CacheManager {
     size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
     ov::InferRequest m_request;
     ov::RemoteContext m_context;
+    // allocator of KV cache tensors on CPU device, default allocator is used if not set
+    std::optional<ov::Allocator> m_host_allocator;
+
+    // memory reserved on CPU device for up to m_num_reserved_kv_blocks blocks, the cache grows within it without copying
+    struct ReservedMemory {
+        std::shared_ptr<void> data;
+        size_t byte_size = 0;
+    };
+    std::vector<ReservedMemory> m_reserved_key_memory, m_reserved_value_memory;
+    size_t m_num_reserved_kv_blocks = 0;
 
     static ov::Shape set_kv_blocks(ov::PartialShape pshape, size_t num_kv_blocks) {
         pshape[0] = num_kv_blocks;
         return pshape.get_shape();
     }
 
+    ReservedMemory reserve_memory(ov::Allocator& allocator, ov::element::Type precision, const ov::PartialShape& pshape, size_t num_kv_blocks) {
+        ov::Shape shape = set_kv_blocks(pshape, num_kv_blocks);
+        size_t byte_size = (ov::shape_size(shape) * precision.bitwidth() + 7) / 8;
+        void* data = allocator.allocate(byte_size);
+        return {std::shared_ptr<void>(data, [allocator, byte_size] (void* ptr) mutable { allocator.deallocate(ptr, byte_size); }), byte_size};
+    }
+
     void update_request_tensor(size_t decoder_layer_id) {
         m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
     }
 
 public:
-    explicit CacheManager(ov::InferRequest request) :
-        m_request(request) {
+    explicit CacheManager(ov::InferRequest request, std::optional<ov::Allocator> host_allocator = std::nullopt) :
+        m_request(request),
+        m_host_allocator(std::move(host_allocator)) {
         // extract information about inference device
         ov::CompiledModel compiled_model = request.get_compiled_model();
         std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
@@ -101,6 +121,16 @@ public:
         return m_value_precisions[decoder_layer_id];
     }
 
+    const ov::PartialShape& get_key_cache_shape(size_t decoder_layer_id) const {
+        OPENVINO_ASSERT(decoder_layer_id < m_key_shapes.size());
+        return m_key_shapes[decoder_layer_id];
+    }
+
+    const ov::PartialShape& get_value_cache_shape(size_t decoder_layer_id) const {
+        OPENVINO_ASSERT(decoder_layer_id < m_value_shapes.size());
+        return m_value_shapes[decoder_layer_id];
+    }
+
     size_t get_block_size_in_bytes() const {
         return m_block_size_in_bytes;
     }
@@ -118,6 +148,25 @@ public:
 
         m_num_allocated_kv_blocks = num_kv_blocks;
 
+        if (num_kv_blocks <= m_num_reserved_kv_blocks) {
+            // larger tensors are created on top of the same memory, so existing blocks stay in place
+            for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                ov::Tensor key_cache(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks),
+                                     m_reserved_key_memory[decoder_layer_id].data.get());
+                ov::Tensor value_cache(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks),
+                                       m_reserved_value_memory[decoder_layer_id].data.get());
+                if (m_key_cache.size() > decoder_layer_id) {
+                    m_key_cache[decoder_layer_id] = key_cache;
+                    m_value_cache[decoder_layer_id] = value_cache;
+                } else {
+                    m_key_cache.emplace_back(key_cache);
+                    m_value_cache.emplace_back(value_cache);
+                }
+                update_request_tensor(decoder_layer_id);
+            }
+            return;
+        }
+
         ov::Coordinate start_key{0,0,0,0};
         ov::Coordinate start_value{0,0,0,0};
 
@@ -156,8 +205,8 @@ public:
                 ov::element::Type key_precision = get_key_cache_precision(decoder_layer_id);
                 ov::element::Type value_precision = get_value_cache_precision(decoder_layer_id);
 
-                ov::Tensor key_cache(key_precision, key_cache_shape);
-                ov::Tensor value_cache(value_precision, value_cache_shape);
+                ov::Tensor key_cache = m_host_allocator ? ov::Tensor(key_precision, key_cache_shape, *m_host_allocator) : ov::Tensor(key_precision, key_cache_shape);
+                ov::Tensor value_cache = m_host_allocator ? ov::Tensor(value_precision, value_cache_shape, *m_host_allocator) : ov::Tensor(value_precision, value_cache_shape);
 
                 auto key_cache_roi_end = static_cast<unsigned char*>(key_cache.data());
                 auto value_cache_roi_end = static_cast<unsigned char*>(value_cache.data());
@@ -203,6 +252,54 @@ public:
                 update_request_tensor(decoder_layer_id);
             }
         }
+
+        if (m_num_reserved_kv_blocks > 0) {
+            // the cache has outgrown the reserved memory and was copied to new tensors, so the reservation is not used anymore
+            m_reserved_key_memory.clear();
+            m_reserved_value_memory.clear();
+            m_num_reserved_kv_blocks = 0;
+        }
+    }
+
+    /**
+     * Reserves memory for up to max_num_kv_blocks blocks on CPU device. Physical memory is committed when blocks are used for the first time,
+     * so the reservation costs only address space, while the cache grows up to the reserved size without copying of existing blocks.
+     * Has to be called before the first allocation. Does nothing for GPU device or if the platform cannot commit memory lazily.
+     * If the reservation fails, the cache is copied on growth as without reservation.
+     */
+    void reserve_cache(size_t max_num_kv_blocks) {
+        OPENVINO_ASSERT(m_num_allocated_kv_blocks == 0, "KV cache memory can be reserved before allocation of the cache only");
+        if (m_context || get_available_host_memory() == 0 || !can_reserve_host_address_space()) {
+            return;
+        }
+        ov::Allocator allocator = m_host_allocator.value_or(ov::Allocator(HostMemoryAllocator(-1, false)));
+        try {
+            for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+                m_reserved_key_memory.push_back(reserve_memory(allocator, get_key_cache_precision(decoder_layer_id), m_key_shapes[decoder_layer_id], max_num_kv_blocks));
+                m_reserved_value_memory.push_back(reserve_memory(allocator, get_value_cache_precision(decoder_layer_id), m_value_shapes[decoder_layer_id], max_num_kv_blocks));
+            }
+        } catch (const std::exception&) {
+            // e.g. address space is limited by ulimit -v or mmap is rejected in a sandbox
+            m_reserved_key_memory.clear();
+            m_reserved_value_memory.clear();
+            return;
+        }
+        m_num_reserved_kv_blocks = max_num_kv_blocks;
+    }
+
+    size_t get_num_reserved_kv_blocks() const {
+        return m_num_reserved_kv_blocks;
+    }
+
+    /**
+     * Returns physical memory of reserved KV cache to the OS, while tensors stay valid. Contents of all blocks are lost,
+     * so it can be called only when no block holds data to be used later.
+     */
+    void release_reserved_cache_pages() {
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_reserved_key_memory.size(); ++decoder_layer_id) {
+            release_host_memory_pages(m_reserved_key_memory[decoder_layer_id].data.get(), m_reserved_key_memory[decoder_layer_id].byte_size);
+            release_host_memory_pages(m_reserved_value_memory[decoder_layer_id].data.get(), m_reserved_value_memory[decoder_layer_id].byte_size);
+        }
     }
 
     ov::Tensor get_key_cache(size_t decoder_layer_id) const {
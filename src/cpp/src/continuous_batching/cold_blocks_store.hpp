@@ -0,0 +1,248 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "continuous_batching/cache_manager.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Host memory tier for contents of prefix cache KV blocks, which are about to be overwritten by other sequences.
+ * Blocks are kept quantized to 8 or 4 bits with a scale and a minimum per row of the block (one head of one token),
+ * so the tier holds 2-8 times more blocks than the same memory of KV cache in f32 / f16 / bf16. Blocks of KV cache
+ * in already quantized precisions are kept as is. Blocks are looked up by prefix hash and dropped in FIFO order
+ * when the tier is full.
+ */
+class ColdBlocksStore {
+public:
+    struct QuantizedData {
+        std::vector<uint8_t> data;
+        // per row of the block, empty if data holds raw bytes of the block in cache precision
+        std::vector<float> scales, mins;
+    };
+
+    // contents of one KV cache block for all decoder layers
+    struct Block {
+        std::vector<QuantizedData> keys, values;
+    };
+    using BlockPtr = std::shared_ptr<Block>;
+
+    ColdBlocksStore(size_t max_num_blocks, size_t bits) : m_max_num_blocks(max_num_blocks), m_bits(bits) {
+        OPENVINO_ASSERT(bits == 8 || bits == 4, "Cold KV cache blocks can be quantized to 8 or 4 bits only, got ", bits);
+    }
+
+    bool contains(uint64_t hash) const {
+        return m_blocks.count(hash) != 0;
+    }
+
+    size_t num_blocks() const {
+        return m_blocks.size();
+    }
+
+    size_t get_max_num_blocks() const {
+        return m_max_num_blocks;
+    }
+
+    /**
+     * Registers a block with a given prefix hash, dropping the oldest blocks if the store is full.
+     * @return Block to be filled by store_block(), the block can be returned by take() before it is filled.
+     */
+    BlockPtr add(uint64_t hash) {
+        auto block = std::make_shared<Block>();
+        if (m_max_num_blocks == 0) {
+            return block;
+        }
+        _erase(hash);
+        while (m_blocks.size() >= m_max_num_blocks) {
+            _erase(m_order.front());
+        }
+        m_order.push_back(hash);
+        m_blocks[hash] = {block, std::prev(m_order.end())};
+        return block;
+    }
+
+    /**
+     * Removes a block from the store to be loaded back to KV cache.
+     * @return Block stored under a given hash or nullptr if there is no such block.
+     */
+    BlockPtr take(uint64_t hash) {
+        auto it = m_blocks.find(hash);
+        if (it == m_blocks.end()) {
+            return nullptr;
+        }
+        BlockPtr block = it->second.first;
+        _erase(hash);
+        return block;
+    }
+
+    /**
+     * Quantizes contents of a KV cache block of all decoder layers, layers are processed in parallel.
+     */
+    void store_block(Block& block, const CacheManager& cache_manager, size_t block_id) const {
+        const size_t num_layers = cache_manager.get_num_decoder_layers();
+        block.keys.resize(num_layers);
+        block.values.resize(num_layers);
+        ov::parallel_for(num_layers * 2, [&](size_t i) {
+            const size_t layer_id = i / 2;
+            if (i % 2 == 0) {
+                quantize_block(cache_manager.get_key_cache(layer_id), block_id, m_bits, block.keys[layer_id]);
+            } else {
+                quantize_block(cache_manager.get_value_cache(layer_id), block_id, m_bits, block.values[layer_id]);
+            }
+        });
+    }
+
+    /**
+     * Dequantizes contents of a block to a KV cache block of all decoder layers, layers are processed in parallel.
+     */
+    void load_block(const Block& block, const CacheManager& cache_manager, size_t block_id) const {
+        const size_t num_layers = cache_manager.get_num_decoder_layers();
+        OPENVINO_ASSERT(block.keys.size() == num_layers && block.values.size() == num_layers, "Cold KV cache block is not filled");
+        ov::parallel_for(num_layers * 2, [&](size_t i) {
+            const size_t layer_id = i / 2;
+            ov::Tensor cache = i % 2 == 0 ? cache_manager.get_key_cache(layer_id) : cache_manager.get_value_cache(layer_id);
+            dequantize_block(i % 2 == 0 ? block.keys[layer_id] : block.values[layer_id], m_bits, cache, block_id);
+        });
+    }
+
+    /**
+     * @return Size of a block of all decoder layers in the store in bytes
+     */
+    static size_t get_block_size_in_bytes(const CacheManager& cache_manager, size_t bits) {
+        size_t byte_size = 0;
+        for (size_t layer_id = 0; layer_id < cache_manager.get_num_decoder_layers(); ++layer_id) {
+            byte_size += get_quantized_size_in_bytes(cache_manager.get_key_cache_precision(layer_id), cache_manager.get_key_cache_shape(layer_id), bits);
+            byte_size += get_quantized_size_in_bytes(cache_manager.get_value_cache_precision(layer_id), cache_manager.get_value_cache_shape(layer_id), bits);
+        }
+        return byte_size;
+    }
+
+    static size_t get_quantized_size_in_bytes(ov::element::Type precision, const ov::PartialShape& cache_shape, size_t bits) {
+        size_t block_size = 1;
+        for (size_t dim = 1; dim < cache_shape.size(); ++dim) {
+            block_size *= cache_shape[dim].get_length();
+        }
+        if (!is_quantizable(precision)) {
+            return (block_size * precision.bitwidth() + 7) / 8;
+        }
+        const size_t num_rows = block_size / cache_shape[cache_shape.size() - 1].get_length();
+        return (block_size * bits + 7) / 8 + num_rows * 2 * sizeof(float);
+    }
+
+    static bool is_quantizable(ov::element::Type precision) {
+        return precision == ov::element::f32 || precision == ov::element::f16 || precision == ov::element::bf16;
+    }
+
+    /**
+     * Quantizes a block of a cache tensor of [num_blocks, ...] shape with asymmetric quantization per row of the last dimension.
+     */
+    static void quantize_block(const ov::Tensor& cache, size_t block_id, size_t bits, QuantizedData& quantized) {
+        const ov::element::Type precision = cache.get_element_type();
+        const size_t block_size = _get_block_size(cache);
+        if (!is_quantizable(precision)) {
+            const size_t block_byte_size = (block_size * precision.bitwidth() + 7) / 8;
+            const uint8_t* src = static_cast<const uint8_t*>(cache.data()) + block_id * block_byte_size;
+            quantized.data.assign(src, src + block_byte_size);
+            quantized.scales.clear();
+            quantized.mins.clear();
+            return;
+        }
+        if (precision == ov::element::f32) {
+            _quantize(cache.data<const float>() + block_id * block_size, block_size, cache.get_shape().back(), bits, quantized);
+        } else if (precision == ov::element::f16) {
+            _quantize(cache.data<const ov::float16>() + block_id * block_size, block_size, cache.get_shape().back(), bits, quantized);
+        } else {
+            _quantize(cache.data<const ov::bfloat16>() + block_id * block_size, block_size, cache.get_shape().back(), bits, quantized);
+        }
+    }
+
+    static void dequantize_block(const QuantizedData& quantized, size_t bits, ov::Tensor& cache, size_t block_id) {
+        const ov::element::Type precision = cache.get_element_type();
+        const size_t block_size = _get_block_size(cache);
+        if (!is_quantizable(precision)) {
+            OPENVINO_ASSERT(quantized.scales.empty(), "Cold KV cache block was quantized for a different cache precision");
+            std::memcpy(static_cast<uint8_t*>(cache.data()) + block_id * quantized.data.size(), quantized.data.data(), quantized.data.size());
+            return;
+        }
+        if (precision == ov::element::f32) {
+            _dequantize(quantized, bits, cache.get_shape().back(), cache.data<float>() + block_id * block_size, block_size);
+        } else if (precision == ov::element::f16) {
+            _dequantize(quantized, bits, cache.get_shape().back(), cache.data<ov::float16>() + block_id * block_size, block_size);
+        } else {
+            _dequantize(quantized, bits, cache.get_shape().back(), cache.data<ov::bfloat16>() + block_id * block_size, block_size);
+        }
+    }
+
+private:
+    static size_t _get_block_size(const ov::Tensor& cache) {
+        const ov::Shape& shape = cache.get_shape();
+        return ov::shape_size(shape) / shape[0];
+    }
+
+    template <typename T>
+    static void _quantize(const T* src, size_t block_size, size_t row_size, size_t bits, QuantizedData& quantized) {
+        const size_t num_rows = block_size / row_size;
+        const float max_level = static_cast<float>((1 << bits) - 1);
+        quantized.data.assign((block_size * bits + 7) / 8, 0);
+        quantized.scales.resize(num_rows);
+        quantized.mins.resize(num_rows);
+        for (size_t row = 0; row < num_rows; ++row) {
+            const T* row_src = src + row * row_size;
+            float min_value = static_cast<float>(row_src[0]), max_value = min_value;
+            for (size_t i = 1; i < row_size; ++i) {
+                min_value = std::min(min_value, static_cast<float>(row_src[i]));
+                max_value = std::max(max_value, static_cast<float>(row_src[i]));
+            }
+            const float scale = (max_value - min_value) / max_level;
+            const float inv_scale = scale > 0.0f ? 1.0f / scale : 0.0f;
+            quantized.scales[row] = scale;
+            quantized.mins[row] = min_value;
+            for (size_t i = 0; i < row_size; ++i) {
+                const size_t idx = row * row_size + i;
+                const uint8_t level = static_cast<uint8_t>(std::min(max_level, std::round((static_cast<float>(row_src[i]) - min_value) * inv_scale)));
+                if (bits == 8) {
+                    quantized.data[idx] = level;
+                } else {
+                    quantized.data[idx / 2] |= idx % 2 == 0 ? level : static_cast<uint8_t>(level << 4);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    static void _dequantize(const QuantizedData& quantized, size_t bits, size_t row_size, T* dst, size_t block_size) {
+        OPENVINO_ASSERT(quantized.scales.size() * row_size == block_size, "Cold KV cache block was quantized for a different cache shape");
+        for (size_t idx = 0; idx < block_size; ++idx) {
+            const size_t row = idx / row_size;
+            const uint8_t level = bits == 8 ? quantized.data[idx] : (quantized.data[idx / 2] >> (idx % 2 == 0 ? 0 : 4)) & 0xF;
+            dst[idx] = static_cast<T>(quantized.mins[row] + level * quantized.scales[row]);
+        }
+    }
+
+    void _erase(uint64_t hash) {
+        auto it = m_blocks.find(hash);
+        if (it != m_blocks.end()) {
+            m_order.erase(it->second.second);
+            m_blocks.erase(it);
+        }
+    }
+
+    size_t m_max_num_blocks;
+    size_t m_bits;
+    // hashes in the order of addition
+    std::list<uint64_t> m_order;
+    std::unordered_map<uint64_t, std::pair<BlockPtr, std::list<uint64_t>::iterator>> m_blocks;
+};
+
+}  // namespace ov::genai
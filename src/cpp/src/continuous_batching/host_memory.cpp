@@ -0,0 +1,224 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/host_memory.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+// from linux/mempolicy.h, not to depend on libnuma headers
+constexpr int MPOL_BIND_MODE = 2;
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+// value of vm.overcommit_memory, which disables overcommit
+constexpr int STRICT_OVERCOMMIT_POLICY = 2;
+
+// reads a number from a kernel interface file, returns max value for "max" and if the file can't be read
+size_t read_size_or_max(const char* path) {
+    std::ifstream file(path);
+    size_t value = 0;
+    if (file >> value) {
+        return value;
+    }
+    return std::numeric_limits<size_t>::max();
+}
+
+// memory which can be allocated within the memory limit of the cgroup, max value if there is no limit
+size_t get_cgroup_available_memory() {
+    // cgroup v2, a container sees its own cgroup as the root one
+    size_t limit = read_size_or_max("/sys/fs/cgroup/memory.max");
+    size_t usage = read_size_or_max("/sys/fs/cgroup/memory.current");
+    if (limit == std::numeric_limits<size_t>::max()) {
+        // cgroup v1, the limit is a huge number if it's not set
+        limit = read_size_or_max("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+        usage = read_size_or_max("/sys/fs/cgroup/memory/memory.usage_in_bytes");
+    }
+    if (limit == std::numeric_limits<size_t>::max() || usage == std::numeric_limits<size_t>::max()) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return limit > usage ? limit - usage : 0;
+}
+#endif
+
+} // namespace
+
+namespace ov::genai {
+
+HostPlacementConfig extract_host_placement_config(ov::AnyMap& properties) {
+    HostPlacementConfig config;
+    auto numa_node_it = properties.find("kv_cache_numa_node");
+    if (numa_node_it != properties.end()) {
+        config.kv_cache_numa_node = numa_node_it->second.as<int>();
+        properties.erase(numa_node_it);
+    }
+    auto huge_pages_it = properties.find("kv_cache_huge_pages");
+    if (huge_pages_it != properties.end()) {
+        config.kv_cache_huge_pages = huge_pages_it->second.as<bool>();
+        properties.erase(huge_pages_it);
+    }
+    auto cpu_ids_it = properties.find("sampler_cpu_ids");
+    if (cpu_ids_it != properties.end()) {
+        config.sampler_cpu_ids = cpu_ids_it->second.is<std::string>() ? parse_cpu_list(cpu_ids_it->second.as<std::string>())
+                                                                       : cpu_ids_it->second.as<std::vector<size_t>>();
+        properties.erase(cpu_ids_it);
+    }
+    auto release_when_idle_it = properties.find("kv_cache_release_when_idle");
+    if (release_when_idle_it != properties.end()) {
+        config.kv_cache_release_when_idle = release_when_idle_it->second.as<bool>();
+        properties.erase(release_when_idle_it);
+    }
+    auto memory_shares_it = properties.find("kv_cache_memory_shares");
+    if (memory_shares_it != properties.end()) {
+        config.kv_cache_memory_shares = memory_shares_it->second.as<size_t>();
+        OPENVINO_ASSERT(config.kv_cache_memory_shares > 0, "kv_cache_memory_shares must be positive");
+        properties.erase(memory_shares_it);
+    }
+    return config;
+}
+
+ov::AnyMap select_replica_host_placement(ov::AnyMap properties, size_t replica_idx) {
+    auto select = [replica_idx](const std::string& values) {
+        std::vector<std::string> replica_values;
+        std::stringstream stream(values);
+        std::string value;
+        while (std::getline(stream, value, ';')) {
+            replica_values.push_back(value);
+        }
+        OPENVINO_ASSERT(!replica_values.empty(), "Empty list of per replica values");
+        return replica_values[replica_idx % replica_values.size()];
+    };
+
+    auto numa_node_it = properties.find("kv_cache_numa_node");
+    if (numa_node_it != properties.end() && numa_node_it->second.is<std::string>()) {
+        const std::string numa_node = select(numa_node_it->second.as<std::string>());
+        try {
+            numa_node_it->second = std::stoi(numa_node);
+        } catch (const std::logic_error&) {
+            OPENVINO_THROW("Invalid NUMA node '", numa_node, "' in kv_cache_numa_node");
+        }
+    }
+    auto cpu_ids_it = properties.find("sampler_cpu_ids");
+    if (cpu_ids_it != properties.end() && cpu_ids_it->second.is<std::string>()) {
+        cpu_ids_it->second = select(cpu_ids_it->second.as<std::string>());
+    }
+    return properties;
+}
+
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list) {
+    std::vector<size_t> cpu_ids;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        size_t dash_pos = range.find('-');
+        try {
+            size_t first = std::stoul(range.substr(0, dash_pos));
+            size_t last = dash_pos == std::string::npos ? first : std::stoul(range.substr(dash_pos + 1));
+            OPENVINO_ASSERT(first <= last, "Invalid CPU range '", range, "'");
+            for (size_t cpu_id = first; cpu_id <= last; ++cpu_id) {
+                cpu_ids.push_back(cpu_id);
+            }
+        } catch (const std::logic_error&) {
+            OPENVINO_THROW("Invalid CPU list '", cpu_list, "', expected format is like '0-3,8,10-11'");
+        }
+    }
+    return cpu_ids;
+}
+
+size_t get_available_host_memory() {
+#ifdef __linux__
+    // free memory only (_SC_AVPHYS_PAGES) does not count page cache, which the kernel reclaims on demand,
+    // so it is usually much smaller than the memory which can actually be allocated
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    size_t value_kb = 0;
+    // kernels older than 3.14 do not report MemAvailable
+    size_t available = static_cast<size_t>(sysconf(_SC_AVPHYS_PAGES)) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    while (meminfo >> key >> value_kb) {
+        if (key == "MemAvailable:") {
+            available = value_kb * 1024;
+            break;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    // /proc/meminfo describes the host, while a container is killed on reaching the limit of its cgroup
+    return std::min(available, get_cgroup_available_memory());
+#else
+    return 0;
+#endif
+}
+
+bool can_reserve_host_address_space() {
+#ifdef __linux__
+    std::ifstream overcommit_policy("/proc/sys/vm/overcommit_memory");
+    int policy = 0;
+    return !(overcommit_policy >> policy) || policy != STRICT_OVERCOMMIT_POLICY;
+#else
+    return false;
+#endif
+}
+
+void release_host_memory_pages(void* ptr, size_t bytes) {
+#ifdef __linux__
+    madvise(ptr, bytes, MADV_DONTNEED);
+#endif
+}
+
+size_t HostMemoryAllocator::_get_mapping_size(size_t bytes) const {
+#ifdef __linux__
+    const size_t page_size = m_use_huge_pages ? HUGE_PAGE_SIZE : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (bytes + page_size - 1) / page_size * page_size;
+#else
+    return bytes;
+#endif
+}
+
+void* HostMemoryAllocator::allocate(size_t bytes, size_t alignment) {
+#ifdef __linux__
+    // mapping is page aligned, which satisfies any alignment requested for tensors
+    const size_t mapping_size = _get_mapping_size(bytes);
+    void* ptr = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (ptr == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    if (m_use_huge_pages) {
+        // best effort, transparent huge pages can be disabled in the system
+        madvise(ptr, mapping_size, MADV_HUGEPAGE);
+    }
+    if (m_numa_node >= 0) {
+        // pages are not touched yet, so all of them are allocated on the node; best effort if the node or mbind is not available
+        constexpr size_t BITS_PER_MASK_WORD = sizeof(unsigned long) * 8;
+        std::vector<unsigned long> node_mask(m_numa_node / BITS_PER_MASK_WORD + 1, 0);
+        node_mask[m_numa_node / BITS_PER_MASK_WORD] = 1UL << (m_numa_node % BITS_PER_MASK_WORD);
+        syscall(SYS_mbind, ptr, mapping_size, MPOL_BIND_MODE, node_mask.data(), node_mask.size() * BITS_PER_MASK_WORD + 1, 0);
+    }
+    return ptr;
+#else
+    return ::operator new(bytes, std::align_val_t(alignment));
+#endif
+}
+
+void HostMemoryAllocator::deallocate(void* handle, size_t bytes, size_t alignment) {
+#ifdef __linux__
+    munmap(handle, _get_mapping_size(bytes));
+#else
+    ::operator delete(handle, std::align_val_t(alignment));
+#endif
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,99 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "openvino/core/any.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Placement of continuous batching host memory and host threads on multi-socket CPU systems.
+ * Filled from pipeline properties:
+ *  - "kv_cache_numa_node" (int): NUMA node to bind KV cache memory of CPU device to, -1 (default) keeps OS default policy.
+ *  - "kv_cache_huge_pages" (bool): back KV cache memory of CPU device with transparent huge pages where available.
+ *  - "sampler_cpu_ids" (string like "0-7,16" or std::vector<size_t>): CPUs to run sampler threads on, e.g. cores not used by inference streams.
+ *  - "kv_cache_release_when_idle" (bool): return physical memory of dynamically allocated CPU KV cache to the OS each time the pipeline
+ *    has no requests, at the cost of page faults when the memory is used again.
+ *  - "kv_cache_memory_shares" (size_t): number of pipelines allocating KV cache from the same host memory, set by data parallel pipeline
+ *    to the number of its replicas, so each replica reserves its share of available memory only.
+ * Data parallel pipeline accepts values of "kv_cache_numa_node" and "sampler_cpu_ids" for each replica separated by ';', e.g. "0;1" and
+ * "0-7;32-39", see select_replica_host_placement. A single value is applied to all replicas.
+ */
+struct HostPlacementConfig {
+    int kv_cache_numa_node = -1;
+    bool kv_cache_huge_pages = false;
+    std::vector<size_t> sampler_cpu_ids;
+    bool kv_cache_release_when_idle = false;
+    size_t kv_cache_memory_shares = 1;
+
+    bool is_kv_cache_placement_default() const {
+        return kv_cache_numa_node < 0 && !kv_cache_huge_pages;
+    }
+};
+
+/**
+ * Extracts HostPlacementConfig from properties and removes corresponding entries, so they are not passed to the plugin
+ */
+HostPlacementConfig extract_host_placement_config(ov::AnyMap& properties);
+
+/**
+ * Returns properties of a data parallel replica: if "kv_cache_numa_node" or "sampler_cpu_ids" is a string of values separated by ';',
+ * replica_idx takes value replica_idx % number of values, so e.g. replicas are bound to NUMA nodes in round robin order
+ */
+ov::AnyMap select_replica_host_placement(ov::AnyMap properties, size_t replica_idx);
+
+/**
+ * Parses list of CPU ids in the format of taskset / numactl, e.g. "0-3,8,10-11"
+ */
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list);
+
+/**
+ * @return Size of physical memory currently available for new allocations without swapping in bytes (MemAvailable, which includes
+ * reclaimable page cache, limited by memory limit of the cgroup of the process, e.g. of a container), or 0 if it is unknown on the platform
+ */
+size_t get_available_host_memory();
+
+/**
+ * @return Whether physical memory of private anonymous mappings is committed on first touch, so large address space can be reserved
+ * for a growing buffer without accounting it as used memory. It's false under strict overcommit policy (vm.overcommit_memory = 2),
+ * where MAP_NORESERVE is ignored, and on platforms other than Linux.
+ */
+bool can_reserve_host_address_space();
+
+/**
+ * Returns physical pages backing memory mapped by HostMemoryAllocator to the OS, the memory stays mapped and reads as zeros
+ * after that. Does nothing on platforms other than Linux.
+ */
+void release_host_memory_pages(void* ptr, size_t bytes);
+
+/**
+ * @brief Allocator of host tensors, which binds memory pages to a NUMA node and / or advises the kernel to use huge pages.
+ * Memory is mapped directly from the OS, so the binding is applied before pages are touched. Physical pages are committed
+ * on first touch only, so large allocations can be used to reserve address space. On platforms other than Linux
+ * memory is allocated from the heap without any placement.
+ */
+class HostMemoryAllocator {
+public:
+    HostMemoryAllocator(int numa_node, bool use_huge_pages) : m_numa_node(numa_node), m_use_huge_pages(use_huge_pages) {}
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    void deallocate(void* handle, size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    bool is_equal(const HostMemoryAllocator& other) const {
+        return m_numa_node == other.m_numa_node && m_use_huge_pages == other.m_use_huge_pages;
+    }
+
+private:
+    size_t _get_mapping_size(size_t bytes) const;
+
+    int m_numa_node;
+    bool m_use_huge_pages;
+};
+
+}  // namespace ov::genai
@@ -15,7 +15,7 @@ KVCrushAlgorithm::KVCrushAlgorithm(const KVCrushConfig& kvcrush_config, size_t b
 std::vector<size_t> KVCrushAlgorithm::create_indicators_kvcrush(size_t num_tokens_in_evictable_blocks,
 
                                                                 std::vector<size_t>& evicted_block_indices,
-                                                                const std::vector<double>& layer_scores) {
+                                                                const std::vector<float>& layer_scores) {
     // Step 1: Sort the scores of the blocks to be evicted
     const auto& blocks_eligible_for_kvcrush = evicted_block_indices;
     std::vector<size_t> indices(num_tokens_in_evictable_blocks);
@@ -150,7 +150,7 @@ std::vector<std::size_t> KVCrushAlgorithm::get_indices_of_blocks_to_retain_using
 
     size_t num_tokens_in_evictable_blocks,
     std::vector<std::size_t>& evicted_block_indices,
-    const std::vector<double>& layer_scores) {
+    const std::vector<float>& layer_scores) {
     // step 1: Create indicators_kvcrush makes binary feature vectors based on top-k/2 scores
     const auto& blocks_eligible_for_kvcrush = evicted_block_indices;  // only the blocks that are evicted by the score
                                                                       // based eviction are eligible for kvcrush
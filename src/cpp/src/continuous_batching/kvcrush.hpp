@@ -34,12 +34,12 @@ public:
     std::vector<std::size_t> get_indices_of_blocks_to_retain_using_kvcrush(
         size_t num_tokens_in_evictable_blocks,
         std::vector<std::size_t>& evicted_block_indices,
-        const std::vector<double>& layer_scores);
+        const std::vector<float>& layer_scores);
     /** @return A binary (feature) vector of size num_tokens_in_evictable_blocks, where each element indicates wheather
      * the corresponding token has a high score */
     std::vector<size_t> create_indicators_kvcrush(size_t num_tokens_in_evictable_blocks,
                                                   std::vector<size_t>& evicted_block_indices,
-                                                  const std::vector<double>& layer_scores);
+                                                  const std::vector<float>& layer_scores);
     /** @return A binary vector of size block_size, where each individual element is selected based on the anchor point
      * mode */
     std::vector<size_t> create_anchor_point_kvcrush(size_t num_tokens_in_evictable_blocks,
@@ -49,6 +49,10 @@ class ModelRunner {
     // Output shape: [1, conversation length, hidden_size].
     EmbeddingsModel::Ptr m_embedding;
 
+    // duration of the last infer request execution in microseconds
+    float m_last_infer_duration_us = 0.0f;
+    std::chrono::steady_clock::time_point m_infer_start;
+
 public:
     /**
      * Constructs the ModelRunner.
@@ -95,6 +99,14 @@ public:
         return m_request;
     }
 
+    /**
+     * @return Duration of the infer request execution during the last `forward` call in microseconds, excluding input preparation.
+     * When inference is started by `start_forward`, the duration is measured until the inference completion is observed by `wait_forward`.
+     */
+    float get_last_infer_duration_microsec() const {
+        return m_last_infer_duration_us;
+    }
+
     void set_embedding_model(const EmbeddingsModel::Ptr& embedder) {
         m_embedding = embedder;
     }
@@ -129,6 +141,18 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        start_forward(sequence_groups, scheduler_output);
+        return wait_forward(sequence_groups, scheduler_output);
+    }
+
+    /**
+     * Prepares the model inputs as `forward` does and starts the inference asynchronously, so that the caller can do work
+     * independent of the inference results while it is in flight. Must be followed by the `wait_forward` call with the same arguments.
+     * Sequence groups' tokens and the KV cache block tables must not be modified until `wait_forward` returns.
+     * @param sequence_groups A vector of pointers to sequence groups to be processed during this `forward` call
+     * @param scheduler_output The scheduler output struct with information on the specifics of the token scheduling during this forward call
+     */
+    void start_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
 
         size_t batch_size_in_sequences = 0;
@@ -360,10 +384,20 @@ public:
             m_request.set_tensor("score_aggregation_window", score_aggregation_window);
         }
 
+        m_infer_start = std::chrono::steady_clock::now();
+        m_request.start_async();
+    }
+
+    /**
+     * Waits for the inference started by `start_forward`.
+     * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
+     */
+    ov::Tensor wait_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         {
-            static ManualTimer timer("pure generate inference");
+            static thread_local ManualTimer timer("pure generate inference (wait)");
             timer.start();
-            m_request.infer();
+            m_request.wait();
+            m_last_infer_duration_us = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - m_infer_start).count();
             timer.end();
         }
 
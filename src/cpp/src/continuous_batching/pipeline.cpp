@@ -12,6 +12,7 @@
 #include "continuous_batching/pipeline_impl.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "prompt_lookup/prompt_lookup_impl.hpp"
+#include "data_parallel/data_parallel_impl.hpp"
 #include "continuous_batching/timer.hpp"
 #include "utils.hpp"
 #include "visual_language/inputs_embedder.hpp"
@@ -39,6 +40,16 @@ extract_prompt_lookup_from_config(ov::AnyMap& config) {
     return res;
 }
 
+size_t
+extract_data_parallel_replicas_from_config(ov::AnyMap& config) {
+    size_t res = 1;
+    if (config.find(ov::genai::data_parallel_replicas.name()) != config.end()) {
+        res = config.at(ov::genai::data_parallel_replicas.name()).as<size_t>();
+        config.erase(ov::genai::data_parallel_replicas.name());
+    }
+    return res;
+}
+
 float get_load_time(std::chrono::steady_clock::time_point start_time) {
     auto stop_time = std::chrono::steady_clock::now();
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -55,9 +66,10 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
 
     auto model = utils::read_model(models_path, properties);
-    auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model);
+    auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model, models_path);
     auto tokenizer = ov::genai::Tokenizer(models_path, tokenizer_properties);
     auto generation_config = utils::from_config_json_if_exists(models_path);
 
@@ -66,7 +78,11 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
         embedder = std::make_shared<InputsEmbedder>(models_path, device, vision_encoder_properties);
     }
 
-    if (is_prompt_lookup_enabled) {
+    if (data_parallel_replicas > 1) {
+        OPENVINO_ASSERT(!is_prompt_lookup_enabled && draft_model_desr.model == nullptr, "Data parallel replicas are not supported with speculative and prompt lookup decoding");
+        OPENVINO_ASSERT(embedder == nullptr, "Data parallel replicas are not supported for models with embeddings");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config, data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
@@ -94,9 +110,10 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
 
     auto model = utils::read_model(models_path, properties_without_draft_model);
-    auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model);
+    auto [properties_without_draft_model_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties_without_draft_model, models_path);
 
     auto generation_config = utils::from_config_json_if_exists(models_path);
 
@@ -105,7 +122,11 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         embedder = std::make_shared<InputsEmbedder>(models_path, device, properties_without_draft_model_without_gguf);
     }
 
-    if (is_prompt_lookup_enabled) {
+    if (data_parallel_replicas > 1) {
+        OPENVINO_ASSERT(!is_prompt_lookup_enabled && draft_model_desr.model == nullptr, "Data parallel replicas are not supported with speculative and prompt lookup decoding");
+        OPENVINO_ASSERT(embedder == nullptr, "Data parallel replicas are not supported for models with embeddings");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config, data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model_without_gguf, generation_config);
@@ -135,6 +156,7 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
     auto model = utils::singleton_core().read_model(model_str, weights_tensor);
 
     auto rt_info = model->get_rt_info();
@@ -148,7 +170,11 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         }
     }
 
-    if (is_prompt_lookup_enabled) {
+    if (data_parallel_replicas > 1) {
+        OPENVINO_ASSERT(!is_prompt_lookup_enabled && draft_model_desr.model == nullptr, "Data parallel replicas are not supported with speculative and prompt lookup decoding");
+        OPENVINO_ASSERT(embedder == nullptr, "Data parallel replicas are not supported for models with embeddings");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
@@ -178,6 +204,7 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    auto data_parallel_replicas = extract_data_parallel_replicas_from_config(properties_without_draft_model);
     auto model_pair = utils::get_model_weights_pair(models_map, "language");
     auto model = utils::singleton_core().read_model(model_pair.first, model_pair.second);
 
@@ -196,7 +223,11 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
         }
     }
 
-    if (is_prompt_lookup_enabled) {
+    if (data_parallel_replicas > 1) {
+        OPENVINO_ASSERT(!is_prompt_lookup_enabled && draft_model_desr.model == nullptr, "Data parallel replicas are not supported with speculative and prompt lookup decoding");
+        OPENVINO_ASSERT(embedder == nullptr, "Data parallel replicas are not supported for models with embeddings");
+        m_impl = std::make_shared<DataParallelImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config, data_parallel_replicas);
+    } else if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
         OPENVINO_ASSERT(embedder == nullptr, "Prompt lookup decoding is not supported for models with embeddings");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
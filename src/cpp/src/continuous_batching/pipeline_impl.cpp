@@ -5,6 +5,7 @@
 #include <thread>
 #include <optional>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/genai/text_streamer.hpp"
 #include "continuous_batching/pipeline_impl.hpp"
 #include "utils.hpp"
@@ -79,9 +80,94 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
+    const auto& sched_config = m_scheduler->get_config();
+    if (sched_config.enable_prompt_deduplication && !sched_config.use_cache_eviction && !m_adapter_controller) {
+        for (const auto& sequence_group : m_awaiting_requests) {
+            size_t num_shared_blocks = 0;
+            if (SequenceGroup::Ptr leader = _find_prompt_fork_leader(sequence_group, num_shared_blocks)) {
+                m_pending_prompt_forks.push_back({sequence_group, leader, num_shared_blocks});
+            } else {
+                m_requests.push_back(sequence_group);
+            }
+        }
+    } else {
+        m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
+    }
     m_awaiting_requests.clear();
-    m_pipeline_metrics.requests = m_requests.size();
+    m_pipeline_metrics.requests = m_requests.size() + m_pending_prompt_forks.size();
+}
+
+SequenceGroup::Ptr ContinuousBatchingPipeline::ContinuousBatchingImpl::_find_prompt_fork_leader(const SequenceGroup::Ptr& sequence_group, size_t& num_shared_blocks) const {
+    auto is_token_prompt = [] (const SequenceGroup::Ptr& group) {
+        return group->get_sequence_group_type() == SequenceGroupType::TOKENS && !group->get_token_type_ids().has_value();
+    };
+
+    num_shared_blocks = 0;
+    // requests with restored prefix cache already have their prompt blocks, 'echo' requires logits for all prompt tokens
+    if (!is_token_prompt(sequence_group) || sequence_group->get_num_processed_tokens() > 0 || sequence_group->get_sampling_parameters().echo) {
+        return nullptr;
+    }
+
+    const TokenIds& prompt_ids = sequence_group->get_prompt_ids();
+    if (prompt_ids.size() <= m_block_size) {
+        return nullptr;
+    }
+    // the last prompt token is always computed by the request itself to get logits for sampling
+    const size_t max_shared_len = prompt_ids.size() - 1;
+    SequenceGroup::Ptr leader = nullptr;
+    for (const auto& candidate : m_requests) {
+        if (candidate == sequence_group || !is_token_prompt(candidate) || candidate->has_finished() || candidate->is_waiting() ||
+            candidate->handle_stopped() || candidate->handle_cancelled()) {
+            continue;
+        }
+        const TokenIds& candidate_prompt_ids = candidate->get_prompt_ids();
+        size_t compare_len = std::min(max_shared_len, candidate_prompt_ids.size());
+        size_t common_prefix_len = std::mismatch(prompt_ids.begin(), prompt_ids.begin() + compare_len, candidate_prompt_ids.begin()).first - prompt_ids.begin();
+        size_t candidate_num_shared_blocks = common_prefix_len / m_block_size;
+        if (candidate_num_shared_blocks > num_shared_blocks) {
+            num_shared_blocks = candidate_num_shared_blocks;
+            leader = candidate;
+        }
+    }
+    return leader;
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_release_pending_prompt_forks() {
+    std::vector<PendingPromptFork> still_pending;
+    for (auto& pending : m_pending_prompt_forks) {
+        if (pending.sequence_group->handle_stopped() || pending.sequence_group->handle_cancelled()) {
+            // will be released from running queue at the end of the step
+            m_requests.push_back(pending.sequence_group);
+            continue;
+        }
+
+        const SequenceGroup::Ptr& leader = pending.leader;
+        const bool is_leader_alive = !leader->has_finished() && !leader->is_waiting() && !leader->handle_stopped() && !leader->handle_cancelled();
+        if (!is_leader_alive) {
+            // leader cannot provide the prefix anymore, try another one or compute the prompt from scratch
+            pending.leader = _find_prompt_fork_leader(pending.sequence_group, pending.num_shared_blocks);
+            if (pending.leader) {
+                still_pending.push_back(pending);
+            } else {
+                m_requests.push_back(pending.sequence_group);
+            }
+            continue;
+        }
+
+        const size_t num_shared_tokens = pending.num_shared_blocks * m_block_size;
+        if (leader->get_num_processed_tokens() < num_shared_tokens) {
+            still_pending.push_back(pending);
+            continue;
+        }
+
+        const uint64_t leader_seq_id = leader->get_running_sequences()[0]->get_id();
+        OPENVINO_ASSERT(m_scheduler->has_block_table(leader_seq_id), "Leader of prompt deduplication has no KV cache blocks");
+        const uint64_t seq_id = (*pending.sequence_group)[0]->get_id();
+        m_scheduler->fork_sequence(leader_seq_id, seq_id, pending.num_shared_blocks);
+        pending.sequence_group->update_processed_tokens_num(num_shared_tokens);
+        m_requests.push_back(pending.sequence_group);
+    }
+    m_pending_prompt_forks = std::move(still_pending);
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
@@ -103,8 +189,17 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract host memory / threads placement properties if exist and remove them from properties
+    m_host_placement_config = extract_host_placement_config(filtered_properties.fork());
 
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
+    initialize_pipeline(compiled_model, scheduler_config, sampler_num_threads);
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
+    const ov::CompiledModel& compiled_model,
+    const SchedulerConfig& scheduler_config,
+    size_t sampler_num_threads) {
     std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
     const bool all_gpu_device =
         std::all_of(execution_devices.begin(), execution_devices.end(), [&](const std::string& device) {
@@ -118,7 +213,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     ov::InferRequest infer_request = compiled_model.create_infer_request();
 
     // Cache manager
-    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request);
+    std::optional<ov::Allocator> kv_cache_allocator;
+    if (!m_host_placement_config.is_kv_cache_placement_default()) {
+        kv_cache_allocator = ov::Allocator(HostMemoryAllocator(m_host_placement_config.kv_cache_numa_node, m_host_placement_config.kv_cache_huge_pages));
+    }
+    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request, kv_cache_allocator);
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
     m_block_size = cache_manager->get_block_size();
 
@@ -167,9 +266,18 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
                                                        is_use_xattention);
     }
 
-    m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads);
+    m_scheduler->set_num_host_memory_shares(m_host_placement_config.kv_cache_memory_shares);
+
+    m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads, m_host_placement_config.sampler_cpu_ids);
     m_sampler->set_seed(m_generation_config.rng_seed);
 
+    // structured output controller is created once for vocab size of the model, so it's not replaced by sampling,
+    // while add_request() prefetches grammars into it from other threads
+    const ov::PartialShape logits_shape = compiled_model.output("logits").get_partial_shape();
+    if (m_tokenizer.m_pimpl != nullptr && logits_shape.rank().is_static() && logits_shape[logits_shape.size() - 1].is_static()) {
+        m_tokenizer.m_pimpl->get_structured_output_controller(static_cast<int>(logits_shape[logits_shape.size() - 1].get_length()));
+    }
+
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
         m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
@@ -229,6 +337,9 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
     }
     OPENVINO_ASSERT(sampling_params.max_length > prompt_len, "'max_length' must be greater than the number of prompt tokens");
 
+    // compile structured output grammar while the request waits for scheduling and its prompt is processed
+    m_sampler->prefetch_structured_output(sampling_params);
+
     auto sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size, token_type_ids);
 
     if (m_scheduler->get_config().enable_prefix_caching) {
@@ -266,19 +377,22 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
 
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    return !m_awaiting_requests.empty() || !m_requests.empty();
+    return !m_awaiting_requests.empty() || !m_requests.empty() || !m_pending_prompt_forks.empty();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
-    static ManualTimer step_timer("step()");
+    static thread_local ManualTimer step_timer("step()");
     step_timer.start();
+    const auto step_start = std::chrono::steady_clock::now();
 
     _pull_awaiting_requests();
+    // forks modify block tables, so they are released only when no inference is in flight
+    _release_pending_prompt_forks();
 
     Scheduler::Output scheduler_output;
 
     {
-        static ManualTimer scheduling_timer("scheduling");
+        static thread_local ManualTimer scheduling_timer("scheduling");
         scheduling_timer.start();
         scheduler_output = m_scheduler->schedule(m_requests);
         scheduling_timer.end();
@@ -313,13 +427,28 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     ov::Tensor logits;
 
     {
-        static ManualTimer timer("forward");
+        static thread_local ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
-        logits = m_model_runner->forward(m_requests, scheduler_output);
+        m_model_runner->start_forward(m_requests, scheduler_output);
+
+        // host work which does not depend on results of the current step is done while inference is in flight
+        {
+            static thread_local ManualTimer overlapped_timer("overlapped with inference");
+            overlapped_timer.start();
+            const auto overlapped_start = std::chrono::steady_clock::now();
+            _do_work_overlapped_with_inference();
+            m_pipeline_metrics.overlapped_host_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - overlapped_start);
+            overlapped_timer.end();
+        }
+
+        logits = m_model_runner->wait_forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
         timer.end();
+
+        m_scheduler->register_step_latency(scheduler_output.m_total_num_scheduled_tokens, m_model_runner->get_last_infer_duration_microsec() / 1000.0f);
+        m_pipeline_metrics.prefill_token_budget = scheduler_output.m_prefill_token_budget;
     }
 
 #ifdef DEBUG_CACHE_STATE_DUMP
@@ -330,7 +459,12 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     // evict unimportant blocks from KV cache, if requested
     const auto& sched_config = m_scheduler->get_config();
     if (sched_config.use_cache_eviction) {
+        static thread_local ManualTimer eviction_timer("cache eviction");
+        eviction_timer.start();
+        const auto eviction_start = std::chrono::steady_clock::now();
         _maybe_evict_cache_blocks(sched_config, scheduler_output);
+        m_pipeline_metrics.cache_eviction_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - eviction_start);
+        eviction_timer.end();
     }
 
 #ifdef DEBUG_CACHE_STATE_DUMP
@@ -344,7 +478,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     SamplerOutput sampler_output;
     {
-        static ManualTimer timer("sample");
+        static thread_local ManualTimer timer("sample");
         timer.start();
         sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
         m_batch_size = sampler_output.num_generated_tokens;
@@ -353,7 +487,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
-        static ManualTimer free_fork_timer("fork / free sequence");
+        static thread_local ManualTimer free_fork_timer("fork / free sequence");
         free_fork_timer.start();
 
         for (const auto& pair : sampler_output.m_forked_sequences) {
@@ -369,13 +503,16 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         free_fork_timer.end();
     }
     
+    // register time to first token of requests, which have generated their first token at this step
+    _register_first_token_latencies();
+
     // append embeddings for generated tokens
     if (m_model_input_type == ModelInputType::EMBEDDINGS)
         m_model_runner->append_embeddings(m_requests, scheduler_output);
 
     // notify requests dropped by handle
     {
-        static ManualTimer report_tokens_timer("notify requests dropped by handle");
+        static thread_local ManualTimer report_tokens_timer("notify requests dropped by handle");
         report_tokens_timer.start();
         _notify_requests_dropped_by_handle();
         report_tokens_timer.end();
@@ -384,15 +521,30 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     // free non running requests for current step
 
     {
-        static ManualTimer clean_up_requests_timer("free non running requests");
+        static thread_local ManualTimer clean_up_requests_timer("free non running requests");
         clean_up_requests_timer.start();
         _free_non_running_requests();
         clean_up_requests_timer.end();
     }
 
+    if (m_host_placement_config.kv_cache_release_when_idle && !has_non_finished_requests()) {
+        m_scheduler->release_idle_cache_memory();
+    }
+
+    m_pipeline_metrics.step_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
     step_timer.end();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_do_work_overlapped_with_inference() {
+    // compute structured output token masks of scheduled requests, tasks run in the sampler thread pool
+    m_sampler->prepare_logit_processors(m_requests);
+
+    // new requests are appended to m_requests or to pending prompt forks and are not scheduled at the current step,
+    // pending forks are released at the beginning of the next step, so block tables of the sequences being inferred
+    // are not affected
+    _pull_awaiting_requests();
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std::optional<AdapterConfig>& adapters) {
     if (m_adapter_controller) {
         m_adapter_controller->apply(m_model_runner->get_infer_request(), adapters);
@@ -528,6 +680,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
+            m_pipeline_metrics.e2e_latency_per_priority[request->get_priority()].add(request->get_elapsed_time_ms());
             for (const auto& sequence: request->get_sequences()) {
                 if (m_scheduler->has_block_table(sequence->get_id())) {
                     m_scheduler->free_sequence(sequence->get_id());
@@ -541,6 +694,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_first_token_latencies() {
+    for (const SequenceGroup::Ptr& request : m_requests) {
+        if (!request->is_first_token_registered() && request->has_generated_tokens()) {
+            m_pipeline_metrics.ttft_per_priority[request->get_priority()].add(request->get_elapsed_time_ms());
+            request->set_first_token_registered();
+        }
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_notify_requests_dropped_by_handle() {
     // Notify the last time by pushing empty output
     // This causes read() to unblock by adding anything to the queue
@@ -577,6 +739,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests() {
         m_sampler->clear_request_info(request->get_request_id());
     }
     m_requests.clear();
+
+    for (const auto& pending : m_pending_prompt_forks) {
+        const uint64_t seq_id = (*pending.sequence_group)[0]->get_id();
+        if (m_scheduler->has_block_table(seq_id)) {
+            m_scheduler->free_sequence(seq_id);
+        }
+        m_sampler->clear_request_info(pending.sequence_group->get_request_id());
+    }
+    m_pending_prompt_forks.clear();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups,
@@ -661,14 +832,23 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
     m_previous_evicted_block_logical_indices_per_sequence.clear();
     m_previous_num_blocks_before_eviction_per_sequence.clear();
 
+    struct SequenceEviction {
+        size_t seq_id;
+        const AttentionScoresForEachDecoderLayer* attention_scores_for_all_decoder_layers;
+        CacheEvictionAlgorithm* cache_eviction_algo;
+        SequenceGroup::Ptr seq_group_ptr;
+        std::set<size_t> skip_set;
+        std::vector<std::set<size_t>> logical_blocks_to_evict;
+    };
+    std::vector<SequenceEviction> sequence_evictions;
+    sequence_evictions.reserve(sequence_attention_scores.size());
+
     for (auto& seq_id_and_attention_scores : sequence_attention_scores) {
         auto seq_id = seq_id_and_attention_scores.first;
-        const auto& attention_scores_for_all_decoder_layers = seq_id_and_attention_scores.second;
         if (m_seq_group_id_to_cache_eviction_algo_map.find(seq_id) == m_seq_group_id_to_cache_eviction_algo_map.end()) {
             constexpr size_t MAX_POOL_WINDOW_SIZE = 7;
             m_seq_group_id_to_cache_eviction_algo_map[seq_id] = CacheEvictionAlgorithm(sched_config.cache_eviction_config, m_block_size, num_decoder_layers, MAX_POOL_WINDOW_SIZE);
         }
-        auto& cache_eviction_algo = m_seq_group_id_to_cache_eviction_algo_map[seq_id];
         std::set<size_t> skip_set;
         if (scheduler_output.m_apply_sparse_attention_mask) {
             const auto& skip_map = scheduler_output.m_sparse_attention_skipped_logical_blocks;
@@ -678,23 +858,36 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
             }
         }
 
-        if (skip_set.empty()) {
-            // For now, will only register token scores from the dense attention stages
-            cache_eviction_algo.register_new_token_scores(attention_scores_for_all_decoder_layers, skip_set, scheduler_output.m_score_aggregation_windows.at(seq_id));
-        }
-
         auto seq_group_ptr_it = std::find_if(m_requests.begin(), m_requests.end(), [seq_id](const SequenceGroup::Ptr& val) { return val->has_sequence_with_id(seq_id); });
         OPENVINO_ASSERT(seq_group_ptr_it != m_requests.end(), "could not find sequence group with sequence ", seq_id);
-        auto seq_group_ptr = *seq_group_ptr_it;
 
-         if (!seq_group_ptr->can_generate_tokens()) {
-             // do not evict during prefill
-             continue;
-         }
+        sequence_evictions.push_back({seq_id, &seq_id_and_attention_scores.second, &m_seq_group_id_to_cache_eviction_algo_map[seq_id], *seq_group_ptr_it, std::move(skip_set), {}});
+    }
+
+    // score registration and eviction decisions of different sequences are independent, each of them is also parallel across layers
+    ov::parallel_for(sequence_evictions.size(), [&](size_t idx) {
+        auto& sequence_eviction = sequence_evictions[idx];
+        if (sequence_eviction.skip_set.empty()) {
+            // For now, will only register token scores from the dense attention stages
+            sequence_eviction.cache_eviction_algo->register_new_token_scores(*sequence_eviction.attention_scores_for_all_decoder_layers, sequence_eviction.skip_set,
+                                                                            scheduler_output.m_score_aggregation_windows.at(sequence_eviction.seq_id));
+        }
+        // do not evict during prefill
+        if (sequence_eviction.seq_group_ptr->can_generate_tokens()) {
+            sequence_eviction.logical_blocks_to_evict = sequence_eviction.cache_eviction_algo->evict_logical_blocks();
+        }
+    });
+
+    for (auto& sequence_eviction : sequence_evictions) {
+        auto seq_id = sequence_eviction.seq_id;
+        auto seq_group_ptr = sequence_eviction.seq_group_ptr;
+        if (!seq_group_ptr->can_generate_tokens()) {
+            continue;
+        }
 
         m_previous_num_blocks_before_eviction_per_sequence[seq_id] = seq_group_ptr->get_num_logical_blocks();
 
-        auto logical_blocks_to_evict = cache_eviction_algo.evict_logical_blocks();
+        const auto& logical_blocks_to_evict = sequence_eviction.logical_blocks_to_evict;
         m_previous_evicted_block_logical_indices_per_sequence[seq_id] = logical_blocks_to_evict;
 
         m_scheduler->free_blocks_from_sequence(seq_id, logical_blocks_to_evict);
@@ -7,6 +7,7 @@
 
 #include "openvino/genai/lora_adapter.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/host_memory.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 namespace ov::genai {
@@ -25,6 +26,15 @@ protected:
     // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
     std::mutex m_awaiting_requests_mutex;
 
+    // request pulled from awaiting queue, which waits until KV cache of its prompt prefix is computed by another (leader)
+    // running request with the same prompt prefix, see SchedulerConfig::enable_prompt_deduplication
+    struct PendingPromptFork {
+        SequenceGroup::Ptr sequence_group;
+        SequenceGroup::Ptr leader;
+        size_t num_shared_blocks;
+    };
+    std::vector<PendingPromptFork> m_pending_prompt_forks;
+
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
     static const size_t AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS = 1000;
@@ -40,6 +50,9 @@ protected:
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
 
+    // NUMA / huge pages placement of KV cache on CPU and CPU affinity of sampler threads
+    HostPlacementConfig m_host_placement_config;
+
     // Pre-allocated per-layer storages for the per-token cache re-rotation deltas used in cache eviction case
     std::vector<ov::Tensor> m_rotation_deltas_stores;
 
@@ -65,16 +78,48 @@ protected:
                              const ov::AnyMap& plugin_config);
 
     /**
-     * Pulls requests from awaiting queue to running queue
-     * Should be called within each call of step()
+     * Creates infer request, KV cache, scheduler and sampler on top of already compiled model,
+     * so several pipelines can share a single compiled model
+     */
+    void initialize_pipeline(const ov::CompiledModel& compiled_model,
+                             const SchedulerConfig& scheduler_config,
+                             size_t sampler_num_threads);
+
+    /**
+     * Pulls requests from awaiting queue to running queue, or to pending prompt forks if prompt deduplication is enabled
+     * Should be called within each call of step(), KV cache blocks are not modified
      */
     virtual void _pull_awaiting_requests();
 
+    /**
+     * Finds a running request which prompt shares at least one full KV cache block with the prompt of a given request
+     * @param num_shared_blocks number of KV cache blocks which can be shared with the found request
+     * @return request with the largest number of shareable blocks or nullptr if there is no such request
+     */
+    SequenceGroup::Ptr _find_prompt_fork_leader(const SequenceGroup::Ptr& sequence_group, size_t& num_shared_blocks) const;
+
+    /**
+     * Moves requests from pending prompt forks to running queue once their leaders have computed the shared prompt prefix,
+     * forking KV cache blocks of the shared prefix from the leaders
+     */
+    void _release_pending_prompt_forks();
+
+    /**
+     * Does host work which does not depend on results of the current step (e.g. pulling new requests, structured
+     * output masks computation) while the model inference started by ModelRunner::start_forward is in flight
+     */
+    void _do_work_overlapped_with_inference();
+
     /**
      * Releases non-running (finished, dropped or OOM) requests from running queue
      */
     void _free_non_running_requests();
 
+    /**
+     * Registers time to first token in pipeline metrics for requests which have generated their first token
+     */
+    void _register_first_token_latencies();
+
     /**
      * Notify dropped requests by pushing empty output
      */
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <numeric>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
@@ -12,10 +13,12 @@
 #include "continuous_batching/block_manager.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/cold_blocks_store.hpp"
 #include "continuous_batching/timer.hpp"
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/adaptive_prefill_controller.hpp"
 
 namespace ov::genai {
 class Scheduler {
@@ -32,8 +35,26 @@ class Scheduler {
     const float m_cache_growth_factor = 2; // commmon values 1.5 or 2
 
     std::shared_ptr<CacheManager> m_cache_manager;
+    // number of pipelines which allocate KV cache from the same host memory, e.g. data parallel replicas
+    size_t m_num_host_memory_shares = 1;
 
     size_t m_snapkv_window_size = 1;
+
+    // tunes the number of prompt tokens per step in dynamic split-fuse mode, if target_inter_token_latency_ms is set
+    std::optional<AdaptivePrefillController> m_prefill_controller;
+
+    // quantized host tier for prefix cache blocks, which are overwritten by other sequences, see SchedulerConfig::cold_cache_size
+    std::optional<ColdBlocksStore> m_cold_blocks;
+    struct ColdBlockTransfer {
+        ColdBlocksStore::BlockPtr block;
+        size_t block_id;
+        bool is_store;
+    };
+    // copies between KV cache and cold blocks in the order they have to be applied before the next inference
+    std::vector<ColdBlockTransfer> m_cold_block_transfers;
+    // requests added since the last schedule() call, which cached prompt prefix may be continued with cold blocks
+    std::vector<std::weak_ptr<SequenceGroup>> m_cold_restore_candidates;
+    std::mutex m_cold_restore_candidates_mutex;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -59,6 +80,8 @@ public:
         bool is_prompt = false;
         // current cache usage
         float m_cache_usage = 0.0;
+        // max number of prompt tokens allowed at this step by adaptive prefill chunking, 0 if it is disabled
+        size_t m_prefill_token_budget = 0;
     };
 
     Scheduler(size_t block_size, std::shared_ptr<CacheManager> cache_manager, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true, size_t snapkv_window_size = 1) :
@@ -68,6 +91,40 @@ public:
         m_snapkv_window_size(snapkv_window_size) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        if (m_config.dynamic_split_fuse && m_config.target_inter_token_latency_ms > 0.0f) {
+            size_t max_prefill_chunk_size = m_config.max_prefill_chunk_size == 0 ? m_config.max_num_batched_tokens :
+                std::min(m_config.max_prefill_chunk_size, m_config.max_num_batched_tokens);
+            m_prefill_controller = AdaptivePrefillController(m_config.target_inter_token_latency_ms,
+                                                             std::min(m_config.min_prefill_chunk_size, max_prefill_chunk_size),
+                                                             max_prefill_chunk_size);
+        }
+        if (m_config.cold_cache_size > 0) {
+            OPENVINO_ASSERT(m_config.enable_prefix_caching, "SchedulerConfig.cold_cache_size can be set only together with enable_prefix_caching");
+            OPENVINO_ASSERT(m_cache_manager->get_device().find("GPU") == std::string::npos, "SchedulerConfig.cold_cache_size is supported for CPU device only");
+            size_t size_in_bytes = m_config.cold_cache_size * 1024 * 1024 * 1024; // convert GBs to bytes
+            size_t block_size_in_bytes = ColdBlocksStore::get_block_size_in_bytes(*m_cache_manager, m_config.cold_cache_bits);
+            m_cold_blocks.emplace(size_in_bytes / block_size_in_bytes, m_config.cold_cache_bits);
+            m_block_manager->enable_overwritten_blocks_tracking();
+        }
+    }
+
+    /**
+     * Sets number of pipelines sharing host memory, so reservation of dynamically allocated CPU KV cache is limited by their share of
+     * available memory. Has to be called before the first schedule() call.
+     */
+    void set_num_host_memory_shares(size_t num_host_memory_shares) {
+        OPENVINO_ASSERT(num_host_memory_shares > 0);
+        m_num_host_memory_shares = num_host_memory_shares;
+    }
+
+    /**
+     * Returns physical memory of dynamically allocated CPU KV cache to the OS if no blocks are in use (and no blocks are kept by prefix caching).
+     * Number of blocks is kept, so the memory is committed again once the blocks are used.
+     */
+    void release_idle_cache_memory() {
+        if (m_dynamic_memory_allocation && !m_config.enable_prefix_caching && m_block_manager->get_used_percentage() == 0.0f) {
+            m_cache_manager->release_reserved_cache_pages();
+        }
     }
 
     void release() {
@@ -83,10 +140,18 @@ public:
         // free some blocks taken by non-confirmed condidates in SD / prompt look-up
         clean_empty_blocks(sequence_groups);
 
+        // order groups by priority and TTFT slack, so that prompt admission follows this order and
+        // preemption victims are taken from the tail
+        _sort_by_priority(sequence_groups);
+
         if (m_block_manager->get_total_number_of_kv_blocks() == 0) {
             _initialize_cache(sequence_groups);
         }
 
+        if (m_cold_blocks) {
+            _restore_cold_blocks();
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -109,7 +174,15 @@ public:
         _clear_waiting_sequences(sequence_groups);
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
 
-        static ManualTimer copy_blocks_timer("copy block");
+        if (m_cold_blocks) {
+            // blocks overwritten by this step have to be saved before copies to them
+            static thread_local ManualTimer cold_blocks_timer("cold blocks transfer");
+            cold_blocks_timer.start();
+            _apply_cold_block_transfers();
+            cold_blocks_timer.end();
+        }
+
+        static thread_local ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
         m_cache_manager->copy_blocks(block_copy_map);
         copy_blocks_timer.end();
@@ -150,8 +223,24 @@ public:
         m_block_manager->fork_sequence(parent_id, child_id);
     }
 
+    void fork_sequence(uint64_t parent_id, uint64_t child_id, size_t num_blocks) {
+        m_block_manager->fork_sequence(parent_id, child_id, num_blocks);
+    }
+
     void restore_cached_blocks(const SequenceGroup::Ptr& sequence_group) {
         m_block_manager->restore_cached_blocks(sequence_group);
+        if (m_cold_blocks) {
+            // blocks from cold tier are allocated on scheduling, as add_request can be called from other threads
+            std::lock_guard<std::mutex> lock(m_cold_restore_candidates_mutex);
+            m_cold_restore_candidates.push_back(sequence_group);
+        }
+    }
+
+    /**
+     * @return Number of blocks in quantized host tier of prefix cache, 0 if it is disabled
+     */
+    size_t get_num_cold_blocks() const {
+        return m_cold_blocks ? m_cold_blocks->num_blocks() : 0;
     }
 
     const SchedulerConfig& get_config() const {
@@ -162,6 +251,17 @@ public:
         m_block_manager->free_blocks_from_sequence(seq_id, per_layer_logical_block_indices_to_free);
     }
 
+    /**
+     * Feeds the adaptive prefill chunking with the inference duration of a step.
+     * @param num_scheduled_tokens Total number of tokens scheduled at the step.
+     * @param inference_duration_ms Duration of model inference of the step in milliseconds.
+     */
+    void register_step_latency(size_t num_scheduled_tokens, float inference_duration_ms) {
+        if (m_prefill_controller) {
+            m_prefill_controller->register_step(num_scheduled_tokens, inference_duration_ms);
+        }
+    }
+
 private:
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
@@ -227,7 +327,68 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
+    /**
+     * Stable sorts sequence groups by descending GenerationConfig::priority and then by ascending TTFT slack.
+     * Groups with equal priority and without TTFT targets keep their arrival order.
+     */
+    static void _sort_by_priority(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        std::vector<std::pair<size_t, float>> keys;
+        keys.reserve(sequence_groups.size());
+        bool is_ordered = true;
+        for (size_t i = 0; i < sequence_groups.size(); ++i) {
+            keys.emplace_back(sequence_groups[i]->get_priority(), sequence_groups[i]->get_ttft_slack_ms());
+            if (i > 0 && _has_higher_priority(keys[i], keys[i - 1])) {
+                is_ordered = false;
+            }
+        }
+        if (is_ordered) {
+            return;
+        }
+
+        std::vector<size_t> order(sequence_groups.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&keys] (size_t lhs, size_t rhs) {
+            return _has_higher_priority(keys[lhs], keys[rhs]);
+        });
+
+        std::vector<SequenceGroup::Ptr> sorted_groups;
+        sorted_groups.reserve(sequence_groups.size());
+        for (size_t idx : order) {
+            sorted_groups.push_back(sequence_groups[idx]);
+        }
+        sequence_groups = std::move(sorted_groups);
+    }
+
+    static bool _has_higher_priority(const std::pair<size_t, float>& lhs, const std::pair<size_t, float>& rhs) {
+        if (lhs.first != rhs.first) {
+            return lhs.first > rhs.first;
+        }
+        return lhs.second < rhs.second;
+    }
+
+    /**
+     * Preempts not yet scheduled groups with priority strictly lower than the one of `sequence_group_id` (starting from the
+     * lowest priority one) until `num_required_blocks` free blocks are available.
+     * Used during prompt admission, so a high priority prompt does not wait for low priority requests to finish.
+     */
+    void _preempt_lower_priority_groups(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t num_required_blocks) {
+        const size_t priority = sequence_groups[sequence_group_id]->get_priority();
+        for (size_t group_idx = sequence_groups.size() - 1; group_idx > sequence_group_id && num_required_blocks > m_block_manager->num_free_blocks(); --group_idx) {
+            SequenceGroup::Ptr victim = sequence_groups[group_idx];
+            if (victim->get_priority() >= priority) {
+                // groups are sorted by priority, so there are no more candidates
+                break;
+            }
+            if (victim->get_num_processed_tokens() == 0 || victim->is_scheduled() || victim->has_finished()) {
+                continue;
+            }
+            _preempt_by_recompute(victim, num_required_blocks - m_block_manager->num_free_blocks());
+        }
+    }
+
     static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // sequence groups are sorted by priority and TTFT slack (see _sort_by_priority), so the last group with
+        // allocated KV blocks is the one with the lowest priority
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
             SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
@@ -268,6 +429,14 @@ private:
         //    we can slice prompt on chunks and schedule only portion of each prompt instead of
         //    greedy scheduling of prompt with higher priority
         // 2. The mechanism below performs greedy scheduling of high priority prompts
+        // 3. With adaptive prefill chunking the total number of prompt tokens is additionally limited to hold target step latency
+
+        size_t max_num_prompt_tokens = m_config.max_num_batched_tokens;
+        if (m_prefill_controller) {
+            scheduler_output.m_prefill_token_budget = m_prefill_controller->get_prefill_token_budget(scheduler_output.m_total_num_scheduled_tokens);
+            max_num_prompt_tokens = scheduler_output.m_prefill_token_budget;
+        }
+        size_t num_scheduled_prompt_tokens = 0;
 
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
@@ -278,7 +447,8 @@ private:
                 Sequence::Ptr sequence = (*sequence_group)[0];
                 uint64_t seq_id = sequence->get_id();
 
-                size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+                size_t num_tokens_in_megabatch = std::min(m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens,
+                                                          max_num_prompt_tokens - num_scheduled_prompt_tokens);
                 size_t num_available_tokens = sequence_group->get_num_available_tokens_for_batching();
 
                 // apply megabatch limitations
@@ -297,6 +467,9 @@ private:
                         break;
                     }
                 }
+                if (num_required_blocks > m_block_manager->num_free_blocks()) {
+                    _preempt_lower_priority_groups(sequence_group_id, sequence_groups, num_required_blocks);
+                }
                 size_t num_scheduled_blocks = std::min(num_required_blocks, m_block_manager->num_free_blocks());
                 // some scheduled blocks can be no fully occupied, so we need to take min between num_scheduled_blocks
                 // and total "scheduled capacity"
@@ -314,7 +487,7 @@ private:
                         scheduler_output.m_scheduled_sequence_groups_ids.push_back(sequence_group_id);
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
-
+                        num_scheduled_prompt_tokens += num_scheduled_tokens * num_running_seqs;
 
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
                         scheduler_output.m_apply_sparse_attention_mask = m_config.use_sparse_attention && m_config.sparse_attention_config.mode == SparseAttentionMode::TRISHAPE;
@@ -332,7 +505,8 @@ private:
                 }
 
                 // if we added maximum amount of tokens to compute
-                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens ||
+                    num_scheduled_prompt_tokens == max_num_prompt_tokens)
                     break;
             }
         }
@@ -440,7 +614,7 @@ private:
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
                 // here we also assume that sequence must be scheduler in a single shot and has no already generated context
-                if (!m_config.enable_prefix_caching)
+                if (!m_config.enable_prefix_caching && !m_config.enable_prompt_deduplication)
                     OPENVINO_ASSERT(sequence_group->get_context_len() == 0);
                 size_t num_available_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t sequence_len = sequence_group->get_num_available_tokens_for_batching();
@@ -465,6 +639,9 @@ private:
                         break;
                     }
                 }
+                if (!m_block_manager->can_allocate_blocks(num_required_blocks)) {
+                    _preempt_lower_priority_groups(sequence_group_id, sequence_groups, num_required_blocks);
+                }
                 if (!m_block_manager->can_allocate_blocks(num_required_blocks))
                     break;
 
@@ -556,10 +733,80 @@ private:
             }
             blocks_sum += blocks_num;
         }
+        if (m_cache_manager->get_device().find("GPU") == std::string::npos) {
+            // address space for the largest cache fitting into currently available host memory is reserved,
+            // so the cache grows in place instead of copying all blocks on each growth
+            size_t max_num_kv_blocks = get_available_host_memory() / m_num_host_memory_shares / m_cache_manager->get_block_size_in_bytes();
+            if (max_num_kv_blocks > blocks_sum) {
+                m_cache_manager->reserve_cache(max_num_kv_blocks);
+            }
+        }
         m_block_manager->increase_kv_blocks_number(blocks_sum);
         m_dynamic_memory_allocation = true;
     }
 
+    void _register_overwritten_cold_blocks() {
+        for (const auto& [hash, block_id] : m_block_manager->pull_overwritten_blocks()) {
+            m_cold_block_transfers.push_back({m_cold_blocks->add(hash), block_id, true});
+        }
+    }
+
+    /**
+     * Continues prompt prefixes restored from prefix cache by blocks from cold tier for requests added since the last call.
+     * Only full blocks are restored, and at least one prompt token is left to be computed.
+     */
+    void _restore_cold_blocks() {
+        std::vector<std::weak_ptr<SequenceGroup>> candidates;
+        {
+            std::lock_guard<std::mutex> lock(m_cold_restore_candidates_mutex);
+            candidates.swap(m_cold_restore_candidates);
+        }
+        const size_t block_size = m_block_manager->get_block_size();
+        for (const auto& candidate : candidates) {
+            SequenceGroup::Ptr sequence_group = candidate.lock();
+            if (!sequence_group || sequence_group->has_finished() || sequence_group->get_num_scheduled_tokens() > 0) {
+                continue;
+            }
+            auto sequences = sequence_group->get_not_finished_sequences();
+            if (sequences.size() != 1 || !m_block_manager->has_block_table(sequences[0]->get_id())) {
+                continue;
+            }
+            Sequence::Ptr sequence = sequences[0];
+            const size_t prompt_len = sequence_group->get_prompt_len();
+            size_t num_blocks = m_block_manager->get_block_tables(sequence->get_id())[0].size();
+            // restored prefix ending with a partially filled block cannot be continued
+            if (sequence_group->get_num_processed_tokens() != num_blocks * block_size) {
+                continue;
+            }
+            while ((num_blocks + 1) * block_size <= prompt_len && m_block_manager->can_allocate_blocks(1)) {
+                const size_t content_len = (num_blocks + 1) * block_size;
+                ColdBlocksStore::BlockPtr block = m_cold_blocks->take(sequence->get_hash(content_len));
+                if (!block) {
+                    break;
+                }
+                m_block_manager->allocate(sequence, 1, prompt_len);
+                // the allocated block can be a cached one, which has to be saved before it is overwritten
+                _register_overwritten_cold_blocks();
+                size_t block_id = m_block_manager->get_block_tables(sequence->get_id())[0].back()->get_index();
+                m_cold_block_transfers.push_back({block, block_id, false});
+                sequence_group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
+                ++num_blocks;
+            }
+        }
+    }
+
+    void _apply_cold_block_transfers() {
+        _register_overwritten_cold_blocks();
+        for (const auto& transfer : m_cold_block_transfers) {
+            if (transfer.is_store) {
+                m_cold_blocks->store_block(*transfer.block, *m_cache_manager, transfer.block_id);
+            } else {
+                m_cold_blocks->load_block(*transfer.block, *m_cache_manager, transfer.block_id);
+            }
+        }
+        m_cold_block_transfers.clear();
+    }
+
     bool _try_increase_cache() {
         if (!m_dynamic_memory_allocation) {
             return false;
@@ -569,6 +816,11 @@ private:
         size_t new_blocks_num = current_num_of_kv_blocks * m_cache_growth_factor;
 
         if (device.find("GPU") == std::string::npos) {
+            const size_t num_reserved_kv_blocks = m_cache_manager->get_num_reserved_kv_blocks();
+            if (current_num_of_kv_blocks < num_reserved_kv_blocks) {
+                // the reserved memory is filled up first, as it grows in place, while growing beyond it copies all blocks
+                new_blocks_num = std::min(new_blocks_num, num_reserved_kv_blocks);
+            }
             m_block_manager->increase_kv_blocks_number(new_blocks_num);
         } else {
             const size_t available_gpu_memory = _get_available_gpu_memory();
@@ -0,0 +1,22 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "data_parallel/continuous_batching_replica.hpp"
+
+namespace ov::genai {
+
+ContinuousBatchingPipeline::ContinuousBatchingReplicaImpl::ContinuousBatchingReplicaImpl(
+    const ContinuousBatchingReplicaImpl& first_replica,
+    const SchedulerConfig& scheduler_config,
+    size_t sampler_num_threads,
+    const HostPlacementConfig& host_placement_config) {
+    m_tokenizer = first_replica.m_tokenizer;
+    m_generation_config = first_replica.m_generation_config;
+    m_device = first_replica.m_device;
+    m_is_validation_mode_enabled = first_replica.m_is_validation_mode_enabled;
+    m_host_placement_config = host_placement_config;
+
+    initialize_pipeline(first_replica.m_model_runner->get_infer_request().get_compiled_model(), scheduler_config, sampler_num_threads);
+}
+
+}
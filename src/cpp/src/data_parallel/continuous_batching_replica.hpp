@@ -0,0 +1,44 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+#include "continuous_batching/pipeline_impl.hpp"
+
+namespace ov::genai {
+/**
+ * Single replica of data parallel continuous batching pipeline. The first replica compiles the model,
+ * the others share its compiled model and own only their infer requests, KV caches, schedulers and samplers.
+ */
+class ContinuousBatchingPipeline::ContinuousBatchingReplicaImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
+public:
+    ContinuousBatchingReplicaImpl(const std::shared_ptr<ov::Model>& model,
+                                  const Tokenizer& tokenizer,
+                                  const SchedulerConfig& scheduler_config,
+                                  const std::string& device,
+                                  const ov::AnyMap& properties,
+                                  const ov::genai::GenerationConfig& generation_config) :
+    ContinuousBatchingImpl{ model,
+                            tokenizer,
+                            scheduler_config,
+                            device,
+                            properties,
+                            generation_config } {};
+
+    /**
+     * @param host_placement_config placement of KV cache and sampler threads of this replica, which may differ from the first one
+     */
+    ContinuousBatchingReplicaImpl(const ContinuousBatchingReplicaImpl& first_replica,
+                                  const SchedulerConfig& scheduler_config,
+                                  size_t sampler_num_threads,
+                                  const HostPlacementConfig& host_placement_config);
+
+    size_t get_block_size() const {
+        return m_block_size;
+    }
+
+    using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
+};
+}
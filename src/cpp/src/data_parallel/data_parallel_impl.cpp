@@ -0,0 +1,304 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <thread>
+
+#include <openvino/runtime/properties.hpp>
+
+#include "data_parallel/data_parallel_impl.hpp"
+#include "continuous_batching/timer.hpp"
+#include "openvino/genai/text_streamer.hpp"
+
+namespace {
+
+void merge_latency_histograms(std::map<size_t, ov::genai::LatencyHistogram>& merged_histograms,
+                              const std::map<size_t, ov::genai::LatencyHistogram>& histograms) {
+    for (const auto& [priority, histogram] : histograms) {
+        auto& merged = merged_histograms[priority];
+        for (size_t bucket_idx = 0; bucket_idx < merged.bucket_counts.size(); ++bucket_idx) {
+            merged.bucket_counts[bucket_idx] += histogram.bucket_counts[bucket_idx];
+        }
+        merged.num_samples += histogram.num_samples;
+        merged.sum_ms += histogram.sum_ms;
+        merged.max_ms = std::max(merged.max_ms, histogram.max_ms);
+    }
+}
+
+} // namespace
+
+namespace ov::genai {
+
+ContinuousBatchingPipeline::DataParallelImpl::DataParallelImpl(const std::shared_ptr<ov::Model>& model,
+                                                               const Tokenizer& tokenizer,
+                                                               const SchedulerConfig& scheduler_config,
+                                                               const std::string& device,
+                                                               const ov::AnyMap& properties,
+                                                               const ov::genai::GenerationConfig& generation_config,
+                                                               size_t num_replicas) {
+    OPENVINO_ASSERT(num_replicas > 0, "Number of data parallel replicas must be positive");
+    OPENVINO_ASSERT(properties.find(AdaptersProperty::name()) == properties.end(),
+        "LoRA adapters are not supported by data parallel continuous batching pipeline");
+    m_tokenizer = tokenizer;
+
+    ov::AnyMap replica_properties = properties;
+    // a stream per replica lets the plugin run inferences of replicas concurrently, CPU plugin also spreads streams over NUMA nodes
+    if (replica_properties.find(ov::num_streams.name()) == replica_properties.end()) {
+        replica_properties[ov::num_streams.name()] = ov::streams::Num(static_cast<int>(num_replicas));
+    }
+    // samplers of replicas work concurrently, so hardware threads are split between them
+    size_t sampler_num_threads = std::max<size_t>(1, std::thread::hardware_concurrency() / num_replicas);
+    auto sampler_num_threads_it = replica_properties.find("sampler_num_threads");
+    if (sampler_num_threads_it != replica_properties.end()) {
+        sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
+    } else {
+        replica_properties["sampler_num_threads"] = sampler_num_threads;
+    }
+
+    // dynamically allocated KV caches of replicas on CPU grow within their shares of host memory
+    replica_properties["kv_cache_memory_shares"] = num_replicas;
+
+    // replicas share the tokenizer, its structured output controller is created by the first replica for vocab size
+    // of the model and is reused by the others, so samplers of replicas see the same controller and compiled grammars
+    m_replicas.push_back(std::make_shared<ContinuousBatchingReplicaImpl>(model, tokenizer, scheduler_config, device,
+                                                                         select_replica_host_placement(replica_properties, 0), generation_config));
+    for (size_t replica_idx = 1; replica_idx < num_replicas; ++replica_idx) {
+        // KV cache and sampler threads of each replica may be placed on own NUMA node
+        ov::AnyMap placement_properties = select_replica_host_placement(replica_properties, replica_idx);
+        m_replicas.push_back(std::make_shared<ContinuousBatchingReplicaImpl>(*m_replicas.front(),
+                                                                             scheduler_config,
+                                                                             sampler_num_threads,
+                                                                             extract_host_placement_config(placement_properties)));
+    }
+    m_generation_config = m_replicas.front()->get_config();
+    m_device = device;
+
+    m_router.emplace(num_replicas, m_replicas.front()->get_block_size());
+    m_replica_loads.resize(num_replicas);
+    m_thread_pool = std::make_unique<ThreadPool>(num_replicas);
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::DataParallelImpl::add_request(uint64_t request_id,
+                                                          const ov::Tensor& input_ids,
+                                                          ov::genai::GenerationConfig sampling_params,
+                                                          std::optional<ov::Tensor> token_type_ids) {
+    // replicas fill missing values from their own copies of the default config, which are not affected by set_config
+    if (sampling_params.stop_token_ids.empty())
+        sampling_params.stop_token_ids = m_generation_config.stop_token_ids;
+    if (sampling_params.eos_token_id == -1)
+        sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
+
+    const int64_t* prompt_data = input_ids.data<const int64_t>();
+    const std::vector<int64_t> prompt_ids(prompt_data, prompt_data + input_ids.get_size());
+
+    size_t replica_idx = 0;
+    {
+        std::lock_guard<std::mutex> lock{m_router_mutex};
+        replica_idx = m_router->route(prompt_ids, m_replica_loads);
+        m_replica_loads[replica_idx].num_requests += 1;
+    }
+    return m_replicas[replica_idx]->add_request(request_id, input_ids, sampling_params, token_type_ids);
+}
+
+GenerationHandle
+ContinuousBatchingPipeline::DataParallelImpl::add_request(uint64_t request_id,
+                                                          const std::string& prompt,
+                                                          ov::genai::GenerationConfig sampling_params) {
+    // prompt has to be tokenized before routing to match its prefix with prefixes sent to replicas
+    static ManualTimer timer("tokenize");
+    timer.start();
+    ov::Tensor input_ids = m_tokenizer.encode(prompt).input_ids;
+    timer.end();
+    return add_request(request_id, input_ids, sampling_params);
+}
+
+bool ContinuousBatchingPipeline::DataParallelImpl::has_non_finished_requests() {
+    return std::any_of(m_replicas.begin(), m_replicas.end(), [] (const auto& replica) {
+        return replica->has_non_finished_requests();
+    });
+}
+
+void ContinuousBatchingPipeline::DataParallelImpl::step() {
+    std::vector<bool> stepped_replicas(m_replicas.size(), false);
+    std::vector<std::future<void>> replica_steps;
+    for (size_t replica_idx = 0; replica_idx < m_replicas.size(); ++replica_idx) {
+        if (m_replicas[replica_idx]->has_non_finished_requests()) {
+            stepped_replicas[replica_idx] = true;
+            replica_steps.push_back(m_thread_pool->submit([replica = m_replicas[replica_idx]] { replica->step(); }));
+        }
+    }
+
+    // all replicas have to finish their steps before an exception is rethrown
+    std::exception_ptr step_exception = nullptr;
+    for (auto& replica_step : replica_steps) {
+        try {
+            replica_step.get();
+        } catch (...) {
+            if (!step_exception) {
+                step_exception = std::current_exception();
+            }
+        }
+    }
+
+    _update_metrics(stepped_replicas);
+
+    if (step_exception) {
+        std::rethrow_exception(step_exception);
+    }
+}
+
+void ContinuousBatchingPipeline::DataParallelImpl::_update_metrics(const std::vector<bool>& stepped_replicas) {
+    PipelineMetrics pipeline_metrics;
+    std::vector<ReplicaLoad> replica_loads(m_replicas.size());
+    const float num_replicas = static_cast<float>(m_replicas.size());
+    for (size_t replica_idx = 0; replica_idx < m_replicas.size(); ++replica_idx) {
+        const PipelineMetrics replica_metrics = m_replicas[replica_idx]->get_metrics();
+        // cache is occupied by prefix cache of idle replicas as well
+        pipeline_metrics.cache_usage += replica_metrics.cache_usage / num_replicas;
+        pipeline_metrics.max_cache_usage = std::max(pipeline_metrics.max_cache_usage, replica_metrics.max_cache_usage);
+        pipeline_metrics.avg_cache_usage += replica_metrics.avg_cache_usage / num_replicas;
+        merge_latency_histograms(pipeline_metrics.ttft_per_priority, replica_metrics.ttft_per_priority);
+        merge_latency_histograms(pipeline_metrics.e2e_latency_per_priority, replica_metrics.e2e_latency_per_priority);
+
+        replica_loads[replica_idx].cache_usage = replica_metrics.cache_usage;
+        if (!stepped_replicas[replica_idx]) {
+            // per step values of idle replicas are left from their last steps
+            continue;
+        }
+        replica_loads[replica_idx].num_requests = replica_metrics.requests;
+
+        pipeline_metrics.requests += replica_metrics.requests;
+        pipeline_metrics.scheduled_requests += replica_metrics.scheduled_requests;
+        pipeline_metrics.prefill_token_budget += replica_metrics.prefill_token_budget;
+        // replicas are stepped concurrently, so the step lasts as long as the slowest replica step
+        pipeline_metrics.inference_duration = std::max(pipeline_metrics.inference_duration, replica_metrics.inference_duration);
+        pipeline_metrics.step_duration = std::max(pipeline_metrics.step_duration, replica_metrics.step_duration);
+        pipeline_metrics.overlapped_host_duration = std::max(pipeline_metrics.overlapped_host_duration, replica_metrics.overlapped_host_duration);
+        pipeline_metrics.cache_eviction_duration = std::max(pipeline_metrics.cache_eviction_duration, replica_metrics.cache_eviction_duration);
+    }
+    m_pipeline_metrics = std::move(pipeline_metrics);
+
+    std::lock_guard<std::mutex> lock{m_router_mutex};
+    for (size_t replica_idx = 0; replica_idx < m_replicas.size(); ++replica_idx) {
+        m_replica_loads[replica_idx].cache_usage = replica_loads[replica_idx].cache_usage;
+        if (stepped_replicas[replica_idx]) {
+            m_replica_loads[replica_idx].num_requests = replica_loads[replica_idx].num_requests;
+        }
+    }
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::DataParallelImpl::generate(const std::vector<ov::Tensor>& input_ids,
+                                                       const std::vector<GenerationConfig>& sampling_params,
+                                                       const StreamerVariant& streamer,
+                                                       std::optional<std::vector<ov::Tensor>> token_type_ids) {
+    OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
+    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+
+    auto start_time = std::chrono::steady_clock::now();
+    PerfMetrics perf_metrics;
+    auto& raw_perf_counters = perf_metrics.raw_metrics;
+    raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
+
+    const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
+
+    OPENVINO_ASSERT(!streamer_ptr->has_callback() || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
+        (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
+        "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
+
+    std::vector<GenerationHandle> generations;
+    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
+        OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
+        bool has_valid_token = token_type_ids.has_value() && request_id < token_type_ids->size();
+        generations.push_back(
+            add_request(request_id, input_ids[request_id], sampling_params[request_id], has_valid_token ? std::make_optional((*token_type_ids)[request_id]) : std::nullopt)
+        );
+    }
+
+    // we need to store all requests to get results from them once generation has finished
+    std::vector<SequenceGroup::Ptr> all_requests(input_ids.size());
+    for (const auto& replica : m_replicas) {
+        for (const auto& request : replica->get_awaiting_requests()) {
+            all_requests.at(request->get_request_id()) = request;
+        }
+    }
+
+    GenerationHandle& generation = generations.at(0);
+
+    streamer_ptr->start();
+    while (has_non_finished_requests()) {
+        try {
+            const auto infer_start = std::chrono::steady_clock::now();
+            step();
+
+            raw_perf_counters.m_inference_durations[0] += MicroSeconds(m_pipeline_metrics.inference_duration);
+            if (m_pipeline_metrics.scheduled_requests > 0) {
+                const auto infer_end = std::chrono::steady_clock::now();
+                const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+                raw_perf_counters.m_token_infer_durations.emplace_back(infer_ms);
+                raw_perf_counters.m_new_token_times.emplace_back(infer_end);
+                raw_perf_counters.m_batch_sizes.emplace_back(m_pipeline_metrics.scheduled_requests);
+            }
+        } catch (...) {
+            drop_requests(); // remove all requests from pipeline state in case of exception
+            streamer_ptr->end();
+            std::rethrow_exception(std::current_exception());
+        }
+        stream_tokens(streamer_ptr, generation);
+    }
+
+    // waiting for competion of streaming
+    streamer_ptr->end();
+
+    std::vector<EncodedGenerationResult> results;
+    results.reserve(all_requests.size());
+
+    for (size_t request_id = 0; request_id < all_requests.size(); ++request_id) {
+        const auto& request = all_requests[request_id];
+        auto sampling_params = request->get_sampling_parameters();
+        const auto& sequences = request->get_finished_sequences();
+        size_t num_outputs = std::min(sampling_params.num_return_sequences, sequences.size());
+
+        EncodedGenerationResult result;
+        result.m_request_id = request_id;
+        result.m_generation_ids.resize(num_outputs);
+        result.m_scores.resize(num_outputs);
+
+        for (size_t i = 0; i < num_outputs; ++i) {
+            const auto & sequence = sequences[i];
+            const float score = sampling_params.is_beam_search() ? sequence->get_beam_search_score(sampling_params) : sequence->get_cumulative_log_prob();
+            const auto & generated_ids = sequence->get_generated_ids();
+
+            if (sampling_params.echo)
+                result.m_generation_ids[i] = request->get_prompt_ids();
+            std::copy(generated_ids.begin(), generated_ids.end(), std::back_inserter(result.m_generation_ids[i]));
+            result.m_scores[i] = score;
+        }
+
+        result.m_status = generations[request_id]->get_status();
+
+        // The same perf metrics for each sequence, only tokenization/detokenization will differ.
+        perf_metrics.raw_metrics.generate_durations.clear();
+        perf_metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time));
+        perf_metrics.num_input_tokens = request->get_prompt_len();
+        perf_metrics.evaluate_statistics(start_time);
+
+        result.perf_metrics = perf_metrics;
+        results.push_back(std::move(result));
+    }
+
+    OPENVINO_ASSERT(results.size() == input_ids.size());
+    return results;
+}
+
+void ContinuousBatchingPipeline::DataParallelImpl::drop_requests() {
+    for (const auto& replica : m_replicas) {
+        replica->drop_requests();
+    }
+    std::lock_guard<std::mutex> lock{m_router_mutex};
+    for (auto& load : m_replica_loads) {
+        load.num_requests = 0;
+    }
+}
+
+}
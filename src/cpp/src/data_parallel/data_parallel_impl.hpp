@@ -0,0 +1,67 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "data_parallel/continuous_batching_replica.hpp"
+#include "data_parallel/request_router.hpp"
+#include "sampling/threadpool.hpp"
+
+namespace ov::genai {
+
+/**
+ * Data parallel continuous batching pipeline: several pipeline replicas sharing one compiled model are served behind
+ * a single add_request / step API. Each request is processed by a single replica selected by RequestRouter,
+ * replicas with requests are stepped concurrently.
+ */
+class ContinuousBatchingPipeline::DataParallelImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
+protected:
+    std::vector<std::shared_ptr<ContinuousBatchingReplicaImpl>> m_replicas;
+
+    std::optional<RequestRouter> m_router;
+    // loads of replicas observed by the router, updated by add_request and after each step
+    std::vector<ReplicaLoad> m_replica_loads;
+    // Mutex protecting access to m_router and m_replica_loads, so add_request and step methods can be called from different threads
+    std::mutex m_router_mutex;
+
+    // steps replicas concurrently, one thread per replica
+    std::unique_ptr<ThreadPool> m_thread_pool;
+
+    /**
+     * Aggregates metrics of replicas into pipeline metrics and updates replica loads seen by the router
+     * @param stepped_replicas flags of replicas which performed the last step
+     */
+    void _update_metrics(const std::vector<bool>& stepped_replicas);
+
+    void drop_requests();
+
+public:
+    DataParallelImpl(const std::shared_ptr<ov::Model>& model,
+                     const Tokenizer& tokenizer,
+                     const SchedulerConfig& scheduler_config,
+                     const std::string& device,
+                     const ov::AnyMap& properties,
+                     const ov::genai::GenerationConfig& generation_config,
+                     size_t num_replicas);
+
+    GenerationHandle add_request(uint64_t request_id,
+                                 const ov::Tensor& input_ids,
+                                 ov::genai::GenerationConfig sampling_params,
+                                 std::optional<ov::Tensor> token_type_ids = std::nullopt) override;
+    GenerationHandle add_request(uint64_t request_id,
+                                 const std::string& prompt,
+                                 ov::genai::GenerationConfig sampling_params) override;
+
+    bool has_non_finished_requests() override;
+
+    void step() override;
+
+    std::vector<EncodedGenerationResult>
+    generate(const std::vector<ov::Tensor>& input_ids,
+             const std::vector<GenerationConfig>& sampling_params,
+             const StreamerVariant& streamer,
+             std::optional<std::vector<ov::Tensor>> token_type_ids = std::nullopt) override;
+};
+
+}
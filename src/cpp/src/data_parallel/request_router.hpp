@@ -0,0 +1,132 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Load of a single pipeline replica as seen by RequestRouter.
+ */
+struct ReplicaLoad {
+    // KV cache usage in % at the last step of the replica
+    float cache_usage = 0.0f;
+    // number of requests processed by the replica, including requests which have not been pulled by step() yet
+    size_t num_requests = 0;
+};
+
+/**
+ * @brief Selects a replica of data parallel continuous batching pipeline for a new request.
+ *
+ * Requests are sent to the replica which has recently received the longest prompt prefix of the request (in full KV cache blocks),
+ * so prefix caching and prompt deduplication of that replica can reuse the KV cache. Affinity is ignored if the replica is noticeably
+ * more loaded than the least loaded one, in this case the request goes to the least loaded replica. Load combines KV cache usage
+ * with replica's share of the requests, because cache usage is updated only at steps and does not reflect just added requests.
+ */
+class RequestRouter {
+public:
+    /**
+     * Constructs the RequestRouter.
+     * @param num_replicas Number of pipeline replicas.
+     * @param block_size Number of tokens in a KV cache block, prompt prefixes are tracked with this granularity.
+     * @param max_tracked_blocks Max number of prompt prefix blocks remembered for affinity, the oldest ones are forgotten first.
+     * @param max_affinity_load_imbalance Max difference of load between the affine and the least loaded replicas, when affinity is still respected.
+     */
+    RequestRouter(size_t num_replicas, size_t block_size, size_t max_tracked_blocks = 65536, float max_affinity_load_imbalance = 0.25f)
+        : m_num_replicas(num_replicas),
+          m_block_size(block_size),
+          m_max_tracked_blocks(max_tracked_blocks),
+          m_max_affinity_load_imbalance(max_affinity_load_imbalance) {
+        OPENVINO_ASSERT(num_replicas > 0, "Number of replicas must be positive");
+        OPENVINO_ASSERT(block_size > 0, "Block size must be positive");
+    }
+
+    /**
+     * Selects a replica for a request and remembers its prompt prefix blocks as cached by the selected replica.
+     * @param prompt_ids Prompt token ids of the request.
+     * @param loads Current loads of the replicas.
+     * @return Index of the selected replica.
+     */
+    size_t route(const std::vector<int64_t>& prompt_ids, const std::vector<ReplicaLoad>& loads) {
+        OPENVINO_ASSERT(loads.size() == m_num_replicas, "Expected loads of ", m_num_replicas, " replicas, got ", loads.size());
+
+        size_t total_num_requests = 0;
+        for (const auto& load : loads) {
+            total_num_requests += load.num_requests;
+        }
+        auto get_load_score = [&](size_t replica_idx) {
+            return loads[replica_idx].cache_usage / 100.0f + static_cast<float>(loads[replica_idx].num_requests) / (total_num_requests + 1);
+        };
+
+        size_t least_loaded_replica = 0;
+        for (size_t replica_idx = 1; replica_idx < m_num_replicas; ++replica_idx) {
+            if (get_load_score(replica_idx) < get_load_score(least_loaded_replica)) {
+                least_loaded_replica = replica_idx;
+            }
+        }
+
+        const std::vector<size_t> prefix_hashes = _get_prefix_hashes(prompt_ids);
+        size_t selected_replica = least_loaded_replica;
+        // the replica which received the longest matching prefix, prefix blocks are matched until the first miss
+        for (size_t hash : prefix_hashes) {
+            auto it = m_prefix_owners.find(hash);
+            if (it == m_prefix_owners.end()) {
+                break;
+            }
+            selected_replica = it->second;
+        }
+        if (get_load_score(selected_replica) > get_load_score(least_loaded_replica) + m_max_affinity_load_imbalance) {
+            selected_replica = least_loaded_replica;
+        }
+
+        for (size_t hash : prefix_hashes) {
+            auto [it, inserted] = m_prefix_owners.insert_or_assign(hash, selected_replica);
+            if (inserted) {
+                m_insertion_order.push_back(hash);
+            }
+        }
+        while (m_insertion_order.size() > m_max_tracked_blocks) {
+            m_prefix_owners.erase(m_insertion_order.front());
+            m_insertion_order.pop_front();
+        }
+        return selected_replica;
+    }
+
+    size_t get_num_tracked_blocks() const {
+        return m_prefix_owners.size();
+    }
+
+private:
+    // hashes of all prompt prefixes consisting of full blocks, the hash of the i-th prefix covers blocks [0, i]
+    std::vector<size_t> _get_prefix_hashes(const std::vector<int64_t>& prompt_ids) const {
+        const size_t num_full_blocks = prompt_ids.size() / m_block_size;
+        std::vector<size_t> prefix_hashes(num_full_blocks);
+        size_t hash = 0;
+        for (size_t block_idx = 0; block_idx < num_full_blocks; ++block_idx) {
+            for (size_t token_idx = block_idx * m_block_size; token_idx < (block_idx + 1) * m_block_size; ++token_idx) {
+                hash ^= std::hash<int64_t>{}(prompt_ids[token_idx]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            }
+            prefix_hashes[block_idx] = hash;
+        }
+        return prefix_hashes;
+    }
+
+    size_t m_num_replicas;
+    size_t m_block_size;
+    size_t m_max_tracked_blocks;
+    float m_max_affinity_load_imbalance;
+
+    // prompt prefix hash -> replica which has most recently received the prefix
+    std::unordered_map<size_t, size_t> m_prefix_owners;
+    std::deque<size_t> m_insertion_order;
+};
+
+}  // namespace ov::genai
@@ -91,6 +91,7 @@ GenerationConfig::GenerationConfig(const std::filesystem::path& json_path) {
     read_json_param(data, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_json_param(data, "num_assistant_tokens", num_assistant_tokens);
     read_json_param(data, "max_ngram_size", max_ngram_size);
+    read_json_param(data, "adaptive_num_assistant_tokens", adaptive_num_assistant_tokens);
 
     // append EOS to stop_token_ids
     if (eos_token_id != -1)
@@ -150,9 +151,14 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_anymap_param(properties, "num_assistant_tokens", num_assistant_tokens);
     read_anymap_param(properties, "max_ngram_size", max_ngram_size);
+    read_anymap_param(properties, "adaptive_num_assistant_tokens", adaptive_num_assistant_tokens);
 
     // Structured output
     read_anymap_param(properties, "structured_output_config", structured_output_config);
+
+    // continuous batching scheduling
+    read_anymap_param(properties, "priority", priority);
+    read_anymap_param(properties, "ttft_target_ms", ttft_target_ms);
 }
 
 
@@ -344,6 +350,7 @@ void GenerationConfig::validate() const {
 
     if (num_assistant_tokens == 0) {
         OPENVINO_ASSERT(max_ngram_size == 0, "'max_ngram_size' should be set to default value 0 when prompt lookup is disabled");
+        OPENVINO_ASSERT(!adaptive_num_assistant_tokens, "'adaptive_num_assistant_tokens' requires 'num_assistant_tokens' to be set as an upper bound of candidates number");
     }
 
     if(is_structured_output_generation()) {
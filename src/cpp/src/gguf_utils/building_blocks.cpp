@@ -259,7 +259,7 @@ std::pair<Output<ov::Node>, Output<ov::Node>> rope_emb(
 ov::Output<ov::Node> make_rms_norm_qwen3(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& weights,
+    const GGUFTensorMap& weights,
     float rms_norm_eps) {
     auto eps_node = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{1,1,1,1}, rms_norm_eps);
     auto square = std::make_shared<ov::op::v1::Power>(
@@ -322,7 +322,7 @@ std::shared_ptr<v1::Transpose> split_heads(const Output<Node>& x,
                                             int  head_dim,
                                             float rms_norm_eps,
                                             const std::string& key,
-                                            const std::unordered_map<std::string, ov::Tensor>& weights) {
+                                            const GGUFTensorMap& weights) {
     auto shape = std::make_shared<v0::Constant>(element::i64, Shape{4}, std::vector<int64_t>{0, 0, num_h, head_dim});
     auto reshaped = std::make_shared<v1::Reshape>(x, shape, true);
     if (weights.count(key + ".weight")) { //Qwen3 rms_norm
@@ -342,7 +342,7 @@ multi_head_attention(
     const Output<Node>& key,
     const Output<Node>& value,
     const std::string& key_name,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     const std::map<std::string, GGUFMetaData>& configs,
     const Output<Node>& batch_dim,
     int layer_idx,
@@ -526,13 +526,12 @@ ov::Tensor reorder_interleaved_format(const ov::Tensor& weights, int head_size)
 
 ov::Output<ov::Node> make_fp16_weights(
     const std::string& key,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     bool reorder,
     int head_size) {
 
-    auto it = consts.find(key + ".weight");
-    OPENVINO_ASSERT(it != consts.end(), "Weight not found: ", key);
-    ov::Tensor weight_f16 = it->second;    
+    OPENVINO_ASSERT(consts.count(key + ".weight"), "Weight not found: ", key);
+    ov::Tensor weight_f16 = consts.at(key + ".weight");
 
     // Apply reordering
     if (reorder) {
@@ -546,16 +545,15 @@ ov::Output<ov::Node> make_fp16_weights(
 }
 
 // Retrieve tensors
-ov::Tensor get_tensor(const std::unordered_map<std::string, ov::Tensor>& consts,
+ov::Tensor get_tensor(const GGUFTensorMap& consts,
                     const std::string& key) {
-    auto it = consts.find(key);
-    OPENVINO_ASSERT(it != consts.end(), "Missing tensor: ", key);
-    return it->second;
+    OPENVINO_ASSERT(consts.count(key), "Missing tensor: ", key);
+    return consts.at(key);
 };
 
 ov::Output<ov::Node> make_int8_weights(
     const std::string& key,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     bool reorder,
     int head_size,
     size_t group_size = GGML_QUANTIZATION_GROUP_SIZE) {
@@ -622,7 +620,7 @@ ov::Output<ov::Node> make_int8_weights(
 
 ov::Output<ov::Node> make_int4_weights(
     const std::string& key,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     bool reorder,
     int head_size,
     size_t group_size = 32) { // Assuming GGML_QUANTIZATION_GROUP_SIZE = 32
@@ -695,7 +693,7 @@ ov::Output<ov::Node> make_int4_weights(
 }
 
 ov::Output<ov::Node> make_weights_subgraph(const std::string& key,
-                                           const std::unordered_map<std::string, ov::Tensor>& consts,
+                                           const GGUFTensorMap& consts,
                                            gguf_tensor_type qtype,
                                            bool reorder,
                                            int head_size) {
@@ -712,6 +710,13 @@ ov::Output<ov::Node> make_weights_subgraph(const std::string& key,
         return make_int4_weights(key, consts, reorder, head_size);
     case gguf_tensor_type::GGUF_TYPE_Q6_K:
         return make_int8_weights(key, consts, reorder, head_size, 16);
+    case gguf_tensor_type::GGUF_TYPE_Q5_0:
+    case gguf_tensor_type::GGUF_TYPE_Q5_1:
+    case gguf_tensor_type::GGUF_TYPE_Q5_K:
+    // Q2_K and Q3_K are re-quantized to 8 bits on load
+    case gguf_tensor_type::GGUF_TYPE_Q2_K:
+    case gguf_tensor_type::GGUF_TYPE_Q3_K:
+        return make_int8_weights(key, consts, reorder, head_size);
     default:
         OPENVINO_THROW("Unsupported quantization type");
     }
@@ -720,7 +725,7 @@ ov::Output<ov::Node> make_weights_subgraph(const std::string& key,
 ov::Output<ov::Node> make_fc(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     gguf_tensor_type qtype,
     bool reorder = false,
     int head_size = -1) {
@@ -741,7 +746,7 @@ ov::Output<ov::Node> make_fc(
 ov::Output<ov::Node> make_lm_head(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     const ov::Output<ov::Node>& embeddings_node,
     gguf_tensor_type qtype) {
 
@@ -762,7 +767,7 @@ ov::Output<ov::Node> make_lm_head(
 ov::Output<ov::Node> make_rms_norm(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     float epsilon) {
 
     auto eps_node = std::make_shared<ov::op::v0::Constant>(
@@ -830,7 +835,7 @@ ov::Output<ov::Node> make_rms_norm(
 std::tuple<ov::Output<ov::Node>, ov::Output<ov::Node>> make_embedding(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     gguf_tensor_type qtype) {
         
     auto embedding_type = qtype;
@@ -858,7 +863,7 @@ std::tuple<ov::Output<ov::Node>,
            std::pair<ov::Output<ov::Node>, ov::Output<ov::Node>>,
            std::shared_ptr<ov::Node>> 
     layer(const std::map<std::string, GGUFMetaData>& configs,
-        std::unordered_map<std::string, ov::Tensor>& consts,
+        GGUFTensorMap& consts,
         std::unordered_map<std::string, gguf_tensor_type>& qtypes,
         int layer_idx,
         const ov::Output<ov::Node>& hidden_states,
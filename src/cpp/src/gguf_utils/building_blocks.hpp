@@ -16,20 +16,20 @@
 ov::Output<ov::Node> make_lm_head(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     const ov::Output<ov::Node>& embeddings_node,
     gguf_tensor_type qtype);
 
 ov::Output<ov::Node> make_rms_norm(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     float epsilon);
 
 std::tuple<ov::Output<ov::Node>, ov::Output<ov::Node>> make_embedding(
     const std::string& key,
     const ov::Output<ov::Node>& input,
-    const std::unordered_map<std::string, ov::Tensor>& consts,
+    const GGUFTensorMap& consts,
     gguf_tensor_type qtype);
 
 std::tuple<ov::Output<ov::Node>, 
@@ -38,7 +38,7 @@ std::tuple<ov::Output<ov::Node>,
            std::pair<ov::Output<ov::Node>, ov::Output<ov::Node>>,
            std::shared_ptr<ov::Node>> 
     layer(const std::map<std::string, GGUFMetaData>& configs,
-        std::unordered_map<std::string, ov::Tensor>& consts,
+        GGUFTensorMap& consts,
         std::unordered_map<std::string, gguf_tensor_type>& qtypes,
         int layer_idx,
         const ov::Output<ov::Node>& hidden_states,
@@ -3,12 +3,21 @@
 
 #include "gguf_utils/gguf.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <numeric>
 #include <optional>
+#include <string_view>
+#include <openvino/core/parallel.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 // https://github.com/antirez/gguf-tools/blob/af7d88d808a7608a33723fba067036202910acb3/gguflib.h#L102-L108
 constexpr int gguf_array_header_size = 12;
@@ -80,23 +89,69 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
-    std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor->type);
-    // If there's an equivalent type, we can simply copy.
-    if (equivalent_dtype.has_value()) {
-        auto shape = get_shape(*tensor);
-        ov::Tensor weights(equivalent_dtype.value(), shape);
+// Allocates a tensor in place of its data in a mapped file, so the tensor keeps the file mapped
+class MappedFileAllocator {
+public:
+    MappedFileAllocator(GGUFFile file, void* data) : m_file{std::move(file)}, m_data{data} {}
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        return m_data;
+    }
+
+    void deallocate(void* handle, size_t bytes, size_t alignment = alignof(std::max_align_t)) {}
+
+    bool is_equal(const MappedFileAllocator& other) const {
+        return m_data == other.m_data;
+    }
+
+private:
+    GGUFFile m_file;
+    void* m_data;
+};
 
-        memcpy(weights.data(), tensor->weights_data, tensor->num_weights * equivalent_dtype.value().size());
-        return weights;
+bool is_quantized(uint32_t type) {
+    switch (type) {
+    case GGUF_TYPE_Q4_0:
+    case GGUF_TYPE_Q4_1:
+    case GGUF_TYPE_Q5_0:
+    case GGUF_TYPE_Q5_1:
+    case GGUF_TYPE_Q8_0:
+    case GGUF_TYPE_Q2_K:
+    case GGUF_TYPE_Q3_K:
+    case GGUF_TYPE_Q4_K:
+    case GGUF_TYPE_Q5_K:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Asks the OS to read the tensor data from disk in background, so it's mapped already when the tensor is unpacked
+void read_ahead(const gguf_tensor& tensor) {
+#ifdef __linux__
+    static const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(tensor.weights_data) / page_size * page_size;
+    const uintptr_t end = reinterpret_cast<uintptr_t>(tensor.weights_data) + tensor.bsize;
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+#endif
+}
+
+ov::Tensor extract_tensor_data(const GGUFFile& file, const gguf_tensor& tensor) {
+    std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor.type);
+    // If there's an equivalent type, the tensor points to the mapped file.
+    if (equivalent_dtype.has_value()) {
+        return ov::Tensor(equivalent_dtype.value(),
+                          get_shape(tensor),
+                          ov::Allocator(MappedFileAllocator(file, tensor.weights_data)));
     }
     // Otherwise, we convert to float16.
     // TODO: Add other dequantization options.
-    int16_t* data = gguf_tensor_to_f16(tensor);
+    gguf_tensor tensor_copy = tensor;
+    int16_t* data = gguf_tensor_to_f16(&tensor_copy);
     OPENVINO_ASSERT(data != nullptr, "[load_gguf] gguf_tensor_to_f16 failed");
 
-    auto shape = get_shape(*tensor);
-    const size_t new_size = tensor->num_weights * sizeof(int16_t);
+    auto shape = get_shape(tensor);
+    const size_t new_size = tensor.num_weights * sizeof(int16_t);
     ov::Tensor weights(ov::element::f16, shape);
     memcpy(weights.data(), data, new_size);
     free(data);
@@ -263,8 +318,8 @@ std::unordered_map<std::string, GGUFMetaData> load_metadata(gguf_ctx* ctx) {
     return metadata;
 }
 
-void load_arrays(gguf_ctx* ctx,
-                 std::unordered_map<std::string, ov::Tensor>& array_map,
+void load_arrays(const GGUFFile& file,
+                 std::unordered_map<std::string, GGUFTensorInfo>& info_map,
                  std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
     gguf_tensor tensor;
 
@@ -275,22 +330,21 @@ void load_arrays(gguf_ctx* ctx,
                         "'. This can happen when loading quantized tensors.");
     };
 
-    while (gguf_get_tensor(ctx, &tensor)) {
-        if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
-            tensor.type == GGUF_TYPE_Q4_K) {
-            gguf_load_quantized(array_map, qtype_map, tensor);
+    // only locations of tensors are read, the data is unpacked when the model is built
+    while (gguf_get_tensor(file.get(), &tensor)) {
+        std::string name(tensor.name, tensor.namelen);
+        check_insert(info_map.emplace(name, GGUFTensorInfo{file, tensor}));
+
+        constexpr std::string_view weight_suffix = ".weight";
+        const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
+        if (is_quantized(tensor.type)) {
+            check_insert(info_map.emplace(name_prefix + ".scales", GGUFTensorInfo{file, tensor}));
+            check_insert(info_map.emplace(name_prefix + ".biases", GGUFTensorInfo{file, tensor}));
+            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
+        } else if (tensor.type == GGUF_TYPE_Q6_K) {
+            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(GGUF_TYPE_F16)); //WA: Q6_K is not supported by platform because of group size 16, so we use F16 as a workaround
         } else {
-            std::string name(tensor.name, tensor.namelen);
-            ov::Tensor loaded_array = extract_tensor_data(&tensor);
-            check_insert(array_map.emplace(name, loaded_array));
-
-            constexpr std::string_view weight_suffix = ".weight";
-            const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
-            if (tensor.type == GGUF_TYPE_Q6_K) {
-                qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(GGUF_TYPE_F16)); //WA: Q6_K is not supported by platform because of group size 16, so we use F16 as a workaround
-            } else {
-                qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
-            }
+            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
         }
     }
 }
@@ -304,33 +358,76 @@ void check_file(std::string file) {
     OPENVINO_ASSERT(exists, "[load_gguf] Failed to open '", file, "'");
 }
 
-std::vector<std::string> get_all_files(std::string file, int total_num) {
+std::vector<std::string> get_split_files(const std::string& file) {
+    constexpr size_t number_length = 5;
+    constexpr std::string_view of = "-of-", extension = ".gguf";
+    // -<number>-of-<total>.gguf
+    const size_t suffix_length = 1 + number_length + of.length() + number_length + extension.length();
+    if (file.length() <= suffix_length || file[file.length() - suffix_length] != '-' ||
+        file.compare(file.length() - extension.length(), extension.length(), extension) != 0 ||
+        file.compare(file.length() - extension.length() - number_length - of.length(), of.length(), of) != 0) {
+        return {file};
+    }
+    const size_t number_pos = file.length() - suffix_length + 1;
+    const std::string number = file.substr(number_pos, number_length);
+    const std::string total = file.substr(file.length() - extension.length() - number_length, number_length);
+    auto is_number = [](const std::string& str) {
+        return std::all_of(str.begin(), str.end(), [](char c) {
+            return c >= '0' && c <= '9';
+        });
+    };
+    if (!is_number(number) || !is_number(total)) {
+        return {file};
+    }
+
     std::vector<std::string> files;
-    files.push_back(file);
+    for (int i = 1; i <= std::stoi(total); ++i) {
+        std::string split_number = std::to_string(i);
+        split_number.insert(0, number_length - split_number.length(), '0');
+        files.push_back(file.substr(0, number_pos) + split_number + file.substr(number_pos + number_length));
+    }
+    return files;
+}
 
-    size_t length = 5;
-    size_t startPos = file.length() - 19;
+GGUFFile open_gguf_file(const std::string& file) {
+    GGUFFile ctx(gguf_open(file.data()), gguf_close);
+    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    return ctx;
+}
 
-    for (int i = 1; i < total_num; i++) {
-        std::string new_number = std::to_string(i + 1);
-        while (new_number.length() < length) {
-            new_number = "0" + new_number;
+std::pair<std::unordered_map<std::string, GGUFTensorInfo>, std::unordered_map<std::string, gguf_tensor_type>>
+load_split_arrays(const std::vector<std::string>& files, const SplitArraysLoader& load_file_arrays) {
+    // files are opened and their tensors are listed concurrently, then merged in the order of files,
+    // so the result doesn't depend on the order they are done in
+    std::vector<std::unordered_map<std::string, GGUFTensorInfo>> file_arrays(files.size());
+    std::vector<std::unordered_map<std::string, gguf_tensor_type>> file_qtypes(files.size());
+    ov::parallel_for(files.size(), [&](size_t i) {
+        load_file_arrays(i, file_arrays.at(i), file_qtypes.at(i));
+    });
+
+    std::unordered_map<std::string, GGUFTensorInfo> arrays;
+    std::unordered_map<std::string, gguf_tensor_type> qtype;
+    for (size_t i = 0; i < files.size(); i++) {
+        for (auto& [name, info] : file_arrays.at(i)) {
+            OPENVINO_ASSERT(arrays.emplace(name, std::move(info)).second,
+                            "[load_gguf] Duplicate parameter name '",
+                            name,
+                            "' in '",
+                            files.at(i),
+                            "'.");
         }
-        file.replace(startPos, length, new_number);
-        check_file(file);
-        files.push_back(file);
+        qtype.insert(file_qtypes.at(i).begin(), file_qtypes.at(i).end());
     }
-    return files;
+    return {std::move(arrays), std::move(qtype)};
 }
 
 GGUFLoad get_gguf_data(const std::string& file) {
-    std::unordered_map<std::string, ov::Tensor> arrays;
+    std::unordered_map<std::string, GGUFTensorInfo> arrays;
     std::unordered_map<std::string, gguf_tensor_type> qtype;
 
     check_file(file);
 
-    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_open(file.data()), gguf_close);
-    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    GGUFFile ctx = open_gguf_file(file);
 
     // get main config from first file or single file
     auto metadata = load_metadata(ctx.get());
@@ -340,24 +437,37 @@ GGUFLoad get_gguf_data(const std::string& file) {
 
     if (it == metadata.end())  // single GGUF file
     {
-        load_arrays(ctx.get(), arrays, qtype);
+        load_arrays(ctx, arrays, qtype);
         return {metadata, arrays, qtype};
     } else  // multi GGUF files
     {
         auto total_num_tensor = std::get<ov::Tensor>(metadata.at(split_flag));
         int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
 
-        std::vector<std::string> files = get_all_files(file, total_num);
-
-        for (size_t i = 1; i < files.size(); i++) {
-            std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx_i(gguf_open(files.at(i).data()), gguf_close);
-            OPENVINO_ASSERT(ctx_i, "Failed to open '", files.at(i), "' with gguf_open");
-
-            auto metadata_tmp = load_metadata(ctx_i.get());
-
-            load_arrays(ctx_i.get(), arrays, qtype);
+        std::vector<std::string> files = get_split_files(file);
+        OPENVINO_ASSERT(files.size() == static_cast<size_t>(total_num) && files.front() == file,
+                        "[load_gguf] '",
+                        file,
+                        "' should be the first of ",
+                        total_num,
+                        " split files named <name>-00001-of-<total>.gguf");
+        for (size_t i = 1; i < files.size(); ++i) {
+            check_file(files[i]);
         }
-        load_arrays(ctx.get(), arrays, qtype);
+
+        std::tie(arrays, qtype) = load_split_arrays(
+            files,
+            [&](size_t i,
+                std::unordered_map<std::string, GGUFTensorInfo>& file_arrays,
+                std::unordered_map<std::string, gguf_tensor_type>& file_qtype) {
+                GGUFFile ctx_i = ctx;
+                if (i > 0) {
+                    ctx_i = open_gguf_file(files.at(i));
+                    // tensors follow the metadata
+                    auto metadata_tmp = load_metadata(ctx_i.get());
+                }
+                load_arrays(ctx_i, file_arrays, file_qtype);
+            });
         return {metadata, arrays, qtype};
     }
 }
@@ -395,10 +505,10 @@ std::map<std::string, GGUFMetaData> config_from_meta(const std::unordered_map<st
     return config;
 }
 
-std::unordered_map<std::string, ov::Tensor> consts_from_weights(
+std::unordered_map<std::string, GGUFTensorInfo> consts_from_weights(
     const std::map<std::string, GGUFMetaData>& config,
-    const std::unordered_map<std::string, ov::Tensor>& weights) {
-    std::unordered_map<std::string, ov::Tensor> consts;
+    const std::unordered_map<std::string, GGUFTensorInfo>& weights) {
+    std::unordered_map<std::string, GGUFTensorInfo> consts;
 
     consts["model.embed_tokens.weight"] = weights.at("token_embd.weight");
     consts["model.norm.weight"] = weights.at("output_norm.weight");
@@ -571,15 +681,100 @@ std::unordered_map<std::string, gguf_tensor_type> get_qtype_map(
     return qtype_map;
 }
 
+GGUFTensorMap::GGUFTensorMap(std::unordered_map<std::string, GGUFTensorInfo> infos) : m_infos{std::move(infos)} {}
+
+size_t GGUFTensorMap::count(const std::string& key) const {
+    return m_infos.count(key);
+}
+
+ov::Tensor GGUFTensorMap::at(const std::string& key) const {
+    // unpacked parts are released as soon as they are requested
+    auto unpacked = m_unpacked.find(key);
+    if (unpacked != m_unpacked.end()) {
+        ov::Tensor tensor = unpacked->second;
+        m_unpacked.erase(unpacked);
+        return tensor;
+    }
+
+    const GGUFTensorInfo& info = m_infos.at(key);
+    if (!is_quantized(info.tensor.type)) {
+        return extract_tensor_data(info.file, info.tensor);
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    unpack(key, info, m_unpacked);
+    m_unpack_time += std::chrono::steady_clock::now() - start_time;
+    m_unpacked_bytes += info.tensor.bsize;
+    return at(key);
+}
+
+void GGUFTensorMap::read_ahead(const std::string& key_prefix) const {
+    for (const auto& [key, info] : m_infos) {
+        if (key.compare(0, key_prefix.size(), key_prefix) == 0) {
+            ::read_ahead(info.tensor);
+        }
+    }
+}
+
+void GGUFTensorMap::prefetch(const std::string& key_prefix) const {
+    // scales and biases are unpacked with their weights
+    constexpr std::string_view weight_suffix = ".weight";
+    std::vector<std::pair<std::string, const GGUFTensorInfo*>> to_unpack;
+    for (const auto& [key, info] : m_infos) {
+        if (key.compare(0, key_prefix.size(), key_prefix) == 0 && is_quantized(info.tensor.type) &&
+            key.size() > weight_suffix.size() &&
+            key.compare(key.size() - weight_suffix.size(), weight_suffix.size(), weight_suffix) == 0 &&
+            !m_unpacked.count(key)) {
+            to_unpack.emplace_back(key, &info);
+        }
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::unordered_map<std::string, ov::Tensor>> parts(to_unpack.size());
+    ov::parallel_for(to_unpack.size(), [&](size_t i) {
+        unpack(to_unpack[i].first, *to_unpack[i].second, parts[i]);
+    });
+    m_unpack_time += std::chrono::steady_clock::now() - start_time;
+
+    for (size_t i = 0; i < to_unpack.size(); ++i) {
+        m_unpacked.insert(parts[i].begin(), parts[i].end());
+        m_unpacked_bytes += to_unpack[i].second->tensor.bsize;
+    }
+}
+
+void GGUFTensorMap::unpack(const std::string& key,
+                           const GGUFTensorInfo& info,
+                           std::unordered_map<std::string, ov::Tensor>& unpacked) {
+    std::unordered_map<std::string, ov::Tensor> parts;
+    std::unordered_map<std::string, gguf_tensor_type> qtype;
+    gguf_load_quantized(parts, qtype, info.tensor);
+
+    // parts are named after the tensor in the file, while the key is a name in the model
+    const std::string name(info.tensor.name, info.tensor.namelen);
+    const std::string name_prefix = name.substr(0, name.rfind('.'));
+    const std::string key_prefix = key.substr(0, key.rfind('.'));
+    for (const std::string suffix : {".weight", ".scales", ".biases"}) {
+        unpacked.emplace(key_prefix + suffix, parts.at(name_prefix + suffix));
+    }
+}
+
+size_t GGUFTensorMap::get_unpacked_bytes() const {
+    return m_unpacked_bytes;
+}
+
+std::chrono::nanoseconds GGUFTensorMap::get_unpack_time() const {
+    return m_unpack_time;
+}
+
 std::tuple<std::map<std::string, GGUFMetaData>,
-           std::unordered_map<std::string, ov::Tensor>,
+           GGUFTensorMap,
            std::unordered_map<std::string, gguf_tensor_type>>
 load_gguf(const std::string& file) {
     auto [metadata, weights, qtype] = get_gguf_data(file);
 
     auto config = config_from_meta(metadata);
-    auto consts = consts_from_weights(config, weights);
+    auto consts = GGUFTensorMap(consts_from_weights(config, weights));
     auto qtypes = get_qtype_map(config, qtype);
 
-    return {config, consts, qtypes};
+    return {config, std::move(consts), qtypes};
 }
@@ -6,13 +6,17 @@
 #include <assert.h>
 #include <stdio.h>
 
+#include <chrono>
 #include <cstdarg>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "openvino/openvino.hpp"
 
@@ -23,8 +27,64 @@ extern "C" {
 using GGUFMetaData =
     std::variant<std::monostate, float, int, ov::Tensor, std::string, std::vector<std::string>, std::vector<int32_t>>;
 
+// GGUF file is memory mapped while any of its tensors is used
+using GGUFFile = std::shared_ptr<gguf_ctx>;
+
+// Location of a tensor in a mapped GGUF file. Scales and biases of a quantized tensor point to the same tensor.
+struct GGUFTensorInfo {
+    GGUFFile file;
+    gguf_tensor tensor;
+};
+
+/**
+ * Tensors of mapped GGUF files, which are unpacked only when they are requested. Tensors of types supported by
+ * OpenVINO point to the mapped files, others are unpacked to memory owned by the returned tensors, so no tensor is
+ * kept in memory once the model constants built from it are released.
+ */
+class GGUFTensorMap {
+public:
+    GGUFTensorMap() = default;
+
+    explicit GGUFTensorMap(std::unordered_map<std::string, GGUFTensorInfo> infos);
+
+    size_t count(const std::string& key) const;
+
+    /**
+     * Weights, scales and biases of a quantized tensor are unpacked together, the parts which are not requested yet
+     * are kept until they are requested.
+     */
+    ov::Tensor at(const std::string& key) const;
+
+    /**
+     * Asks the OS to read data of tensors with keys starting with key_prefix from the files in background.
+     */
+    void read_ahead(const std::string& key_prefix) const;
+
+    /**
+     * Unpacks quantized tensors with keys starting with key_prefix concurrently, they are kept until requested by
+     * at(), so a prefix should select a bounded part of the model like a layer.
+     */
+    void prefetch(const std::string& key_prefix) const;
+
+    /**
+     * Bytes of quantized tensors read from the files and the time spent to unpack them so far
+     */
+    size_t get_unpacked_bytes() const;
+    std::chrono::nanoseconds get_unpack_time() const;
+
+private:
+    static void unpack(const std::string& key,
+                       const GGUFTensorInfo& info,
+                       std::unordered_map<std::string, ov::Tensor>& unpacked);
+
+    std::unordered_map<std::string, GGUFTensorInfo> m_infos;
+    mutable std::unordered_map<std::string, ov::Tensor> m_unpacked;
+    mutable size_t m_unpacked_bytes = 0;
+    mutable std::chrono::nanoseconds m_unpack_time{0};
+};
+
 using GGUFLoad = std::tuple<std::unordered_map<std::string, GGUFMetaData>,
-                            std::unordered_map<std::string, ov::Tensor>,
+                            std::unordered_map<std::string, GGUFTensorInfo>,
                             std::unordered_map<std::string, gguf_tensor_type>>;
 
 template <typename... Args>
@@ -37,8 +97,26 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
                          const gguf_tensor& tensor);
 
 std::tuple<std::map<std::string, GGUFMetaData>,
-           std::unordered_map<std::string, ov::Tensor>,
+           GGUFTensorMap,
            std::unordered_map<std::string, gguf_tensor_type>>
 load_gguf(const std::string& file);
 
+// Lists tensors of split file i to the given maps
+using SplitArraysLoader = std::function<void(size_t i,
+                                             std::unordered_map<std::string, GGUFTensorInfo>&,
+                                             std::unordered_map<std::string, gguf_tensor_type>&)>;
+
+/**
+ * Lists tensors of split GGUF files concurrently and merges them in the order of files. Tensor names have to be
+ * unique across the files.
+ */
+std::pair<std::unordered_map<std::string, GGUFTensorInfo>, std::unordered_map<std::string, gguf_tensor_type>>
+load_split_arrays(const std::vector<std::string>& files, const SplitArraysLoader& load_file_arrays);
+
+/**
+ * Files of a split model are named <name>-00001-of-00003.gguf, ..., <name>-00003-of-00003.gguf. Returns all files of
+ * the split model the given file belongs to in the order of their numbers, or the file itself if it's not named so.
+ */
+std::vector<std::string> get_split_files(const std::string& file);
+
 GGUFLoad get_gguf_data(const std::string& file);
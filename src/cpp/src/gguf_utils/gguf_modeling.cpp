@@ -6,6 +6,8 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <stdexcept>
 
 #include <openvino/openvino.hpp>
@@ -15,6 +17,7 @@
 #include "gguf_utils/building_blocks.hpp"
 #include "gguf_utils/gguf_modeling.hpp"
 #include "utils.hpp"
+#include "logger.hpp"
 
 using namespace ov;
 using namespace ov::op::v13;
@@ -22,6 +25,29 @@ using namespace ov::op;
 
 namespace {
 
+// peak resident set size of the process in bytes, 0 if it is not known
+size_t get_peak_memory_usage() {
+#ifdef __linux__
+    std::ifstream status_file("/proc/self/status");
+    std::string line;
+    while (std::getline(status_file, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+#endif
+    return 0;
+}
+
+void print_peak_memory_usage() {
+    const size_t peak_memory_usage = get_peak_memory_usage();
+    if (peak_memory_usage > 0) {
+        std::stringstream ss;
+        ss << "Peak memory usage: " << peak_memory_usage / (1024 * 1024) << " MB";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+    }
+}
+
 auto set_name = [](auto node, const std::string& name) {
     node->output(0).set_names({name});
     node->set_friendly_name(name);
@@ -29,7 +55,7 @@ auto set_name = [](auto node, const std::string& name) {
 
 std::shared_ptr<ov::Model> create_language_model(
     const std::map<std::string, GGUFMetaData>& configs,
-    std::unordered_map<std::string, ov::Tensor>& consts,
+    GGUFTensorMap& consts,
     std::unordered_map<std::string, gguf_tensor_type>& qtypes) {
     // Create input parameters
     auto input_ids = std::make_shared<ov::op::v0::Parameter>(
@@ -80,6 +106,9 @@ std::shared_ptr<ov::Model> create_language_model(
     std::shared_ptr<ov::Node> output_shape = nullptr;
 
     for (int i = 0; i < std::get<int>(configs.at("layer_num")); ++i) {
+        // weights of a layer are unpacked concurrently, while the next layer is read from disk
+        consts.read_ahead("model.layers[" + std::to_string(i + 1) + "].");
+        consts.prefetch("model.layers[" + std::to_string(i) + "].");
         auto [new_hidden, layer_sinks, new_mask, new_cos_sin, new_shape] = layer(
             configs,
             consts,
@@ -136,32 +165,25 @@ std::shared_ptr<ov::Model> create_language_model(
     return model;
 }
 
-} // namespace
-
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model) {
+std::shared_ptr<ov::Model> convert_gguf(const std::string& model_path) {
     auto start_time = std::chrono::high_resolution_clock::now();
     std::stringstream ss;
-    ss << "Loading and unpacking model from: " << model_path;
+    ss << "Loading model from: " << model_path;
     ov::genai::utils::print_gguf_debug_info(ss.str());
     auto [config, consts, qtypes] = load_gguf(model_path);
     auto load_finish_time = std::chrono::high_resolution_clock::now();
 
     ss.str("");
-    ss << "Loading and unpacking model done. Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(load_finish_time - start_time).count() << "ms";
+    ss << "Loading model done. Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(load_finish_time - start_time).count() << "ms";
     ov::genai::utils::print_gguf_debug_info(ss.str());
 
     std::shared_ptr<ov::Model> model;
     const std::string model_arch = std::get<std::string>(config.at("architecture"));
     ss.str("");
-    ss << "Start generating OpenVINO model...";
+    ss << "Start unpacking weights and generating OpenVINO model...";
     ov::genai::utils::print_gguf_debug_info(ss.str());
     if (!model_arch.compare("llama") || !model_arch.compare("qwen2") || !model_arch.compare("qwen3")) {
         model = create_language_model(config, consts, qtypes);
-        if (enable_save_ov_model){
-            std::filesystem::path gguf_model_path(model_path);
-            std::filesystem::path save_path = gguf_model_path.parent_path() / "openvino_model.xml";
-            ov::genai::utils::save_openvino_model(model, save_path.string(), true);
-        }
     } else {
         OPENVINO_THROW("Unsupported model architecture '", model_arch, "'");
     }
@@ -170,6 +192,112 @@ std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const
     ss.str("");
     ss << "Model generation done. Time: " << duration << "ms";
     ov::genai::utils::print_gguf_debug_info(ss.str());
+    const double unpack_seconds = std::chrono::duration<double>(consts.get_unpack_time()).count();
+    if (unpack_seconds > 0) {
+        ss.str("");
+        ss << "Unpacked " << consts.get_unpacked_bytes() / (1024 * 1024) << " MiB of quantized weights at "
+           << consts.get_unpacked_bytes() / unpack_seconds / 1e9 << " GB/s";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+    }
+    print_peak_memory_usage();
+
+    return model;
+}
+
+// Bump when the conversion changes, so models converted by previous versions are not read from the cache
+constexpr int GGUF_CONVERTER_VERSION = 1;
+// Reading whole GGUF files would take as long as the conversion, so their content is sampled
+constexpr size_t CACHE_KEY_NUM_SAMPLES = 64;
+constexpr size_t CACHE_KEY_SAMPLE_SIZE = 64 * 1024;
+
+std::filesystem::path get_cached_model_path(const std::string& model_path, const std::string& cache_dir) {
+    std::string key_data = "converter_version=" + std::to_string(GGUF_CONVERTER_VERSION);
+    std::vector<char> sample(CACHE_KEY_SAMPLE_SIZE);
+    for (const std::filesystem::path file : get_split_files(model_path)) {
+        const uintmax_t file_size = std::filesystem::file_size(file);
+        key_data += ";" + file.filename().string() + ";" + std::to_string(file_size) + ";" +
+                    std::to_string(std::filesystem::last_write_time(file).time_since_epoch().count()) + ";";
+
+        std::ifstream stream(file, std::ios::binary);
+        OPENVINO_ASSERT(stream.is_open(), "Failed to open '", file.string(), "'");
+        for (size_t i = 0; i < CACHE_KEY_NUM_SAMPLES; ++i) {
+            stream.clear();
+            stream.seekg(file_size / CACHE_KEY_NUM_SAMPLES * i);
+            stream.read(sample.data(), sample.size());
+            key_data.append(sample.data(), stream.gcount());
+        }
+    }
+
+    std::stringstream dir_name;
+    // the hash is persisted in the directory name, so it has to be the same in every run and on every platform
+    dir_name << std::filesystem::path(model_path).stem().string() << "_" << std::hex
+             << ov::genai::utils::hash_bytes(key_data.data(), key_data.size());
+    return std::filesystem::path(cache_dir) / dir_name.str() / "openvino_model.xml";
+}
+
+std::shared_ptr<ov::Model> read_cached_model(const std::filesystem::path& cached_model_path) {
+    if (!std::filesystem::exists(cached_model_path)) {
+        return nullptr;
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    // weights are memory mapped from the cached model
+    auto model = ov::genai::utils::singleton_core().read_model(cached_model_path.string());
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start_time).count();
+    std::stringstream ss;
+    ss << "Read converted model from cache: " << cached_model_path.string() << " done. Time: " << duration << "ms";
+    ov::genai::utils::print_gguf_debug_info(ss.str());
+    return model;
+}
+
+void save_cached_model(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& cached_model_path) {
+    // the model is saved to a temporary directory, which is renamed when it's complete, so other processes reading
+    // the cache never see a partially written model
+    const std::filesystem::path model_dir = cached_model_path.parent_path();
+    std::filesystem::path tmp_dir = model_dir;
+    tmp_dir += ".tmp" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    try {
+        std::filesystem::create_directories(tmp_dir);
+        // weights are not compressed, so the cached model is identical to the converted one
+        ov::save_model(model, (tmp_dir / cached_model_path.filename()).string(), false);
+        std::filesystem::rename(tmp_dir, model_dir);
+        std::stringstream ss;
+        ss << "Saved converted model to cache: " << cached_model_path.string();
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+    } catch (const std::exception& e) {
+        // the model is usable even if it can't be cached, e.g. another process cached it first
+        std::error_code ec;
+        std::filesystem::remove_all(tmp_dir, ec);
+        if (!std::filesystem::exists(cached_model_path)) {
+            ov::genai::Logger::warn(std::string("Failed to cache converted GGUF model: ") + e.what());
+        }
+    }
+}
+
+} // namespace
+
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::string& cache_dir) {
+    std::filesystem::path cached_model_path;
+    std::shared_ptr<ov::Model> model;
+    if (!cache_dir.empty()) {
+        cached_model_path = get_cached_model_path(model_path, cache_dir);
+        model = read_cached_model(cached_model_path);
+    }
+
+    if (!model) {
+        model = convert_gguf(model_path);
+        if (!cached_model_path.empty()) {
+            save_cached_model(model, cached_model_path);
+        }
+    }
+
+    if (enable_save_ov_model) {
+        std::filesystem::path gguf_model_path(model_path);
+        std::filesystem::path save_path = gguf_model_path.parent_path() / "openvino_model.xml";
+        ov::genai::utils::save_openvino_model(model, save_path.string(), true);
+    }
 
     return model;
 }
@@ -7,4 +7,10 @@
 
 #include "openvino/openvino.hpp"
 
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model);
+/**
+ * Converts a GGUF model to an OpenVINO model. If cache_dir is not empty, the converted model is read from the cache
+ * when the GGUF files didn't change, otherwise it's converted and saved to the cache.
+ */
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::string& cache_dir = "");
@@ -1,6 +1,8 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -12,20 +14,120 @@
 
 using namespace std;
 
-void unpack_32_4(uint8_t* data, uint8_t* dst) {
-    std::fill_n(dst, 16, 0);
-    for (int j = 0; j < 16; ++j) {
-        uint8_t x = (data[j] & 0x0F);
-        uint8_t y = (data[j] >> 4);
-        if (j % 2 != 0) {
-            x <<= 4;
-            y <<= 4;
+// Loops over weights of a block are branch free and have a fixed trip count, so compilers vectorize them.
+
+namespace {
+
+float get_f16(const uint8_t* data) {
+    uint16_t bits;
+    std::memcpy(&bits, data, sizeof(bits));
+    return static_cast<float>(ov::float16::from_bits(bits));
+}
+
+// A block of 2 * half 4-bit weights stores weight j in the low and weight j + half in the high nibble of byte j,
+// while u4 stores weights 2k and 2k + 1 in the low and the high nibble of byte k.
+void unpack_4bit(const uint8_t* data, uint8_t* dst, size_t half) {
+    for (size_t k = 0; k < half / 2; ++k) {
+        const uint8_t even = data[2 * k];
+        const uint8_t odd = data[2 * k + 1];
+        dst[k] = (even & 0x0F) | static_cast<uint8_t>(odd << 4);
+        dst[half / 2 + k] = (even >> 4) | (odd & 0xF0);
+    }
+}
+
+// 6-bit scale and min of sub-block j of Q4_K and Q5_K super-blocks
+void get_scale_min_k4(size_t j, const uint8_t* packed, uint8_t& scale, uint8_t& min) {
+    if (j < 4) {
+        scale = packed[j] & 0b111111;
+        min = packed[j + 4] & 0b111111;
+    } else {
+        scale = (packed[j + 4] & 0b00001111) | ((packed[j - 4] >> 6) << 4);
+        min = (packed[j + 4] >> 4) | ((packed[j] >> 6) << 4);
+    }
+}
+
+// Plugins don't support groups of 16 weights (see Q6_K workaround), so Q2_K and Q3_K super-blocks are dequantized and
+// quantized again to u8 groups of 32 with zero point 128. The error of 8-bit groups is far below the error of the
+// original 2 or 3-bit quantization.
+void requantize_to_u8(const float* values, uint8_t* weights, ov::float16& scale, ov::float16& bias) {
+    constexpr size_t group_size = 32;
+    float max_abs = 0.f;
+    for (size_t j = 0; j < group_size; ++j) {
+        max_abs = std::max(max_abs, std::abs(values[j]));
+    }
+    // subnormal f16 scales lose precision and their inverse overflows, the smallest normal f16 is used instead
+    constexpr float min_scale = 6.103515625e-05f;
+    scale = ov::float16(max_abs > 0.f ? std::max(max_abs / 127.f, min_scale) : 1.f);
+    // -128 * scale is exact in f16, so the zero point is restored exactly
+    bias = ov::float16(-128.f * static_cast<float>(scale));
+    const float inv_scale = 1.f / static_cast<float>(scale);
+    for (size_t j = 0; j < group_size; ++j) {
+        // the shifted value is positive, so truncation rounds it to the nearest
+        const float shifted = std::clamp(values[j] * inv_scale, -127.f, 127.f) + 128.5f;
+        weights[j] = static_cast<uint8_t>(static_cast<int32_t>(shifted));
+    }
+}
+
+// Q2_K super-block: |16 x (4-bit scale, 4-bit min)|256 x 2-bit weights|16 bit scale|16 bit min|
+void dequantize_q2_k_block(const uint8_t* block_data, float* values) {
+    const uint8_t* packed_scales = block_data;
+    const uint8_t* qs = block_data + 16;
+    const float d = get_f16(block_data + 80);
+    const float dmin = get_f16(block_data + 82);
+
+    size_t sub_block = 0;
+    for (size_t n = 0; n < 2; ++n) {
+        const uint8_t* q = qs + n * 32;
+        for (size_t shift = 0; shift < 8; shift += 2) {
+            for (size_t half = 0; half < 2; ++half, ++sub_block) {
+                const float dl = d * static_cast<float>(packed_scales[sub_block] & 0x0F);
+                const float ml = dmin * static_cast<float>(packed_scales[sub_block] >> 4);
+                for (size_t l = 0; l < 16; ++l) {
+                    values[sub_block * 16 + l] = dl * static_cast<float>((q[half * 16 + l] >> shift) & 3) - ml;
+                }
+            }
+        }
+    }
+}
+
+// Q3_K super-block: |256 x high bit|256 x 2 low bits|16 x 6-bit scale|16 bit scale|
+void dequantize_q3_k_block(const uint8_t* block_data, float* values) {
+    const uint8_t* hmask = block_data;
+    const uint8_t* qs = block_data + 32;
+    const uint8_t* packed_scales = block_data + 96;
+    const float d = get_f16(block_data + 108);
+
+    // low 4 bits of the scales are in bytes 0-7, high 2 bits are in bytes 8-11
+    float scales[16];
+    for (size_t j = 0; j < 16; ++j) {
+        const uint8_t low = j < 8 ? (packed_scales[j] & 0x0F) : (packed_scales[j - 8] >> 4);
+        const uint8_t high = (packed_scales[8 + j % 4] >> (2 * (j / 4))) & 3;
+        scales[j] = d * static_cast<float>(static_cast<int32_t>(low | (high << 4)) - 32);
+    }
+
+    size_t sub_block = 0;
+    for (size_t n = 0; n < 2; ++n) {
+        const uint8_t* q = qs + n * 32;
+        for (size_t j = 0; j < 4; ++j) {
+            const size_t shift = 2 * j;
+            const uint8_t mask = static_cast<uint8_t>(1 << (n * 4 + j));
+            for (size_t half = 0; half < 2; ++half, ++sub_block) {
+                for (size_t l = 0; l < 16; ++l) {
+                    const int32_t low = (q[half * 16 + l] >> shift) & 3;
+                    const int32_t high = (hmask[half * 16 + l] & mask) ? 0 : 4;
+                    values[sub_block * 16 + l] = scales[sub_block] * static_cast<float>(low - high);
+                }
+            }
         }
-        dst[j / 2] |= x;
-        dst[8 + j / 2] |= y;  // Last 16 weights are in the higher bits
     }
 }
 
+}  // namespace
+
+void unpack_32_4(uint8_t* data, uint8_t* dst) {
+    unpack_4bit(data, dst, 16);
+}
+
 // Extracts (weight, scales, biases) from Q4_0 tensors.
 // Data layout is: |16 bit scale|32 x 4bit weights|.
 void extract_q4_0_data(const gguf_tensor& tensor,
@@ -63,6 +165,60 @@ void extract_q4_1_data(const gguf_tensor& tensor,
     });
 }
 
+// Extracts (weight, scales, biases) from Q5_0 tensors.
+// Data layout is: |16 bit scale|32 x high bit|32 x 4 low bits|.
+void extract_q5_0_data(const gguf_tensor& tensor,
+                       ov::Tensor& weights_arr,
+                       ov::Tensor& scales_arr,
+                       ov::Tensor& biases_arr) {
+    const uint64_t weights_per_block = 32;
+    const uint64_t bytes_per_block = 22;  // 2 bytes scale, 4 bytes high bits, 32x0.5 byte low bits
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
+        const uint8_t* block_data = data + i * bytes_per_block;
+        scales[i] = ov::float16::from_bits(*((uint16_t*)block_data));
+        biases[i] = ov::float16(-16.f * static_cast<float>(scales[i]));
+        uint32_t qh;
+        std::memcpy(&qh, block_data + 2, sizeof(qh));
+        const uint8_t* qs = block_data + 6;
+        uint8_t* block_weights = weights + i * weights_per_block;
+        for (uint32_t j = 0; j < 16; ++j) {
+            block_weights[j] = (qs[j] & 0x0F) | (((qh >> j) << 4) & 0x10);
+            block_weights[j + 16] = (qs[j] >> 4) | ((qh >> (j + 12)) & 0x10);
+        }
+    });
+}
+
+// Extracts (weight, scales, biases) from Q5_1 tensors.
+// Data layout is: |16 bit scale|16 bit bias|32 x high bit|32 x 4 low bits|.
+void extract_q5_1_data(const gguf_tensor& tensor,
+                       ov::Tensor& weights_arr,
+                       ov::Tensor& scales_arr,
+                       ov::Tensor& biases_arr) {
+    const uint64_t weights_per_block = 32;
+    const uint64_t bytes_per_block = 24;  // 2 bytes scale, 2 bytes bias, 4 bytes high bits, 32x0.5 byte low bits
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
+        const uint8_t* block_data = data + i * bytes_per_block;
+        scales[i] = ov::float16::from_bits(*((uint16_t*)block_data));
+        biases[i] = ov::float16::from_bits(*((uint16_t*)(block_data + 2)));
+        uint32_t qh;
+        std::memcpy(&qh, block_data + 4, sizeof(qh));
+        const uint8_t* qs = block_data + 8;
+        uint8_t* block_weights = weights + i * weights_per_block;
+        for (uint32_t j = 0; j < 16; ++j) {
+            block_weights[j] = (qs[j] & 0x0F) | (((qh >> j) << 4) & 0x10);
+            block_weights[j + 16] = (qs[j] >> 4) | ((qh >> (j + 12)) & 0x10);
+        }
+    });
+}
+
 // Extracts (weight, scales, biases) from Q8_0 tensors.
 // Data layout is: |16 bit scale|32 x 8bit weights|.
 void extract_q8_0_data(const gguf_tensor& tensor,
@@ -75,38 +231,26 @@ void extract_q8_0_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    for (int64_t i = 0; i < scales_arr.get_size(); i++) {
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
         scales[i] = ov::float16::from_bits(*(uint16_t*)block_data);
         biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
-        for (int64_t j = 0; j < weights_per_block; ++j) {
-            uint8_t x = block_data[j + 2];  // j+2 to skip the scale bytes.
+        uint8_t* block_weights = weights + i * weights_per_block;
+        for (uint64_t j = 0; j < weights_per_block; ++j) {
             // Original data is in int8_t, so we add a bias of -128 and invert the
-            // first bit.
-            x ^= 1 << 7;
-            weights[i * weights_per_block + j] = x;
+            // first bit. j+2 to skip the scale bytes.
+            block_weights[j] = block_data[j + 2] ^ 0x80;
         }
-    }
+    });
 }
 
 void unpack_256_4(const uint8_t* data, uint8_t* dst) {
-    // Initialize the output array with zeros
-    std::fill_n(dst, 128, 0);
-
     for (size_t i = 0; i < 4; ++i) {
-        for (int j = 0; j < 32; ++j) {
-            uint8_t x = (data[i * 32 + j] & 0x0F);
-            uint8_t y = (data[i * 32 + j] >> 4);
-            if (j % 2 != 0) {
-                x <<= 4;
-                y <<= 4;
-            }
-            dst[i * 32 + j / 2] |= x;
-            dst[i * 32 + 16 + j / 2] |= y;  // Last 16 weights are in the higher bits
-        }
+        unpack_4bit(data + i * 32, dst + i * 32, 32);
     }
 }
 
+// Data layout is: |16 bit scale|16 bit min|8 x (6-bit scale, 6-bit min)|256 x 4bit weights|.
 void extract_q4_k_data(const gguf_tensor& tensor,
                        ov::Tensor& weights_arr,
                        ov::Tensor& scales_arr,
@@ -122,42 +266,55 @@ void extract_q4_k_data(const gguf_tensor& tensor,
         uint8_t* block_data = data + i * bytes_per_block;
 
         // Extract scale factors and offsets
-        float scale_scales = static_cast<float>(ov::float16::from_bits(*((uint16_t*)block_data)));
-        float scale_biases = static_cast<float>(ov::float16::from_bits(*((uint16_t*)block_data + 1)));
-
-        // Extract qs1 and qs2
-        uint8_t* qs1 = block_data + 4;
-        uint8_t* qs2 = block_data + 16;
-
-        scales[i * 8] = ov::float16(scale_scales * static_cast<float>((*(qs1) & 0b111111)));
-        scales[i * 8 + 1] = ov::float16(scale_scales * static_cast<float>((*(qs1 + 1) & 0b111111)));
-        scales[i * 8 + 2] = ov::float16(scale_scales * static_cast<float>((*(qs1 + 2) & 0b111111)));
-        scales[i * 8 + 3] = ov::float16(scale_scales * static_cast<float>((*(qs1 + 3) & 0b111111)));
-        scales[i * 8 + 4] =
-            ov::float16(scale_scales * static_cast<float>((*(qs1 + 8) & 0b00001111) | ((*(qs1) >> 6) << 4)));
-        scales[i * 8 + 5] =
-            ov::float16(scale_scales * static_cast<float>((*(qs1 + 9) & 0b00001111) | ((*(qs1 + 1) >> 6) << 4)));
-        scales[i * 8 + 6] =
-            ov::float16(scale_scales * static_cast<float>((*(qs1 + 10) & 0b00001111) | ((*(qs1 + 2) >> 6) << 4)));
-        scales[i * 8 + 7] =
-            ov::float16(scale_scales * static_cast<float>((*(qs1 + 11) & 0b00001111) | ((*(qs1 + 3) >> 6) << 4)));
-
-        biases[i * 8] = ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 4) & 0b111111)));
-        biases[i * 8 + 1] = ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 5) & 0b111111)));
-        biases[i * 8 + 2] = ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 6) & 0b111111)));
-        biases[i * 8 + 3] = ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 7) & 0b111111)));
-        biases[i * 8 + 4] =
-            ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 8) >> 4) | ((*(qs1 + 4) >> 6) << 4)));
-        biases[i * 8 + 5] =
-            ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 9) >> 4) | ((*(qs1 + 5) >> 6) << 4)));
-        biases[i * 8 + 6] =
-            ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 10) >> 4) | ((*(qs1 + 6) >> 6) << 4)));
-        biases[i * 8 + 7] =
-            ov::float16(-1.f * scale_biases * static_cast<float>((*(qs1 + 11) >> 4) | ((*(qs1 + 7) >> 6) << 4)));
+        float scale_scales = get_f16(block_data);
+        float scale_biases = get_f16(block_data + 2);
+        for (size_t j = 0; j < 8; ++j) {
+            uint8_t scale, min;
+            get_scale_min_k4(j, block_data + 4, scale, min);
+            scales[i * 8 + j] = ov::float16(scale_scales * static_cast<float>(scale));
+            biases[i * 8 + j] = ov::float16(-1.f * scale_biases * static_cast<float>(min));
+        }
         unpack_256_4(block_data + 16, weights + i * 128);
     });
 }
 
+// Data layout is: |16 bit scale|16 bit min|8 x (6-bit scale, 6-bit min)|256 x high bit|256 x 4 low bits|.
+void extract_q5_k_data(const gguf_tensor& tensor,
+                       ov::Tensor& weights_arr,
+                       ov::Tensor& scales_arr,
+                       ov::Tensor& biases_arr) {
+    const uint64_t bytes_per_block = 2 + 2 + 12 + 32 + 128;
+    const uint64_t n_super_block = tensor.bsize / bytes_per_block;
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+
+    ov::parallel_for(n_super_block, [&](size_t i) {
+        const uint8_t* block_data = data + i * bytes_per_block;
+
+        float scale_scales = get_f16(block_data);
+        float scale_biases = get_f16(block_data + 2);
+        for (size_t j = 0; j < 8; ++j) {
+            uint8_t scale, min;
+            get_scale_min_k4(j, block_data + 4, scale, min);
+            scales[i * 8 + j] = ov::float16(scale_scales * static_cast<float>(scale));
+            biases[i * 8 + j] = ov::float16(-1.f * scale_biases * static_cast<float>(min));
+        }
+
+        // bits 2j and 2j + 1 of qh are high bits of sub-blocks 2j and 2j + 1, which share 32 bytes of ql
+        const uint8_t* qh = block_data + 16;
+        const uint8_t* ql = block_data + 48;
+        uint8_t* block_weights = weights + i * 256;
+        for (size_t j = 0; j < 4; ++j) {
+            for (size_t l = 0; l < 32; ++l) {
+                block_weights[j * 64 + l] = (ql[j * 32 + l] & 0x0F) | (((qh[l] >> (2 * j)) & 1) << 4);
+                block_weights[j * 64 + 32 + l] = (ql[j * 32 + l] >> 4) | (((qh[l] >> (2 * j + 1)) & 1) << 4);
+            }
+        }
+    });
+}
+
 void extract_q6_k_data(const gguf_tensor& tensor,
                        ov::Tensor& weights_arr,
                        ov::Tensor& scales_arr,
@@ -168,8 +325,7 @@ void extract_q6_k_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    // std::string name(tensor.name, tensor.namelen);
-    for (int64_t i = 0; i < n_super_block; i++) {
+    ov::parallel_for(n_super_block, [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
 
         float scale_factor =
@@ -196,7 +352,33 @@ void extract_q6_k_data(const gguf_tensor& tensor,
             weights[i * 256 + j + 192] = (ql[64 + j] >> 4) | (((qh[32 + j] >> 4) & 3) << 4);
             weights[i * 256 + j + 224] = (ql[96 + j] >> 4) | (((qh[32 + j] >> 6) & 3) << 4);
         }
-    }
+    });
+}
+
+// Extracts (weight, scales, biases) from Q2_K and Q3_K tensors re-quantized to u8 groups of 32.
+void extract_requantized_data(const gguf_tensor& tensor,
+                              ov::Tensor& weights_arr,
+                              ov::Tensor& scales_arr,
+                              ov::Tensor& biases_arr) {
+    const bool is_q2_k = tensor.type == GGUF_TYPE_Q2_K;
+    const uint64_t bytes_per_block = is_q2_k ? 16 + 64 + 2 + 2 : 32 + 64 + 12 + 2;
+    const uint64_t n_super_block = tensor.bsize / bytes_per_block;
+    auto data = static_cast<uint8_t*>(tensor.weights_data);
+    auto weights = static_cast<uint8_t*>(weights_arr.data());
+    auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+    auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
+
+    ov::parallel_for(n_super_block, [&](size_t i) {
+        float values[256];
+        if (is_q2_k) {
+            dequantize_q2_k_block(data + i * bytes_per_block, values);
+        } else {
+            dequantize_q3_k_block(data + i * bytes_per_block, values);
+        }
+        for (size_t group = 0; group < 8; ++group) {
+            requantize_to_u8(values + group * 32, weights + i * 256 + group * 32, scales[i * 8 + group], biases[i * 8 + group]);
+        }
+    });
 }
 
 void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
@@ -205,7 +387,7 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
     uint64_t weights_per_byte;
     if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q4_K) {
         weights_per_byte = 2;
-    } else {  // tensor.type == GGUF_TYPE_Q8_0 || tensor.type == GGUF_TYPE_Q6_K
+    } else {  // 5, 6 and 8-bit types and Q2_K, Q3_K re-quantized to 8 bits
         weights_per_byte = 1;
     }
 
@@ -234,12 +416,16 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
     // For scales and bias
     shape[shape.size() - 1] = shape[shape.size() - 1] / weights_per_block;
 
-    ov::Tensor scales(ov::element::f16, std::move(shape));
+    ov::Tensor scales(ov::element::f16, shape);
     ov::Tensor biases(ov::element::f16, std::move(shape));
     if (tensor.type == GGUF_TYPE_Q4_0) {
         extract_q4_0_data(tensor, weights, scales, biases);
     } else if (tensor.type == GGUF_TYPE_Q4_1) {
         extract_q4_1_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_Q5_0) {
+        extract_q5_0_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_Q5_1) {
+        extract_q5_1_data(tensor, weights, scales, biases);
     } else if (tensor.type == GGUF_TYPE_Q8_0) {
         extract_q8_0_data(tensor, weights, scales, biases);
     } else if (tensor.type == GGUF_TYPE_Q6_K) {
@@ -247,8 +433,12 @@ void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
         extract_q6_k_data(tensor, weights, scales, biases);
     } else if (tensor.type == GGUF_TYPE_Q4_K) {
         extract_q4_k_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_Q5_K) {
+        extract_q5_k_data(tensor, weights, scales, biases);
+    } else if (tensor.type == GGUF_TYPE_Q2_K || tensor.type == GGUF_TYPE_Q3_K) {
+        extract_requantized_data(tensor, weights, scales, biases);
     } else {
-        OPENVINO_ASSERT("Unsupported tensor type in 'gguf_load_quantized'");
+        OPENVINO_THROW("Unsupported tensor type in 'gguf_load_quantized'");
     }
 
     a.emplace(name, std::move(weights));
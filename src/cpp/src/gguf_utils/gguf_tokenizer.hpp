@@ -22,6 +22,9 @@ std::tuple<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>, std::map<std:
 create_tokenizer_from_config(const std::shared_ptr<void>& shared_object_ov_tokenizers,
                              const std::filesystem::path& gguf_model_path);
 
+// Inverse of GPT-2 bytes to unicode mapping used by byte level BPE vocabularies, keys are UTF-8 encoded characters
+const std::unordered_map<std::string, uint8_t>& unicode_to_bytes();
+
 std::shared_ptr<void> load_shared_object(const std::filesystem::path& path);
 
 void* get_symbol(const std::shared_ptr<void>& shared_object, const char* symbolName);
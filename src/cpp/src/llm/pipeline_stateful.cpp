@@ -38,7 +38,7 @@ StatefulLLMPipeline::StatefulLLMPipeline(
         utils::read_model(models_path, properties),
         tokenizer,
         device,
-        properties,
+        utils::extract_gguf_properties(properties, models_path).first,
         utils::from_config_json_if_exists(models_path)
     } {}
 
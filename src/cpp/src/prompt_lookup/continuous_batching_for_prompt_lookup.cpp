@@ -71,7 +71,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate
             {
                 const auto generated_len = running_sequence->get_generated_len();
                 const auto left_generated_len = request->get_max_new_tokens() - generated_len - 1;
-                min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
+                min_num_assistant_tokens = std::min(request->get_num_assistant_tokens(), left_generated_len);
             }
             TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
 
@@ -93,4 +93,12 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::is_reque
 size_t ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_processed_tokens_per_iteration() {
     return m_batch_size;
 }
+
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::set_num_assistant_tokens(uint64_t request_id, size_t num_assistant_tokens) {
+    for (auto& request : m_requests) {
+        if (request->get_request_id() == request_id) {
+            request->set_num_assistant_tokens(num_assistant_tokens);
+        }
+    }
+}
 }
@@ -38,6 +38,8 @@ public:
 
     size_t get_processed_tokens_per_iteration();
 
+    void set_num_assistant_tokens(uint64_t request_id, size_t num_assistant_tokens);
+
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
     TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
@@ -18,6 +18,10 @@ ContinuousBatchingPipeline::PromptLookupImpl::add_request(uint64_t request_id,
                                                           ov::genai::GenerationConfig sampling_params,
                                                           std::optional<ov::Tensor> token_type_ids) {
     OPENVINO_ASSERT(sampling_params.is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`");
+    if (sampling_params.adaptive_num_assistant_tokens) {
+        std::lock_guard<std::mutex> lock(m_draft_length_controllers_mutex);
+        m_draft_length_controllers.insert_or_assign(request_id, AdaptiveDraftLengthController(sampling_params.num_assistant_tokens));
+    }
     return m_pipeline->add_request(request_id, input_ids, sampling_params, token_type_ids);
 }
 
@@ -26,6 +30,10 @@ ContinuousBatchingPipeline::PromptLookupImpl::add_request(uint64_t request_id,
                                                           const std::string& prompt,
                                                           ov::genai::GenerationConfig sampling_params) {
     OPENVINO_ASSERT(sampling_params.is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`");
+    if (sampling_params.adaptive_num_assistant_tokens) {
+        std::lock_guard<std::mutex> lock(m_draft_length_controllers_mutex);
+        m_draft_length_controllers.insert_or_assign(request_id, AdaptiveDraftLengthController(sampling_params.num_assistant_tokens));
+    }
     return m_pipeline->add_request(request_id, prompt, sampling_params);
 }
 
@@ -54,9 +62,23 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
     m_pipeline_metrics = m_pipeline->get_metrics();
     auto generated_len_after = m_pipeline->get_generated_request_len();
 
+    // one lookup is done per step, but its cost is split across candidates to be comparable with draft model steps
+    size_t max_validation_len = 0;
+    for (const auto& request : generated_len_before) {
+        max_validation_len = std::max<size_t>(max_validation_len, request.second.second);
+    }
+    if (max_validation_len > 0 && main_timer.get_duration() > 0) {
+        float draft_cost_ratio = candidates_timer.get_duration() / max_validation_len / main_timer.get_duration();
+        m_draft_cost_ratio = m_draft_cost_ratio == 0.0f ? draft_cost_ratio : 0.9f * m_draft_cost_ratio + 0.1f * draft_cost_ratio;
+    }
+
+    std::lock_guard<std::mutex> lock(m_draft_length_controllers_mutex);
     for (const auto request : generated_len_before) {
         auto request_id = request.first;
         auto prev_validation_len = request.second.second;
+        if (!generated_len_after.count(request_id)) {
+            m_draft_length_controllers.erase(request_id);
+        }
         if (prev_validation_len == 0) {
             continue;
         }
@@ -71,6 +93,12 @@ void ContinuousBatchingPipeline::PromptLookupImpl::step() {
         }        
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, num_matches);
+
+        auto controller_it = m_draft_length_controllers.find(request_id);
+        if (controller_it != m_draft_length_controllers.end()) {
+            controller_it->second.register_validation(prev_validation_len, num_matches);
+            m_pipeline->set_num_assistant_tokens(request_id, controller_it->second.get_num_assistant_tokens(m_draft_cost_ratio));
+        }
     }
 
     // update perf metrics
@@ -198,5 +226,7 @@ ContinuousBatchingPipeline::PromptLookupImpl::get_metrics() {
 
 void ContinuousBatchingPipeline::PromptLookupImpl::drop_requests() {
     m_pipeline->drop_requests();
+    std::lock_guard<std::mutex> lock(m_draft_length_controllers_mutex);
+    m_draft_length_controllers.clear();
 }
 }
@@ -7,6 +7,7 @@
 #include "continuous_batching/pipeline_impl.hpp"
 #include "continuous_batching_for_prompt_lookup.hpp"
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
+#include "speculative_decoding/adaptive_draft_length_controller.hpp"
 #include "utils.hpp"
 
 namespace ov::genai {
@@ -17,6 +18,13 @@ protected:
     SpeculativeDecodingMetrics m_sd_metrics;
     PerfMetrics m_perf_metrics;
 
+    // controllers of candidates number for requests with adaptive_num_assistant_tokens
+    std::map<uint64_t, AdaptiveDraftLengthController> m_draft_length_controllers;
+    // Mutex protecting access to m_draft_length_controllers, so add_request and step methods can be called from different threads
+    std::mutex m_draft_length_controllers_mutex;
+    // exponentially averaged duration of candidate lookup relative to the main model step
+    float m_draft_cost_ratio = 0.0f;
+
     void drop_requests();
 
 public:
@@ -0,0 +1,103 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ov {
+namespace genai {
+namespace distance {
+
+// Floating point sums are accumulated in a fixed number of independent lanes, so compilers vectorize the loops
+// without reassociation of a single accumulator (-ffast-math), which is not allowed by default.
+constexpr size_t ACCUMULATOR_LANES = 16;
+
+inline float inner_product_f32(const float* lhs, const float* rhs, size_t size) {
+    float lanes[ACCUMULATOR_LANES] = {};
+    const size_t lanes_size = size - size % ACCUMULATOR_LANES;
+    for (size_t i = 0; i < lanes_size; i += ACCUMULATOR_LANES) {
+        for (size_t lane = 0; lane < ACCUMULATOR_LANES; ++lane) {
+            lanes[lane] += lhs[i + lane] * rhs[i + lane];
+        }
+    }
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < ACCUMULATOR_LANES; ++lane) {
+        sum += lanes[lane];
+    }
+    for (size_t i = lanes_size; i < size; ++i) {
+        sum += lhs[i] * rhs[i];
+    }
+    return sum;
+}
+
+inline float l2_squared_f32(const float* lhs, const float* rhs, size_t size) {
+    float lanes[ACCUMULATOR_LANES] = {};
+    const size_t lanes_size = size - size % ACCUMULATOR_LANES;
+    for (size_t i = 0; i < lanes_size; i += ACCUMULATOR_LANES) {
+        for (size_t lane = 0; lane < ACCUMULATOR_LANES; ++lane) {
+            const float diff = lhs[i + lane] - rhs[i + lane];
+            lanes[lane] += diff * diff;
+        }
+    }
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < ACCUMULATOR_LANES; ++lane) {
+        sum += lanes[lane];
+    }
+    for (size_t i = lanes_size; i < size; ++i) {
+        const float diff = lhs[i] - rhs[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// integer sums are associative, so plain loops are vectorized; int32 can't overflow for any practical embedding size
+inline int32_t inner_product_i8(const int8_t* lhs, const int8_t* rhs, size_t size) {
+    int32_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        sum += static_cast<int32_t>(lhs[i]) * static_cast<int32_t>(rhs[i]);
+    }
+    return sum;
+}
+
+inline int32_t l2_squared_i8(const int8_t* lhs, const int8_t* rhs, size_t size) {
+    int32_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const int32_t diff = static_cast<int32_t>(lhs[i]) - static_cast<int32_t>(rhs[i]);
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+inline uint32_t popcount(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_popcountll(value));
+#else
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<uint32_t>((value * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// number of different bits of binary vectors of size bytes
+inline uint32_t hamming(const uint8_t* lhs, const uint8_t* rhs, size_t size) {
+    uint32_t sum = 0;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t lhs_word, rhs_word;
+        std::memcpy(&lhs_word, lhs + i, sizeof(uint64_t));
+        std::memcpy(&rhs_word, rhs + i, sizeof(uint64_t));
+        sum += popcount(lhs_word ^ rhs_word);
+    }
+    for (; i < size; ++i) {
+        sum += popcount(static_cast<uint64_t>(lhs[i] ^ rhs[i]));
+    }
+    return sum;
+}
+
+}  // namespace distance
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,204 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rag/embedding_cache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "logger.hpp"
+#include "openvino/core/except.hpp"
+#include "utils.hpp"
+
+namespace {
+
+constexpr char FILE_MAGIC[8] = {'O', 'V', 'G', 'E', 'C', 'A', 'C', 'H'};
+constexpr uint32_t FILE_VERSION = 1;
+// embeddings are mapped from the file, so their offset is aligned for any element type
+constexpr uint64_t ROWS_ALIGNMENT = 64;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t model_hash;
+    uint64_t row_byte_size;
+    uint64_t num_entries;
+    // keys follow the header, rows start at rows_offset, both in the order from most recently used
+    uint64_t rows_offset;
+};
+
+uint64_t align_up(uint64_t value) {
+    return (value + ROWS_ALIGNMENT - 1) / ROWS_ALIGNMENT * ROWS_ALIGNMENT;
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+EmbeddingCache::EmbeddingCache(size_t max_bytes, uint64_t model_hash)
+    : m_max_bytes{max_bytes},
+      m_model_hash{model_hash} {}
+
+uint64_t EmbeddingCache::get_key(const std::string& text) const {
+    return utils::hash_bytes(text.data(), text.size(), m_model_hash);
+}
+
+bool EmbeddingCache::get(uint64_t key, void* dst, size_t byte_size) {
+    std::lock_guard lock(m_mutex);
+    const auto it = m_key_to_entry.find(key);
+    if (it == m_key_to_entry.end() || byte_size != m_row_byte_size) {
+        ++m_num_misses;
+        return false;
+    }
+    ++m_num_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    std::memcpy(dst, it->second->data, m_row_byte_size);
+    return true;
+}
+
+void EmbeddingCache::put(uint64_t key, const void* data, size_t byte_size) {
+    std::lock_guard lock(m_mutex);
+    if (m_row_byte_size == 0) {
+        m_row_byte_size = byte_size;
+    }
+    OPENVINO_ASSERT(byte_size == m_row_byte_size,
+                    "Embedding of ",
+                    byte_size,
+                    " bytes doesn't match cached embeddings of ",
+                    m_row_byte_size,
+                    " bytes");
+    if (m_key_to_entry.count(key) || m_row_byte_size > m_max_bytes) {
+        return;
+    }
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    Entry& entry = m_entries.emplace_front(Entry{key, nullptr, std::vector<uint8_t>(bytes, bytes + byte_size)});
+    entry.data = entry.owned_data.data();
+    m_key_to_entry.emplace(key, m_entries.begin());
+    evict_above_budget();
+}
+
+size_t EmbeddingCache::get_row_byte_size() const {
+    std::lock_guard lock(m_mutex);
+    return m_row_byte_size;
+}
+
+void EmbeddingCache::evict_above_budget() {
+    while (!m_entries.empty() && m_entries.size() * m_row_byte_size > m_max_bytes) {
+        const Entry& entry = m_entries.back();
+        if (entry.owned_data.empty() && --m_num_mapped_entries == 0) {
+            m_mapped_file = ov::Tensor();
+            m_mapped_path.clear();
+        }
+        m_key_to_entry.erase(entry.key);
+        m_entries.pop_back();
+    }
+}
+
+void EmbeddingCache::load(const std::filesystem::path& path) {
+    std::lock_guard lock(m_mutex);
+    OPENVINO_ASSERT(m_entries.empty(), "Embedding cache can be loaded to an empty cache only");
+
+    ov::Tensor mapped_file = ov::read_tensor_data(path);
+    const auto* data = static_cast<const uint8_t*>(mapped_file.data());
+    const size_t size = mapped_file.get_byte_size();
+
+    FileHeader header;
+    OPENVINO_ASSERT(size >= sizeof(FileHeader), "Embedding cache file is truncated");
+    std::memcpy(&header, data, sizeof(FileHeader));
+    OPENVINO_ASSERT(std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0, path, " is not an embedding cache file");
+
+    if (header.version != FILE_VERSION || header.model_hash != m_model_hash) {
+        std::stringstream message;
+        message << "Embedding cache file " << path << " is written by another model or configuration, it's ignored.";
+        Logger::warn(message.str());
+        return;
+    }
+
+    const size_t num_entries = header.num_entries;
+    OPENVINO_ASSERT(header.row_byte_size > 0 && header.rows_offset % ROWS_ALIGNMENT == 0 &&
+                        header.rows_offset >= sizeof(FileHeader) + num_entries * sizeof(uint64_t) &&
+                        header.rows_offset + num_entries * header.row_byte_size <= size,
+                    "Embedding cache file is corrupted");
+
+    m_row_byte_size = header.row_byte_size;
+    // the most recently used embeddings are kept if the file doesn't fit the budget
+    const size_t num_loaded = std::min<size_t>(num_entries, m_max_bytes / m_row_byte_size);
+    for (size_t i = 0; i < num_loaded; ++i) {
+        uint64_t key;
+        std::memcpy(&key, data + sizeof(FileHeader) + i * sizeof(uint64_t), sizeof(uint64_t));
+        const uint8_t* row = data + header.rows_offset + i * m_row_byte_size;
+        m_entries.push_back(Entry{key, row, {}});
+        m_key_to_entry.emplace(key, std::prev(m_entries.end()));
+    }
+    m_num_mapped_entries = num_loaded;
+    if (num_loaded > 0) {
+        m_mapped_file = mapped_file;
+        m_mapped_path = path;
+    }
+}
+
+void EmbeddingCache::unmap() {
+    for (Entry& entry : m_entries) {
+        if (entry.owned_data.empty()) {
+            entry.owned_data.assign(entry.data, entry.data + m_row_byte_size);
+            entry.data = entry.owned_data.data();
+        }
+    }
+    m_num_mapped_entries = 0;
+    m_mapped_file = ov::Tensor();
+    m_mapped_path.clear();
+}
+
+void EmbeddingCache::save(const std::filesystem::path& path) {
+    std::lock_guard lock(m_mutex);
+
+    // a mapped file can't be replaced on Windows, so its embeddings are copied to memory and the mapping is dropped
+    std::error_code error;
+    if (m_mapped_file && std::filesystem::equivalent(path, m_mapped_path, error)) {
+        unmap();
+    }
+
+    // the file is replaced after it's written, so a failed save doesn't corrupt the existing cache
+    std::filesystem::path tmp_path = path;
+    tmp_path += ".tmp";
+    std::ofstream file(tmp_path, std::ios::binary);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", tmp_path, " for writing");
+
+    FileHeader header{};
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.model_hash = m_model_hash;
+    header.row_byte_size = m_row_byte_size;
+    header.num_entries = m_entries.size();
+    header.rows_offset = align_up(sizeof(FileHeader) + m_entries.size() * sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+
+    for (const Entry& entry : m_entries) {
+        file.write(reinterpret_cast<const char*>(&entry.key), sizeof(uint64_t));
+    }
+    const std::vector<char> padding(header.rows_offset - sizeof(FileHeader) - m_entries.size() * sizeof(uint64_t), 0);
+    file.write(padding.data(), padding.size());
+    for (const Entry& entry : m_entries) {
+        file.write(reinterpret_cast<const char*>(entry.data), m_row_byte_size);
+    }
+    file.close();
+    OPENVINO_ASSERT(file.good(), "Failed to write embedding cache to ", tmp_path);
+    std::filesystem::rename(tmp_path, path);
+}
+
+EmbeddingCacheMetrics EmbeddingCache::get_metrics() const {
+    std::lock_guard lock(m_mutex);
+    EmbeddingCacheMetrics metrics;
+    metrics.num_hits = m_num_hits;
+    metrics.num_misses = m_num_misses;
+    metrics.num_entries = m_entries.size();
+    metrics.size_bytes = m_entries.size() * m_row_byte_size;
+    return metrics;
+}
+
+}  // namespace genai
+}  // namespace ov
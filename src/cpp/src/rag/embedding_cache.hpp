@@ -0,0 +1,92 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief LRU cache of embeddings within a byte budget. All embeddings have the same byte size, which is
+ * taken from the first put() or load(). Can be used from several threads at once.
+ */
+class EmbeddingCache {
+public:
+    /**
+     * @param max_bytes Budget of cached embeddings, the least recently used ones are evicted above it
+     * @param model_hash Identity of the model and its configuration, cache files of other models are ignored
+     */
+    EmbeddingCache(size_t max_bytes, uint64_t model_hash);
+
+    /**
+     * @brief Key of a text, which depends on the model
+     */
+    uint64_t get_key(const std::string& text) const;
+
+    /**
+     * @brief Copies a cached embedding to dst. It's a miss if the key is not cached or byte_size differs from
+     * get_row_byte_size().
+     */
+    bool get(uint64_t key, void* dst, size_t byte_size);
+
+    void put(uint64_t key, const void* data, size_t byte_size);
+
+    /**
+     * @brief Byte size of an embedding, 0 until the first embedding is known
+     */
+    size_t get_row_byte_size() const;
+
+    /**
+     * @brief Fills an empty cache from a file written by save(). Embeddings are memory mapped from the file.
+     * A file of another model is ignored with a warning.
+     */
+    void load(const std::filesystem::path& path);
+
+    /**
+     * @brief Writes the cache to a file. If the cache is loaded from the same file, its embeddings are copied to memory
+     * and the file is no longer mapped.
+     */
+    void save(const std::filesystem::path& path);
+
+    EmbeddingCacheMetrics get_metrics() const;
+
+private:
+    struct Entry {
+        uint64_t key;
+        // points to owned_data or to the mapped file
+        const uint8_t* data;
+        std::vector<uint8_t> owned_data;
+    };
+
+    void evict_above_budget();
+
+    void unmap();
+
+    size_t m_max_bytes;
+    uint64_t m_model_hash;
+    size_t m_row_byte_size = 0;
+    // most recently used first
+    std::list<Entry> m_entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_key_to_entry;
+    // mapped file is released when all its entries are evicted
+    ov::Tensor m_mapped_file;
+    std::filesystem::path m_mapped_path;
+    size_t m_num_mapped_entries = 0;
+    size_t m_num_hits = 0;
+    size_t m_num_misses = 0;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/rag/retriever.hpp"
+
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+
+#include "continuous_batching/timer.hpp"
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+class Retriever::RetrieverImpl {
+public:
+    RetrieverImpl(TextEmbeddingPipeline& embedding_pipeline,
+                  VectorIndex& index,
+                  TextRerankPipeline* rerank_pipeline,
+                  const Config& config,
+                  const std::vector<std::string>& documents)
+        : m_embedding_pipeline{embedding_pipeline},
+          m_index{index},
+          m_rerank_pipeline{rerank_pipeline},
+          m_config{config},
+          m_documents{documents} {
+        OPENVINO_ASSERT(m_config.top_k > 0, "top_k should be greater than 0");
+    }
+
+    std::vector<size_t> add_documents(const std::vector<std::string>& texts) {
+        if (texts.empty()) {
+            return {};
+        }
+        const ov::Tensor embeddings = m_embedding_pipeline.embed_documents_tensor(texts);
+
+        std::unique_lock lock(m_documents_mutex);
+        std::vector<size_t> ids(texts.size());
+        std::iota(ids.begin(), ids.end(), m_documents.size());
+        // texts are known before ids can be found in the index by concurrent retrieve()
+        m_documents.insert(m_documents.end(), texts.begin(), texts.end());
+        try {
+            m_index.add(ids, embeddings);
+        } catch (...) {
+            m_documents.resize(ids.front());
+            throw;
+        }
+        return ids;
+    }
+
+    void remove_documents(const std::vector<size_t>& ids) {
+        std::unique_lock lock(m_documents_mutex);
+        m_index.remove(ids);
+        for (size_t id : ids) {
+            // ids are not reused, so the text is not needed anymore
+            if (id < m_documents.size()) {
+                std::string().swap(m_documents[id]);
+            }
+        }
+    }
+
+    RetrievalResults retrieve(const std::string& query) {
+        RetrievalResults results;
+
+        ManualTimer embedding_timer("retriever embedding");
+        embedding_timer.start();
+        const EmbeddingResult query_embedding = m_embedding_pipeline.embed_query(query);
+        embedding_timer.end();
+        results.metrics.embedding_duration = embedding_timer.get_duration_microsec();
+
+        ManualTimer search_timer("retriever search");
+        search_timer.start();
+        const auto found = m_index.search(query_embedding, m_config.top_k);
+        search_timer.end();
+        results.metrics.search_duration = search_timer.get_duration_microsec();
+
+        std::vector<std::string> found_texts;
+        found_texts.reserve(found.size());
+        {
+            std::shared_lock lock(m_documents_mutex);
+            for (const auto& [id, score] : found) {
+                OPENVINO_ASSERT(id < m_documents.size(), "Text of document ", id, " is not known to the retriever");
+                found_texts.push_back(m_documents[id]);
+            }
+        }
+
+        if (!m_rerank_pipeline || found.empty()) {
+            for (size_t i = 0; i < found.size(); ++i) {
+                results.documents.push_back({found[i].first, std::move(found_texts[i]), found[i].second});
+            }
+            return results;
+        }
+
+        ManualTimer rerank_timer("retriever rerank");
+        rerank_timer.start();
+        const auto reranked = m_rerank_pipeline->rerank(query, found_texts);
+        rerank_timer.end();
+        results.metrics.rerank_duration = rerank_timer.get_duration_microsec();
+
+        // reranked indices point to found documents
+        for (const auto& [found_idx, score] : reranked) {
+            results.documents.push_back({found[found_idx].first, std::move(found_texts[found_idx]), score});
+        }
+        return results;
+    }
+
+private:
+    TextEmbeddingPipeline& m_embedding_pipeline;
+    VectorIndex& m_index;
+    TextRerankPipeline* m_rerank_pipeline;
+    Config m_config;
+    std::vector<std::string> m_documents;
+    std::shared_mutex m_documents_mutex;
+};
+
+Retriever::Retriever(TextEmbeddingPipeline& embedding_pipeline,
+                     VectorIndex& index,
+                     const Config& config,
+                     const std::vector<std::string>& documents)
+    : m_impl{std::make_unique<RetrieverImpl>(embedding_pipeline, index, nullptr, config, documents)} {}
+
+Retriever::Retriever(TextEmbeddingPipeline& embedding_pipeline,
+                     VectorIndex& index,
+                     TextRerankPipeline& rerank_pipeline,
+                     const Config& config,
+                     const std::vector<std::string>& documents)
+    : m_impl{std::make_unique<RetrieverImpl>(embedding_pipeline, index, &rerank_pipeline, config, documents)} {}
+
+std::vector<size_t> Retriever::add_documents(const std::vector<std::string>& texts) {
+    return m_impl->add_documents(texts);
+}
+
+void Retriever::remove_documents(const std::vector<size_t>& ids) {
+    m_impl->remove_documents(ids);
+}
+
+RetrievalResults Retriever::retrieve(const std::string& query) {
+    return m_impl->retrieve(query);
+}
+
+Retriever::~Retriever() = default;
+
+}  // namespace genai
+}  // namespace ov
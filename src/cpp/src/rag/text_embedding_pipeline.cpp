@@ -3,9 +3,16 @@
 
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <nlohmann/json.hpp>
+#include <numeric>
+#include <unordered_map>
 
+#include "circular_buffer_queue.hpp"
 #include "json_utils.hpp"
 #include "logger.hpp"
 #include "openvino/core/except.hpp"
@@ -13,7 +20,9 @@
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
+#include "openvino/opsets/opset5.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "rag/embedding_cache.hpp"
 #include "utils.hpp"
 
 namespace {
@@ -26,8 +35,12 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     properties_copy.erase(max_length.name());
     properties_copy.erase(pad_to_max_length.name());
     properties_copy.erase(batch_size.name());
+    properties_copy.erase(max_batch_tokens.name());
+    properties_copy.erase(max_cache_bytes.name());
+    properties_copy.erase(cache_path.name());
     properties_copy.erase(pooling_type.name());
     properties_copy.erase(normalize.name());
+    properties_copy.erase(quantization_type.name());
     properties_copy.erase(embed_instruction.name());
     properties_copy.erase(query_instruction.name());
 
@@ -94,6 +107,39 @@ std::shared_ptr<op::Op> get_mean_pooling_op(std::shared_ptr<Model> model,
     return std::make_shared<op::v1::Divide>(sum_hidden_state, max_expanded_mask);
 }
 
+/**
+ * Scalar quantization of normalized embeddings
+ * [-1.0, 1.0] -> [-127, 127]
+ */
+std::shared_ptr<op::Op> get_int8_quantization_op(const ov::Output<ov::Node>& embeddings_node) {
+    auto scale = std::make_shared<op::v0::Constant>(ov::element::f32, ov::Shape{1}, std::vector<float>{127.0f});
+    auto scaled = std::make_shared<op::v1::Multiply>(embeddings_node, scale);
+    auto rounded = std::make_shared<op::v5::Round>(scaled, op::v5::Round::RoundMode::HALF_TO_EVEN);
+    auto clamped = std::make_shared<op::v0::Clamp>(rounded, -127.0, 127.0);
+    return std::make_shared<op::v0::Convert>(clamped, ov::element::i8);
+}
+
+/**
+ * Binary quantization packs signs of embeddings, first value in the most significant bit
+ * [batch_size, hidden_size] f32 -> [batch_size, hidden_size / 8] u8
+ */
+std::shared_ptr<op::Op> get_binary_quantization_op(const ov::Output<ov::Node>& embeddings_node) {
+    auto zero = std::make_shared<op::v0::Constant>(ov::element::f32, ov::Shape{1}, std::vector<float>{0.0f});
+    auto is_positive = std::make_shared<op::v1::Greater>(embeddings_node, zero);
+    auto bits = std::make_shared<op::v0::Convert>(is_positive, ov::element::i32);
+
+    auto grouped_shape = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{3}, std::vector<int64_t>{0, -1, 8});
+    auto grouped_bits = std::make_shared<op::v1::Reshape>(bits, grouped_shape, true);
+
+    auto bit_weights =
+        std::make_shared<op::v0::Constant>(ov::element::i32, ov::Shape{8}, std::vector<int32_t>{128, 64, 32, 16, 8, 4, 2, 1});
+    auto weighted_bits = std::make_shared<op::v1::Multiply>(grouped_bits, bit_weights);
+
+    auto axis_2 = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+    auto packed = std::make_shared<op::v1::ReduceSum>(weighted_bits, axis_2, false);
+    return std::make_shared<op::v0::Convert>(packed, ov::element::u8);
+}
+
 std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const TextEmbeddingPipeline::Config& config) {
     ov::preprocess::PrePostProcessor processor(model);
 
@@ -114,6 +160,21 @@ std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model, const
         });
     }
 
+    if (config.quantization_type == TextEmbeddingPipeline::QuantizationType::INT8) {
+        processor.output().postprocess().custom([](const ov::Output<ov::Node>& node) {
+            return get_int8_quantization_op(node);
+        });
+    } else if (config.quantization_type == TextEmbeddingPipeline::QuantizationType::BINARY) {
+        // [batch_size, seq_length, hidden_size]
+        const ov::Dimension hidden_size = model->get_output_partial_shape(0)[2];
+        OPENVINO_ASSERT(hidden_size.is_dynamic() || hidden_size.get_length() % 8 == 0,
+                        "Binary quantization requires embedding size to be a multiple of 8, got ",
+                        hidden_size.get_length());
+        processor.output().postprocess().custom([](const ov::Output<ov::Node>& node) {
+            return get_binary_quantization_op(node);
+        });
+    }
+
     return processor.build();
 }
 
@@ -136,6 +197,39 @@ std::optional<size_t> read_max_position_embeddings(const std::filesystem::path&
     return max_position_embeddings;
 }
 
+// Reading whole weights would slow down construction of the pipeline, so their content is sampled like GGUF files
+// are sampled for the converted model cache. Fine-tuned models of the same architecture differ in every sample.
+constexpr size_t MODEL_HASH_NUM_SAMPLES = 64;
+constexpr size_t MODEL_HASH_SAMPLE_SIZE = 64 * 1024;
+
+// identity of the model and configuration options which change embeddings, keys of the embedding cache depend on it
+uint64_t get_model_hash(const std::filesystem::path& models_path, const TextEmbeddingPipeline::Config& config) {
+    const auto xml_path = models_path / "openvino_model.xml";
+    std::ifstream xml_file(xml_path, std::ios::binary);
+    OPENVINO_ASSERT(xml_file.is_open(), "Failed to open ", xml_path);
+    const std::string xml((std::istreambuf_iterator<char>(xml_file)), std::istreambuf_iterator<char>());
+    uint64_t hash = ov::genai::utils::hash_bytes(xml.data(), xml.size());
+
+    const auto bin_path = models_path / "openvino_model.bin";
+    const uintmax_t bin_size = std::filesystem::file_size(bin_path);
+    std::ifstream bin_file(bin_path, std::ios::binary);
+    OPENVINO_ASSERT(bin_file.is_open(), "Failed to open ", bin_path);
+    std::vector<char> sample(MODEL_HASH_SAMPLE_SIZE);
+    for (size_t i = 0; i < MODEL_HASH_NUM_SAMPLES; ++i) {
+        bin_file.clear();
+        bin_file.seekg(bin_size / MODEL_HASH_NUM_SAMPLES * i);
+        bin_file.read(sample.data(), sample.size());
+        hash = ov::genai::utils::hash_bytes(sample.data(), static_cast<size_t>(bin_file.gcount()), hash);
+    }
+
+    std::stringstream options;
+    options << bin_size << ';' << static_cast<int>(config.pooling_type) << ';' << config.normalize << ';'
+            << static_cast<int>(config.quantization_type) << ';' << config.max_length.value_or(0) << ';'
+            << config.pad_to_max_length.value_or(false);
+    const std::string options_str = options.str();
+    return ov::genai::utils::hash_bytes(options_str.data(), options_str.size(), hash);
+}
+
 }  // namespace
 
 namespace ov {
@@ -146,8 +240,12 @@ TextEmbeddingPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::pad_to_max_length.name(), pad_to_max_length);
     read_anymap_param(properties, ov::genai::batch_size.name(), batch_size);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
+    read_anymap_param(properties, ov::genai::max_cache_bytes.name(), max_cache_bytes);
+    read_anymap_param(properties, ov::genai::cache_path.name(), cache_path);
     read_anymap_param(properties, ov::genai::pooling_type.name(), pooling_type);
     read_anymap_param(properties, ov::genai::normalize.name(), normalize);
+    read_anymap_param(properties, ov::genai::quantization_type.name(), quantization_type);
     read_anymap_param(properties, ov::genai::embed_instruction.name(), embed_instruction);
     read_anymap_param(properties, ov::genai::query_instruction.name(), query_instruction);
 };
@@ -160,6 +258,22 @@ void TextEmbeddingPipeline::Config::validate() const {
     if (batch_size.has_value()) {
         OPENVINO_ASSERT(batch_size.value() > 0, "batch_size should be greater than 0");
     }
+
+    if (max_batch_tokens.has_value()) {
+        OPENVINO_ASSERT(max_batch_tokens.value() > 0, "max_batch_tokens should be greater than 0");
+    }
+
+    if (max_cache_bytes.has_value()) {
+        OPENVINO_ASSERT(max_cache_bytes.value() > 0, "max_cache_bytes should be greater than 0");
+        // texts missed in the cache are embedded in batches of any size
+        OPENVINO_ASSERT(!batch_size.has_value(), "max_cache_bytes can't be used with batch_size");
+    }
+
+    OPENVINO_ASSERT(!cache_path.has_value() || max_cache_bytes.has_value(), "cache_path requires max_cache_bytes");
+
+    if (quantization_type == QuantizationType::INT8) {
+        OPENVINO_ASSERT(normalize, "INT8 quantization_type requires normalize to be true");
+    }
 }
 
 class TextEmbeddingPipeline::TextEmbeddingPipelineImpl {
@@ -201,35 +315,64 @@ public:
         ov::CompiledModel compiled_model = core.compile_model(model, device, properties);
 
         utils::print_compiled_model_properties(compiled_model, "text embedding model");
-        m_request = compiled_model.create_infer_request();
+        m_has_token_type_ids = has_token_type_ids_input(compiled_model.inputs());
+
+        // output tensors are allocated by the pipeline when embedding size is known,
+        // so results are handed out without copy and requests don't reuse them
+        const ov::Output<const ov::Node> embeddings_output = compiled_model.output("last_hidden_state");
+        m_embeddings_type = embeddings_output.get_element_type();
+        const ov::Dimension embedding_size = embeddings_output.get_partial_shape()[1];
+        if (embedding_size.is_static()) {
+            m_embedding_size = embedding_size.get_length();
+        }
+
+        m_infer_requests = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
+            std::max<uint32_t>(compiled_model.get_property(ov::optimal_number_of_infer_requests), 1),
+            [&compiled_model]() -> ov::InferRequest {
+                return compiled_model.create_infer_request();
+            });
+
+        // micro-batches are not used with fixed batch dimension of the model
+        m_is_micro_batching_enabled = m_config.max_batch_tokens.has_value() && !m_config.batch_size.has_value();
+
+        if (m_config.max_cache_bytes.has_value()) {
+            m_cache = std::make_unique<EmbeddingCache>(*m_config.max_cache_bytes, get_model_hash(models_path, m_config));
+            if (m_config.cache_path.has_value() && std::filesystem::exists(*m_config.cache_path)) {
+                m_cache->load(*m_config.cache_path);
+            }
+        }
     };
 
     EmbeddingResults embed_documents(const std::vector<std::string>& texts) {
-        start_embed_documents_async(texts);
-        return wait_embed_documents();
+        return to_embedding_result(embed_documents_tensor(texts));
     };
 
-    void start_embed_documents_async(const std::vector<std::string>& texts) {
-        auto formatted_texts = format_texts(texts);
-        start_embed_async(formatted_texts);
+    ov::Tensor embed_documents_tensor(const std::vector<std::string>& texts) {
+        const auto formatted_texts = format_texts(texts);
+        if (m_cache) {
+            return embed_cached(formatted_texts);
+        }
+        return embed_texts(formatted_texts);
     };
 
-    EmbeddingResults wait_embed_documents() {
-        return wait_embed();
+    std::future<EmbeddingResults> embed_documents_async(const std::vector<std::string>& texts) {
+        return std::async(std::launch::async, [this, texts] {
+            return embed_documents(texts);
+        });
     };
 
-    EmbeddingResult embed_query(const std::string& text) {
-        start_embed_query_async(text);
-        return wait_embed_query();
+    void start_embed_documents_async(const std::vector<std::string>& texts) {
+        m_embed_documents_future = embed_documents_async(texts);
     };
 
-    void start_embed_query_async(const std::string& text) {
-        std::vector<std::string> formatted_query{format_query(text)};
-        start_embed_async(formatted_query);
+    EmbeddingResults wait_embed_documents() {
+        OPENVINO_ASSERT(m_embed_documents_future.valid(), "start_embed_documents_async() has to be called before wait_embed_documents()");
+        return m_embed_documents_future.get();
     };
 
-    EmbeddingResult wait_embed_query() {
-        const EmbeddingResults results = wait_embed();
+    EmbeddingResult embed_query(const std::string& text) {
+        const std::vector<std::string> formatted_texts{format_query(text)};
+        const EmbeddingResults results = to_embedding_result(m_cache ? embed_cached(formatted_texts) : embed(formatted_texts));
         if (auto floats = std::get_if<std::vector<std::vector<float>>>(&results)) {
             return (*floats)[0];
         } else if (auto int8s = std::get_if<std::vector<std::vector<int8_t>>>(&results)) {
@@ -240,12 +383,61 @@ public:
         OPENVINO_THROW("Embedding result type is not supported");
     };
 
+    std::future<EmbeddingResult> embed_query_async(const std::string& text) {
+        return std::async(std::launch::async, [this, text] {
+            return embed_query(text);
+        });
+    };
+
+    void start_embed_query_async(const std::string& text) {
+        m_embed_query_future = embed_query_async(text);
+    };
+
+    EmbeddingResult wait_embed_query() {
+        OPENVINO_ASSERT(m_embed_query_future.valid(), "start_embed_query_async() has to be called before wait_embed_query()");
+        return m_embed_query_future.get();
+    };
+
+    void save_cache() const {
+        OPENVINO_ASSERT(m_cache && m_config.cache_path.has_value(), "save_cache() requires max_cache_bytes and cache_path");
+        m_cache->save(*m_config.cache_path);
+    }
+
+    EmbeddingCacheMetrics get_cache_metrics() const {
+        return m_cache ? m_cache->get_metrics() : EmbeddingCacheMetrics{};
+    }
+
 private:
     Tokenizer m_tokenizer;
-    InferRequest m_request;
     Config m_config;
     AnyMap m_tokenization_params;
     std::optional<size_t> m_max_position_embeddings;
+    bool m_has_token_type_ids = false;
+    ov::element::Type m_embeddings_type;
+    std::optional<size_t> m_embedding_size;
+    // requests are shared by concurrent calls, each call holds a request only while it runs
+    std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_infer_requests;
+    // see Config::max_batch_tokens
+    bool m_is_micro_batching_enabled = false;
+    // see Config::max_cache_bytes
+    std::unique_ptr<EmbeddingCache> m_cache;
+
+    // results of start_*_async() calls, declared last to be waited for before other members are destroyed
+    std::future<EmbeddingResults> m_embed_documents_future;
+    std::future<EmbeddingResult> m_embed_query_future;
+
+    struct MicroBatch {
+        // indices of texts in the order of batch rows
+        std::vector<size_t> text_indices;
+        // padded sequence length of the batch
+        size_t length = 0;
+    };
+
+    // texts tokenized without padding
+    struct TokenizedTexts {
+        std::vector<std::vector<int64_t>> token_ids;
+        bool is_left_padding = false;
+    };
 
     void reshape_model(std::shared_ptr<Model>& model) {
         ov::PartialShape target_shape{ov::Dimension::dynamic(), ov::Dimension::dynamic()};
@@ -283,7 +475,7 @@ private:
         model->reshape(input_name_to_shape);
     }
 
-    void start_embed_async(std::vector<std::string>& texts) {
+    ov::Tensor embed(const std::vector<std::string>& texts) {
         if (m_config.batch_size.has_value()) {
             // if batch_size is set, model shape is fixed
             // provide user friendly error message if number of texts is not equal to batch_size
@@ -295,28 +487,245 @@ private:
 
         const auto encoded = m_tokenizer.encode(texts, m_tokenization_params);
 
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
+        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_infer_requests.get());
+        InferRequest& request = infer_request_guard.get();
+        request.set_tensor("input_ids", encoded.input_ids);
+        request.set_tensor("attention_mask", encoded.attention_mask);
+        set_token_type_ids(request, encoded.input_ids.get_shape());
+
+        set_embeddings_tensor(request, encoded.input_ids.get_shape()[0]);
+
+        request.infer();
+
+        // [batch_size, hidden_size]
+        const Tensor last_hidden_state = request.get_tensor("last_hidden_state");
+        if (m_embedding_size.has_value()) {
+            return last_hidden_state;
+        }
+
+        // tensor allocated by the request is reused by the next inference
+        ov::Tensor embeddings(last_hidden_state.get_element_type(), last_hidden_state.get_shape());
+        last_hidden_state.copy_to(embeddings);
+        return embeddings;
+    };
+
+    ov::Tensor embed_texts(const std::vector<std::string>& texts) {
+        if (m_is_micro_batching_enabled && texts.size() > 1) {
+            return embed_micro_batches(texts);
+        }
+        return embed(texts);
+    }
+
+    ov::Tensor embed_cached(const std::vector<std::string>& texts) {
+        // row size is known before the first inference if embedding size is static, from the cache otherwise
+        const size_t row_byte_size =
+            m_embedding_size.has_value() ? *m_embedding_size * m_embeddings_type.size() : m_cache->get_row_byte_size();
+        ov::Tensor results;
+        if (row_byte_size > 0) {
+            results = ov::Tensor(m_embeddings_type, {texts.size(), row_byte_size / m_embeddings_type.size()});
+        }
+
+        // unique texts which are not cached and pairs of result rows and indices of missed texts
+        std::vector<std::string> missed_texts;
+        std::vector<uint64_t> missed_keys;
+        std::vector<std::pair<size_t, size_t>> missed_rows;
+        std::unordered_map<uint64_t, size_t> key_to_missed_idx;
+        for (size_t row = 0; row < texts.size(); ++row) {
+            const uint64_t key = m_cache->get_key(texts[row]);
+            void* row_data = results ? static_cast<uint8_t*>(results.data()) + row * row_byte_size : nullptr;
+            if (m_cache->get(key, row_data, row_byte_size)) {
+                continue;
+            }
+            const auto [it, is_new] = key_to_missed_idx.emplace(key, missed_texts.size());
+            if (is_new) {
+                missed_texts.push_back(texts[row]);
+                missed_keys.push_back(key);
+            }
+            missed_rows.emplace_back(row, it->second);
+        }
+
+        if (missed_texts.empty()) {
+            return results;
+        }
+
+        // [number of missed texts, hidden_size]
+        const ov::Tensor embeddings = embed_texts(missed_texts);
+        if (!results) {
+            results = ov::Tensor(embeddings.get_element_type(), {texts.size(), embeddings.get_shape()[1]});
+        }
+        const size_t embedding_byte_size = embeddings.get_byte_size() / missed_texts.size();
+        const auto* embeddings_data = static_cast<const uint8_t*>(embeddings.data());
+        auto* results_data = static_cast<uint8_t*>(results.data());
+        for (const auto& [row, missed_idx] : missed_rows) {
+            std::memcpy(results_data + row * embedding_byte_size,
+                        embeddings_data + missed_idx * embedding_byte_size,
+                        embedding_byte_size);
+        }
+        for (size_t missed_idx = 0; missed_idx < missed_texts.size(); ++missed_idx) {
+            m_cache->put(missed_keys[missed_idx], embeddings_data + missed_idx * embedding_byte_size, embedding_byte_size);
+        }
+        return results;
+    }
+
+    void set_embeddings_tensor(InferRequest& request, size_t batch_size) {
+        // a new tensor for each inference, previous one may be owned by a caller
+        if (m_embedding_size.has_value()) {
+            request.set_tensor("last_hidden_state", ov::Tensor(m_embeddings_type, {batch_size, *m_embedding_size}));
+        }
+    }
 
+    void set_token_type_ids(InferRequest& request, const ov::Shape& shape) {
         // fill token_type_ids
         // todo: pass token_type_ids from tokenizer
-        if (has_token_type_ids_input(m_request.get_compiled_model().inputs())) {
-            ov::Tensor token_type_ids{ov::element::i64, encoded.input_ids.get_shape()};
-            std::fill_n(token_type_ids.data<int64_t>(), encoded.input_ids.get_size(), 0);
-            m_request.set_tensor("token_type_ids", token_type_ids);
+        if (m_has_token_type_ids) {
+            ov::Tensor token_type_ids{ov::element::i64, shape};
+            std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+            request.set_tensor("token_type_ids", token_type_ids);
         }
+    }
 
-        m_request.start_async();
-    };
+    ov::Tensor embed_micro_batches(const std::vector<std::string>& texts) {
+        const TokenizedTexts tokenized = tokenize_without_padding(texts);
+        const std::vector<MicroBatch> micro_batches = split_into_micro_batches(tokenized);
 
-    EmbeddingResults wait_embed() {
-        m_request.wait();
+        // [number of texts, hidden_size], allocated when the first micro-batch is finished if hidden_size is dynamic
+        ov::Tensor results;
+        if (m_embedding_size.has_value()) {
+            results = ov::Tensor(m_embeddings_type, {texts.size(), *m_embedding_size});
+        }
+        // pairs of request and micro-batch indices in the order of start
+        std::deque<std::pair<int, size_t>> in_flight;
+        std::future<int> idle_request;
+
+        const auto finish_oldest_micro_batch = [&]() {
+            const auto [request_idx, micro_batch_idx] = in_flight.front();
+            InferRequest& request = m_infer_requests->get(request_idx);
+            request.wait();
+
+            // [batch_size, hidden_size]
+            const Tensor last_hidden_state = request.get_tensor("last_hidden_state");
+            if (!results) {
+                results = ov::Tensor(last_hidden_state.get_element_type(), {texts.size(), last_hidden_state.get_shape()[1]});
+            }
+            const auto& text_indices = micro_batches[micro_batch_idx].text_indices;
+            const size_t row_byte_size = last_hidden_state.get_byte_size() / text_indices.size();
+            const auto* last_hidden_state_data = static_cast<const uint8_t*>(last_hidden_state.data());
+            auto* results_data = static_cast<uint8_t*>(results.data());
+            for (size_t row = 0; row < text_indices.size(); ++row) {
+                std::memcpy(results_data + text_indices[row] * row_byte_size,
+                            last_hidden_state_data + row * row_byte_size,
+                            row_byte_size);
+            }
 
-        // [batch_size, hidden_size]
-        const Tensor last_hidden_state = m_request.get_tensor("last_hidden_state");
+            // output is copied, so the request can take the next micro-batch
+            in_flight.pop_front();
+            m_infer_requests->return_to(request_idx);
+        };
+
+        try {
+            for (size_t micro_batch_idx = 0; micro_batch_idx < micro_batches.size(); ++micro_batch_idx) {
+                idle_request = m_infer_requests->get_idle();
+                // requests of this call are returned while it waits for an idle one,
+                // so concurrent calls can't block each other holding a part of the pool
+                while (!in_flight.empty() && idle_request.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    finish_oldest_micro_batch();
+                }
+
+                in_flight.emplace_back(idle_request.get(), micro_batch_idx);
+                start_micro_batch(m_infer_requests->get(in_flight.back().first), micro_batches[micro_batch_idx], tokenized);
+            }
 
-        return to_embedding_result(last_hidden_state);
-    };
+            while (!in_flight.empty()) {
+                finish_oldest_micro_batch();
+            }
+        } catch (...) {
+            // return all requests taken by this call to the pool
+            for (const auto& [request_idx, micro_batch_idx] : in_flight) {
+                try {
+                    m_infer_requests->get(request_idx).wait();
+                } catch (...) {
+                }
+                m_infer_requests->return_to(request_idx);
+            }
+            if (idle_request.valid()) {
+                m_infer_requests->return_to(idle_request.get());
+            }
+            throw;
+        }
+
+        return results;
+    }
+
+    TokenizedTexts tokenize_without_padding(const std::vector<std::string>& texts) {
+        // texts are tokenized by chunks, so padded tokenizer output stays small for any number of texts
+        constexpr size_t TOKENIZATION_CHUNK_SIZE = 256;
+        TokenizedTexts tokenized;
+        tokenized.token_ids.resize(texts.size());
+        for (size_t chunk_start = 0; chunk_start < texts.size(); chunk_start += TOKENIZATION_CHUNK_SIZE) {
+            const size_t chunk_end = std::min(texts.size(), chunk_start + TOKENIZATION_CHUNK_SIZE);
+            const std::vector<std::string> chunk(texts.begin() + chunk_start, texts.begin() + chunk_end);
+            const auto encoded = m_tokenizer.encode(chunk, m_tokenization_params);
+
+            const size_t padded_length = encoded.input_ids.get_shape()[1];
+            const int64_t* input_ids_data = encoded.input_ids.data<int64_t>();
+            const int64_t* attention_mask_data = encoded.attention_mask.data<int64_t>();
+            for (size_t row = 0; row < chunk.size(); ++row) {
+                auto& token_ids = tokenized.token_ids[chunk_start + row];
+                for (size_t pos = row * padded_length; pos < (row + 1) * padded_length; ++pos) {
+                    if (attention_mask_data[pos] != 0) {
+                        token_ids.push_back(input_ids_data[pos]);
+                    }
+                }
+                tokenized.is_left_padding |= !token_ids.empty() && attention_mask_data[row * padded_length] == 0;
+            }
+        }
+        return tokenized;
+    }
+
+    std::vector<MicroBatch> split_into_micro_batches(const TokenizedTexts& tokenized) {
+        const auto& token_ids = tokenized.token_ids;
+        std::vector<size_t> text_indices(token_ids.size());
+        std::iota(text_indices.begin(), text_indices.end(), 0);
+        std::stable_sort(text_indices.begin(), text_indices.end(), [&token_ids](size_t lhs, size_t rhs) {
+            return token_ids[lhs].size() < token_ids[rhs].size();
+        });
+
+        // sequence length is fixed in the model in this case, see reshape_model()
+        const bool is_padded_to_max_length = m_config.max_length.has_value() && m_config.pad_to_max_length.value_or(false);
+        std::vector<MicroBatch> micro_batches;
+        for (size_t text_idx : text_indices) {
+            const size_t length = is_padded_to_max_length ? *m_config.max_length : std::max<size_t>(token_ids[text_idx].size(), 1);
+            // texts are sorted by length, so the added text defines the length of the batch
+            if (!micro_batches.empty() && (micro_batches.back().text_indices.size() + 1) * length <= *m_config.max_batch_tokens) {
+                micro_batches.back().text_indices.push_back(text_idx);
+                micro_batches.back().length = length;
+            } else {
+                micro_batches.push_back({{text_idx}, length});
+            }
+        }
+        return micro_batches;
+    }
+
+    void start_micro_batch(InferRequest& request, const MicroBatch& micro_batch, const TokenizedTexts& tokenized) {
+        const ov::Shape shape{micro_batch.text_indices.size(), micro_batch.length};
+        ov::Tensor input_ids{ov::element::i64, shape};
+        ov::Tensor attention_mask{ov::element::i64, shape};
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), m_tokenizer.get_pad_token_id());
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+
+        for (size_t row = 0; row < micro_batch.text_indices.size(); ++row) {
+            const auto& token_ids = tokenized.token_ids[micro_batch.text_indices[row]];
+            const size_t offset = row * micro_batch.length + (tokenized.is_left_padding ? micro_batch.length - token_ids.size() : 0);
+            std::copy(token_ids.begin(), token_ids.end(), input_ids.data<int64_t>() + offset);
+            std::fill_n(attention_mask.data<int64_t>() + offset, token_ids.size(), 1);
+        }
+
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+        set_token_type_ids(request, shape);
+        set_embeddings_tensor(request, micro_batch.text_indices.size());
+        request.start_async();
+    }
 
     std::vector<std::string> format_texts(const std::vector<std::string>& texts) {
         if (!m_config.embed_instruction) {
@@ -340,20 +749,32 @@ private:
         return *m_config.query_instruction + text;
     }
 
-    EmbeddingResults to_embedding_result(const Tensor& last_hidden_state) {
-        const float* last_hidden_state_data = last_hidden_state.data<float>();
+    EmbeddingResults to_embedding_result(const Tensor& embeddings) {
+        const ov::element::Type type = embeddings.get_element_type();
+        if (type == ov::element::f32) {
+            return to_vectors<float>(embeddings);
+        } else if (type == ov::element::i8) {
+            return to_vectors<int8_t>(embeddings);
+        } else if (type == ov::element::u8) {
+            return to_vectors<uint8_t>(embeddings);
+        }
+        OPENVINO_THROW("Embedding output type ", type, " is not supported");
+    }
+
+    template <typename T>
+    std::vector<std::vector<T>> to_vectors(const Tensor& embeddings) {
+        const T* embeddings_data = embeddings.data<T>();
 
-        std::vector<std::vector<float>> result;
-        const auto shape = last_hidden_state.get_shape();
+        std::vector<std::vector<T>> result;
+        const auto shape = embeddings.get_shape();
 
         const size_t batch_size = shape[0];
         const size_t hidden_size = shape[1];
+        result.reserve(batch_size);
 
         for (size_t batch = 0; batch < batch_size; batch++) {
-            const auto batch_offset = batch * hidden_size;
-            const float* batch_data = last_hidden_state_data + batch_offset;
-            const std::vector<float> batch_result(batch_data, batch_data + hidden_size);
-            result.push_back(batch_result);
+            const T* batch_data = embeddings_data + batch * hidden_size;
+            result.emplace_back(batch_data, batch_data + hidden_size);
         }
 
         return result;
@@ -387,6 +808,14 @@ EmbeddingResults TextEmbeddingPipeline::wait_embed_documents() {
     return m_impl->wait_embed_documents();
 }
 
+std::future<EmbeddingResults> TextEmbeddingPipeline::embed_documents_async(const std::vector<std::string>& texts) {
+    return m_impl->embed_documents_async(texts);
+}
+
+ov::Tensor TextEmbeddingPipeline::embed_documents_tensor(const std::vector<std::string>& texts) {
+    return m_impl->embed_documents_tensor(texts);
+}
+
 EmbeddingResult TextEmbeddingPipeline::embed_query(const std::string& text) {
     return m_impl->embed_query(text);
 }
@@ -399,6 +828,18 @@ EmbeddingResult TextEmbeddingPipeline::wait_embed_query() {
     return m_impl->wait_embed_query();
 }
 
+std::future<EmbeddingResult> TextEmbeddingPipeline::embed_query_async(const std::string& text) {
+    return m_impl->embed_query_async(text);
+}
+
+void TextEmbeddingPipeline::save_cache() const {
+    m_impl->save_cache();
+}
+
+EmbeddingCacheMetrics TextEmbeddingPipeline::get_cache_metrics() const {
+    return m_impl->get_cache_metrics();
+}
+
 TextEmbeddingPipeline::~TextEmbeddingPipeline() = default;
 
 }  // namespace genai
@@ -3,7 +3,17 @@
 
 #include "openvino/genai/rag/text_rerank_pipeline.hpp"
 
+#include <deque>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <nlohmann/json.hpp>
+#include <numeric>
+
+#include "circular_buffer_queue.hpp"
+#include "json_utils.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
@@ -14,11 +24,22 @@ namespace {
 using namespace ov::genai;
 using namespace ov;
 
+// Qwen3-Reranker prompt, the model answers if a document meets the query with "yes" or "no"
+const std::string DECODER_PROMPT_PREFIX =
+    "<|im_start|>system\nJudge whether the Document meets the requirements based on the Query and the Instruct "
+    "provided. Note that the answer can only be \"yes\" or \"no\".<|im_end|>\n<|im_start|>user\n";
+const std::string DECODER_PROMPT_SUFFIX = "<|im_end|>\n<|im_start|>assistant\n<think>\n\n</think>\n\n";
+const std::string DEFAULT_DECODER_INSTRUCTION =
+    "Given a web search query, retrieve relevant passages that answer the query";
+
 ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     auto properties_copy = properties;
 
     properties_copy.erase(top_n.name());
     properties_copy.erase(max_length.name());
+    properties_copy.erase(max_batch_tokens.name());
+    properties_copy.erase(early_stop_score.name());
+    properties_copy.erase(instruction.name());
 
     return properties_copy;
 }
@@ -50,6 +71,69 @@ std::shared_ptr<Model> apply_postprocessing(std::shared_ptr<Model> model) {
     return processor.build();
 }
 
+std::shared_ptr<Model> apply_decoder_postprocessing(std::shared_ptr<Model> model,
+                                                    int64_t yes_token_id,
+                                                    int64_t no_token_id) {
+    // only logits of the last position are computed, [batch, 1, vocab_size]
+    utils::apply_slice_before_matmul_transformation(model);
+
+    ov::preprocess::PrePostProcessor processor(model);
+
+    processor.output("logits").postprocess().custom(
+        [yes_token_id, no_token_id](const ov::Output<ov::Node>& node) -> std::shared_ptr<ov::Node> {
+            auto indices = std::make_shared<op::v0::Constant>(ov::element::i64,
+                                                              ov::Shape{2},
+                                                              std::vector<int64_t>{no_token_id, yes_token_id});
+            auto gather_axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{2});
+            auto gather = std::make_shared<op::v8::Gather>(node, indices, gather_axis);
+
+            // probability of "yes" among "yes" and "no" answers
+            const auto softmax = std::make_shared<op::v8::Softmax>(gather, 2);
+            auto start = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+            auto stop = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+            auto step = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+            auto axis = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{2});
+            auto slice = std::make_shared<op::v8::Slice>(softmax, start, stop, step, axis);
+
+            // [batch, 1] like scores of cross-encoders
+            auto target_shape = std::make_shared<op::v0::Constant>(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{-1, 1});
+            return std::make_shared<op::v1::Reshape>(slice, target_shape, false);
+        });
+
+    return processor.build();
+}
+
+bool is_decoder_reranker(const std::filesystem::path& models_path) {
+    // config.json not found. Rerank model is considered a cross-encoder.
+    const std::filesystem::path& json_path = models_path / "config.json";
+    if (!std::filesystem::exists(json_path)) {
+        return false;
+    }
+
+    using ov::genai::utils::read_json_param;
+
+    std::ifstream f(json_path);
+    OPENVINO_ASSERT(f.is_open(), "Failed to open '", json_path);
+
+    nlohmann::json data = nlohmann::json::parse(f);
+
+    std::vector<std::string> architectures;
+    read_json_param(data, "architectures", architectures);
+    return std::any_of(architectures.begin(), architectures.end(), [](const std::string& architecture) {
+        return architecture.find("ForCausalLM") != std::string::npos;
+    });
+}
+
+template <typename T>
+bool has_input(const T& inputs, const std::string& name) {
+    for (const auto& input : inputs) {
+        if (input.get_names().count(name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 namespace ov {
@@ -59,21 +143,50 @@ using utils::read_anymap_param;
 TextRerankPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::top_n.name(), top_n);
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
+    read_anymap_param(properties, ov::genai::early_stop_score.name(), early_stop_score);
+    read_anymap_param(properties, ov::genai::instruction.name(), instruction);
 };
 
+void TextRerankPipeline::Config::validate() const {
+    if (max_batch_tokens.has_value()) {
+        OPENVINO_ASSERT(max_batch_tokens.value() > 0, "max_batch_tokens should be greater than 0");
+    }
+
+    OPENVINO_ASSERT(!early_stop_score.has_value() || max_batch_tokens.has_value(),
+                    "early_stop_score requires max_batch_tokens to split texts into micro-batches");
+}
+
 class TextRerankPipeline::TextRerankPipelineImpl {
 public:
     TextRerankPipelineImpl(const std::filesystem::path& models_path,
                            const std::string& device,
                            const Config& config,
                            const ov::AnyMap& properties = {})
-        : m_config{config},
-          m_tokenizer{models_path, ov::AnyMap{ov::genai::add_second_input(true)}} {
+        : m_is_decoder_reranker{is_decoder_reranker(models_path)},
+          // decoder rerankers tokenize a document only, the query is a part of the shared prompt prefix
+          m_tokenizer{models_path,
+                      m_is_decoder_reranker ? ov::AnyMap{} : ov::AnyMap{ov::genai::add_second_input(true)}},
+          m_config{config} {
+        m_config.validate();
+
         ov::Core core = utils::singleton_core();
 
         auto model = core.read_model(models_path / "openvino_model.xml", {}, properties);
 
-        model = apply_postprocessing(model);
+        if (m_is_decoder_reranker) {
+            OPENVINO_ASSERT(has_input(model->inputs(), "beam_idx"),
+                            "Decoder rerank model has to be stateful, export it with KV cache (text-generation-with-past task)");
+            m_has_position_ids = has_input(model->inputs(), "position_ids");
+            m_tokenization_params.insert({add_special_tokens.name(), false});
+
+            model = apply_decoder_postprocessing(model, get_single_token_id("yes"), get_single_token_id("no"));
+
+            const auto suffix = m_tokenizer.encode(DECODER_PROMPT_SUFFIX, m_tokenization_params).input_ids;
+            m_suffix_token_ids.assign(suffix.data<int64_t>(), suffix.data<int64_t>() + suffix.get_size());
+        } else {
+            model = apply_postprocessing(model);
+        }
 
         if (m_config.max_length) {
             m_tokenization_params.insert({max_length.name(), *m_config.max_length});
@@ -82,32 +195,357 @@ public:
         ov::CompiledModel compiled_model = core.compile_model(model, device, properties);
 
         utils::print_compiled_model_properties(compiled_model, "text rerank model");
-        m_request = compiled_model.create_infer_request();
+        m_infer_requests = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
+            std::max<uint32_t>(compiled_model.get_property(ov::optimal_number_of_infer_requests), 1),
+            [&compiled_model]() -> ov::InferRequest {
+                return compiled_model.create_infer_request();
+            });
     };
 
     std::vector<std::pair<size_t, float>> rerank(const std::string& query, const std::vector<std::string>& texts) {
-        start_rerank_async(query, texts);
-        return wait_rerank();
-    }
+        if (m_is_decoder_reranker || m_config.max_batch_tokens.has_value()) {
+            return rerank_micro_batches(query, texts);
+        }
 
-    void start_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
         const auto encoded = m_tokenizer.encode({query}, texts, m_tokenization_params);
 
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
+        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_infer_requests.get());
+        InferRequest& request = infer_request_guard.get();
+        request.set_tensor("input_ids", encoded.input_ids);
+        request.set_tensor("attention_mask", encoded.attention_mask);
 
         if (encoded.token_type_ids.has_value()) {
-            m_request.set_tensor("token_type_ids", *encoded.token_type_ids);
+            request.set_tensor("token_type_ids", *encoded.token_type_ids);
         }
 
-        m_request.start_async();
+        request.infer();
+
+        // postprocessing applied to output, it's the scores tensor
+        return get_top_n(request.get_tensor("logits"));
+    }
+
+    std::future<std::vector<std::pair<size_t, float>>> rerank_async(const std::string& query,
+                                                                    const std::vector<std::string>& texts) {
+        return std::async(std::launch::async, [this, query, texts] {
+            return rerank(query, texts);
+        });
+    }
+
+    void start_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
+        m_rerank_future = rerank_async(query, texts);
     }
 
     std::vector<std::pair<size_t, float>> wait_rerank() {
-        m_request.wait();
+        OPENVINO_ASSERT(m_rerank_future.valid(), "start_rerank_async() has to be called before wait_rerank()");
+        return m_rerank_future.get();
+    }
 
-        // postprocessing applied to output, it's the scores tensor
-        auto scores_tensor = m_request.get_tensor("logits");
+private:
+    // initialized first, the tokenizer depends on the kind of the model
+    bool m_is_decoder_reranker = false;
+    Tokenizer m_tokenizer;
+    Config m_config;
+    AnyMap m_tokenization_params;
+    bool m_has_position_ids = false;
+    // tokens of the prompt after a document, decoder rerankers only
+    std::vector<int64_t> m_suffix_token_ids;
+    // requests are shared by concurrent calls, each call holds a request only while it runs
+    std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_infer_requests;
+    // result of start_rerank_async(), declared last to be waited for before other members are destroyed
+    std::future<std::vector<std::pair<size_t, float>>> m_rerank_future;
+
+    struct MicroBatch {
+        // indices of texts in the order of batch rows
+        std::vector<size_t> text_indices;
+        // padded sequence length of the batch
+        size_t length = 0;
+    };
+
+    // texts tokenized without padding
+    struct TokenizedTexts {
+        std::vector<std::vector<int64_t>> token_ids;
+        // empty if the tokenizer doesn't produce token_type_ids
+        std::vector<std::vector<int64_t>> token_type_ids;
+        bool is_left_padding = false;
+    };
+
+    // KV cache of the prompt prefix shared by all texts of a decoder reranker call
+    struct PrefixState {
+        size_t length = 0;
+        // in the order of InferRequest::query_state()
+        std::vector<ov::Tensor> states;
+    };
+
+    int64_t get_single_token_id(const std::string& text) {
+        const auto token_ids = m_tokenizer.encode(text, m_tokenization_params).input_ids;
+        OPENVINO_ASSERT(token_ids.get_size() == 1, "Decoder rerank model tokenizer has to encode '", text, "' as a single token");
+        return token_ids.data<int64_t>()[0];
+    }
+
+    std::vector<std::pair<size_t, float>> rerank_micro_batches(const std::string& query,
+                                                               const std::vector<std::string>& texts) {
+        if (texts.empty()) {
+            return {};
+        }
+
+        const TokenizedTexts tokenized = tokenize_without_padding(query, texts);
+        const std::vector<MicroBatch> micro_batches = split_into_micro_batches(tokenized);
+        std::optional<PrefixState> prefix;
+        if (m_is_decoder_reranker) {
+            prefix = infer_prefix(query);
+        }
+
+        // scores of texts in the order of scoring
+        std::vector<std::pair<size_t, float>> results;
+        results.reserve(texts.size());
+        // number of texts with score not less than early_stop_score
+        size_t num_early_stop_texts = 0;
+        const auto is_early_stop = [&]() {
+            return m_config.early_stop_score.has_value() && num_early_stop_texts >= m_config.top_n;
+        };
+
+        // pairs of request and micro-batch indices in the order of start
+        std::deque<std::pair<int, size_t>> in_flight;
+        std::future<int> idle_request;
+
+        const auto finish_oldest_micro_batch = [&]() {
+            const auto [request_idx, micro_batch_idx] = in_flight.front();
+            InferRequest& request = m_infer_requests->get(request_idx);
+            request.wait();
+
+            // postprocessing applied to output, it's the scores tensor
+            const Tensor scores_tensor = request.get_tensor("logits");
+            const float* scores_data = scores_tensor.data<float>();
+            const auto& text_indices = micro_batches[micro_batch_idx].text_indices;
+            for (size_t row = 0; row < text_indices.size(); ++row) {
+                results.emplace_back(text_indices[row], scores_data[row]);
+                if (m_config.early_stop_score.has_value() && scores_data[row] >= *m_config.early_stop_score) {
+                    ++num_early_stop_texts;
+                }
+            }
+
+            // scores are copied, so the request can take the next micro-batch
+            in_flight.pop_front();
+            m_infer_requests->return_to(request_idx);
+        };
+
+        try {
+            for (size_t micro_batch_idx = 0; micro_batch_idx < micro_batches.size() && !is_early_stop(); ++micro_batch_idx) {
+                idle_request = m_infer_requests->get_idle();
+                // requests of this call are returned while it waits for an idle one,
+                // so concurrent calls can't block each other holding a part of the pool
+                while (!in_flight.empty() && idle_request.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                    finish_oldest_micro_batch();
+                }
+
+                const int request_idx = idle_request.get();
+                if (is_early_stop()) {
+                    m_infer_requests->return_to(request_idx);
+                    break;
+                }
+                in_flight.emplace_back(request_idx, micro_batch_idx);
+                start_micro_batch(m_infer_requests->get(request_idx), micro_batches[micro_batch_idx], tokenized, prefix);
+            }
+
+            while (!in_flight.empty()) {
+                finish_oldest_micro_batch();
+            }
+        } catch (...) {
+            // return all requests taken by this call to the pool
+            for (const auto& [request_idx, micro_batch_idx] : in_flight) {
+                try {
+                    m_infer_requests->get(request_idx).wait();
+                } catch (...) {
+                }
+                m_infer_requests->return_to(request_idx);
+            }
+            if (idle_request.valid()) {
+                m_infer_requests->return_to(idle_request.get());
+            }
+            throw;
+        }
+
+        return select_top_n(std::move(results));
+    }
+
+    TokenizedTexts tokenize_without_padding(const std::string& query, const std::vector<std::string>& texts) {
+        // texts are tokenized by chunks, so padded tokenizer output stays small for any number of texts
+        constexpr size_t TOKENIZATION_CHUNK_SIZE = 256;
+        TokenizedTexts tokenized;
+        tokenized.token_ids.resize(texts.size());
+        for (size_t chunk_start = 0; chunk_start < texts.size(); chunk_start += TOKENIZATION_CHUNK_SIZE) {
+            const size_t chunk_end = std::min(texts.size(), chunk_start + TOKENIZATION_CHUNK_SIZE);
+            const std::vector<std::string> chunk(texts.begin() + chunk_start, texts.begin() + chunk_end);
+            // the query of decoder rerankers is in the prompt prefix
+            const auto encoded = m_is_decoder_reranker ? m_tokenizer.encode(chunk, m_tokenization_params)
+                                                       : m_tokenizer.encode({query}, chunk, m_tokenization_params);
+
+            const size_t padded_length = encoded.input_ids.get_shape()[1];
+            const int64_t* input_ids_data = encoded.input_ids.data<int64_t>();
+            const int64_t* attention_mask_data = encoded.attention_mask.data<int64_t>();
+            const int64_t* token_type_ids_data = nullptr;
+            if (encoded.token_type_ids.has_value() && !m_is_decoder_reranker) {
+                token_type_ids_data = encoded.token_type_ids->data<int64_t>();
+                tokenized.token_type_ids.resize(texts.size());
+            }
+            for (size_t row = 0; row < chunk.size(); ++row) {
+                auto& token_ids = tokenized.token_ids[chunk_start + row];
+                for (size_t pos = row * padded_length; pos < (row + 1) * padded_length; ++pos) {
+                    if (attention_mask_data[pos] != 0) {
+                        token_ids.push_back(input_ids_data[pos]);
+                        if (token_type_ids_data) {
+                            tokenized.token_type_ids[chunk_start + row].push_back(token_type_ids_data[pos]);
+                        }
+                    }
+                }
+                tokenized.is_left_padding |= !token_ids.empty() && attention_mask_data[row * padded_length] == 0;
+                token_ids.insert(token_ids.end(), m_suffix_token_ids.begin(), m_suffix_token_ids.end());
+            }
+        }
+        // decoder rerankers score the last position, which has to be a text token in every row
+        tokenized.is_left_padding |= m_is_decoder_reranker;
+        return tokenized;
+    }
+
+    std::vector<MicroBatch> split_into_micro_batches(const TokenizedTexts& tokenized) {
+        const auto& token_ids = tokenized.token_ids;
+        std::vector<size_t> text_indices(token_ids.size());
+        std::iota(text_indices.begin(), text_indices.end(), 0);
+        // early stop relies on the given order of texts, e.g. by retrieval score
+        if (!m_config.early_stop_score.has_value()) {
+            std::stable_sort(text_indices.begin(), text_indices.end(), [&token_ids](size_t lhs, size_t rhs) {
+                return token_ids[lhs].size() < token_ids[rhs].size();
+            });
+        }
+
+        // all texts are in one batch if max_batch_tokens is not set, e.g. for decoder rerankers
+        const size_t max_batch_tokens = m_config.max_batch_tokens.value_or(std::numeric_limits<size_t>::max());
+        std::vector<MicroBatch> micro_batches;
+        for (size_t text_idx : text_indices) {
+            const size_t length = std::max<size_t>(token_ids[text_idx].size(), 1);
+            if (!micro_batches.empty()) {
+                MicroBatch& micro_batch = micro_batches.back();
+                const size_t batch_length = std::max(micro_batch.length, length);
+                if (batch_length <= max_batch_tokens / (micro_batch.text_indices.size() + 1)) {
+                    micro_batch.text_indices.push_back(text_idx);
+                    micro_batch.length = batch_length;
+                    continue;
+                }
+            }
+            micro_batches.push_back({{text_idx}, length});
+        }
+        return micro_batches;
+    }
+
+    PrefixState infer_prefix(const std::string& query) {
+        const std::string prefix = DECODER_PROMPT_PREFIX +
+                                   "<Instruct>: " + m_config.instruction.value_or(DEFAULT_DECODER_INSTRUCTION) +
+                                   "\n<Query>: " + query + "\n<Document>: ";
+        const auto encoded = m_tokenizer.encode(prefix, ov::AnyMap{add_special_tokens(false)});
+        const size_t length = encoded.input_ids.get_shape()[1];
+
+        CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_infer_requests.get());
+        InferRequest& request = infer_request_guard.get();
+        request.reset_state();
+        request.set_tensor("input_ids", encoded.input_ids);
+        request.set_tensor("attention_mask", encoded.attention_mask);
+        if (m_has_position_ids) {
+            ov::Tensor position_ids{ov::element::i64, {1, length}};
+            std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + length, 0);
+            request.set_tensor("position_ids", position_ids);
+        }
+        ov::Tensor beam_idx{ov::element::i32, {1}};
+        beam_idx.data<int32_t>()[0] = 0;
+        request.set_tensor("beam_idx", beam_idx);
+
+        request.infer();
+
+        // states of the request are overwritten by the next inference
+        PrefixState prefix_state{length, {}};
+        for (auto& state : request.query_state()) {
+            const ov::Tensor state_tensor = state.get_state();
+            ov::Tensor state_copy(state_tensor.get_element_type(), state_tensor.get_shape());
+            state_tensor.copy_to(state_copy);
+            prefix_state.states.push_back(state_copy);
+        }
+        return prefix_state;
+    }
+
+    void start_micro_batch(InferRequest& request,
+                           const MicroBatch& micro_batch,
+                           const TokenizedTexts& tokenized,
+                           const std::optional<PrefixState>& prefix) {
+        const size_t batch_size = micro_batch.text_indices.size();
+        const size_t prefix_length = prefix.has_value() ? prefix->length : 0;
+        const ov::Shape shape{batch_size, micro_batch.length};
+        // attention mask of decoder rerankers covers the prefix in KV cache
+        const size_t attention_mask_length = prefix_length + micro_batch.length;
+
+        ov::Tensor input_ids{ov::element::i64, shape};
+        ov::Tensor attention_mask{ov::element::i64, {batch_size, attention_mask_length}};
+        std::fill_n(input_ids.data<int64_t>(), input_ids.get_size(), m_tokenizer.get_pad_token_id());
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 0);
+
+        ov::Tensor token_type_ids;
+        if (!tokenized.token_type_ids.empty()) {
+            token_type_ids = ov::Tensor{ov::element::i64, shape};
+            std::fill_n(token_type_ids.data<int64_t>(), token_type_ids.get_size(), 0);
+        }
+
+        ov::Tensor position_ids;
+        if (prefix.has_value() && m_has_position_ids) {
+            position_ids = ov::Tensor{ov::element::i64, shape};
+            std::fill_n(position_ids.data<int64_t>(), position_ids.get_size(), prefix_length);
+        }
+
+        for (size_t row = 0; row < batch_size; ++row) {
+            const size_t text_idx = micro_batch.text_indices[row];
+            const auto& token_ids = tokenized.token_ids[text_idx];
+            const size_t padding = tokenized.is_left_padding ? micro_batch.length - token_ids.size() : 0;
+            const size_t offset = row * micro_batch.length + padding;
+            std::copy(token_ids.begin(), token_ids.end(), input_ids.data<int64_t>() + offset);
+
+            int64_t* attention_mask_row = attention_mask.data<int64_t>() + row * attention_mask_length;
+            std::fill_n(attention_mask_row, prefix_length, 1);
+            std::fill_n(attention_mask_row + prefix_length + padding, token_ids.size(), 1);
+
+            if (token_type_ids) {
+                const auto& text_token_type_ids = tokenized.token_type_ids[text_idx];
+                std::copy(text_token_type_ids.begin(), text_token_type_ids.end(), token_type_ids.data<int64_t>() + offset);
+            }
+            if (position_ids) {
+                // text continues the prefix, padding between them is masked
+                std::iota(position_ids.data<int64_t>() + offset,
+                          position_ids.data<int64_t>() + offset + token_ids.size(),
+                          static_cast<int64_t>(prefix_length));
+            }
+        }
+
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+        if (token_type_ids) {
+            request.set_tensor("token_type_ids", token_type_ids);
+        }
+        if (position_ids) {
+            request.set_tensor("position_ids", position_ids);
+        }
+
+        if (prefix.has_value()) {
+            auto states = request.query_state();
+            OPENVINO_ASSERT(states.size() == prefix->states.size(), "Unexpected number of states of decoder rerank model");
+            for (size_t i = 0; i < states.size(); ++i) {
+                states[i].set_state(prefix->states[i]);
+            }
+            // KV cache has a single row of the prefix, it's repeated for every text of the batch
+            ov::Tensor beam_idx{ov::element::i32, {batch_size}};
+            std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
+            request.set_tensor("beam_idx", beam_idx);
+        }
+
+        request.start_async();
+    }
+
+    std::vector<std::pair<size_t, float>> get_top_n(const Tensor& scores_tensor) {
         auto scores_tensor_shape = scores_tensor.get_shape();
         const size_t batch_size = scores_tensor_shape[0];
 
@@ -120,6 +558,10 @@ public:
             results.emplace_back(batch, scores_data[batch]);
         }
 
+        return select_top_n(std::move(results));
+    }
+
+    std::vector<std::pair<size_t, float>> select_top_n(std::vector<std::pair<size_t, float>> results) {
         const size_t top_n = m_config.top_n;
 
         // partial sort to get top_n results
@@ -136,12 +578,6 @@ public:
 
         return results;
     }
-
-private:
-    Tokenizer m_tokenizer;
-    InferRequest m_request;
-    Config m_config;
-    AnyMap m_tokenization_params;
 };
 
 TextRerankPipeline::TextRerankPipeline(const std::filesystem::path& models_path,
@@ -171,6 +607,12 @@ std::vector<std::pair<size_t, float>> TextRerankPipeline::wait_rerank() {
     return m_impl->wait_rerank();
 }
 
+std::future<std::vector<std::pair<size_t, float>>> TextRerankPipeline::rerank_async(
+    const std::string& query,
+    const std::vector<std::string>& texts) {
+    return m_impl->rerank_async(query, texts);
+}
+
 TextRerankPipeline::~TextRerankPipeline() = default;
 
 }  // namespace genai
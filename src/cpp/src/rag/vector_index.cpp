@@ -0,0 +1,635 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/rag/vector_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "openvino/core/except.hpp"
+#include "rag/distance.hpp"
+
+namespace {
+using namespace ov::genai;
+
+constexpr char FILE_MAGIC[8] = {'O', 'V', 'G', 'V', 'I', 'D', 'X', '\0'};
+constexpr uint32_t FILE_VERSION = 1;
+// vectors are mapped from the file, so their offset is aligned for any element type
+constexpr uint64_t VECTORS_ALIGNMENT = 64;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t element_type;
+    uint32_t metric;
+    int32_t max_level;
+    uint64_t dimension;
+    uint64_t max_neighbours;
+    uint64_t ef_construction;
+    uint64_t ef_search;
+    uint64_t num_nodes;
+    uint64_t entry_point;
+    uint64_t vectors_offset;
+    uint64_t graph_offset;
+};
+
+uint32_t to_file_element_type(const ov::element::Type& element_type) {
+    if (element_type == ov::element::f32) {
+        return 0;
+    } else if (element_type == ov::element::i8) {
+        return 1;
+    } else if (element_type == ov::element::u8) {
+        return 2;
+    }
+    OPENVINO_THROW("Vector index element type ", element_type, " is not supported");
+}
+
+ov::element::Type from_file_element_type(uint32_t element_type) {
+    switch (element_type) {
+    case 0:
+        return ov::element::f32;
+    case 1:
+        return ov::element::i8;
+    case 2:
+        return ov::element::u8;
+    default:
+        OPENVINO_THROW("Vector index file has unknown element type ", element_type);
+    }
+}
+
+using DistanceFunction = float (*)(const void*, const void*, size_t);
+
+// distances are "lower is closer" for all metrics
+DistanceFunction get_distance_function(const VectorIndex::Config& config) {
+    using distance::hamming;
+    using distance::inner_product_f32;
+    using distance::inner_product_i8;
+    using distance::l2_squared_f32;
+    using distance::l2_squared_i8;
+
+    if (config.metric == VectorIndex::Metric::HAMMING) {
+        return [](const void* lhs, const void* rhs, size_t size) {
+            return static_cast<float>(hamming(static_cast<const uint8_t*>(lhs), static_cast<const uint8_t*>(rhs), size));
+        };
+    }
+    if (config.element_type == ov::element::f32) {
+        if (config.metric == VectorIndex::Metric::INNER_PRODUCT) {
+            return [](const void* lhs, const void* rhs, size_t size) {
+                return -inner_product_f32(static_cast<const float*>(lhs), static_cast<const float*>(rhs), size);
+            };
+        }
+        return [](const void* lhs, const void* rhs, size_t size) {
+            return l2_squared_f32(static_cast<const float*>(lhs), static_cast<const float*>(rhs), size);
+        };
+    }
+    if (config.metric == VectorIndex::Metric::INNER_PRODUCT) {
+        return [](const void* lhs, const void* rhs, size_t size) {
+            return static_cast<float>(-inner_product_i8(static_cast<const int8_t*>(lhs), static_cast<const int8_t*>(rhs), size));
+        };
+    }
+    return [](const void* lhs, const void* rhs, size_t size) {
+        return static_cast<float>(l2_squared_i8(static_cast<const int8_t*>(lhs), static_cast<const int8_t*>(rhs), size));
+    };
+}
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(const uint8_t* data, size_t size, size_t& offset) {
+    OPENVINO_ASSERT(offset + sizeof(T) <= size, "Vector index file is truncated");
+    T value;
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+void VectorIndex::Config::validate() const {
+    OPENVINO_ASSERT(element_type == ov::element::f32 || element_type == ov::element::i8 || element_type == ov::element::u8,
+                    "Vector index supports f32, i8 and u8 element types, got ",
+                    element_type);
+    OPENVINO_ASSERT((metric == Metric::HAMMING) == (element_type == ov::element::u8),
+                    "HAMMING metric is used with u8 element type, other metrics with f32 and i8 element types");
+    OPENVINO_ASSERT(max_neighbours > 1, "max_neighbours should be greater than 1");
+    OPENVINO_ASSERT(ef_construction > 0, "ef_construction should be greater than 0");
+    OPENVINO_ASSERT(ef_search > 0, "ef_search should be greater than 0");
+}
+
+class VectorIndex::VectorIndexImpl {
+public:
+    VectorIndexImpl(size_t dimension, const Config& config) : m_dimension{dimension}, m_config{config} {
+        OPENVINO_ASSERT(m_dimension > 0, "Vector index dimension should be greater than 0");
+        m_config.validate();
+        init();
+    }
+
+    explicit VectorIndexImpl(const std::filesystem::path& path) {
+        // the whole file is mapped, vectors are used in place and the graph is read to memory
+        m_mapped_file = ov::read_tensor_data(path);
+        m_mapped_path = path;
+        const auto* data = static_cast<const uint8_t*>(m_mapped_file.data());
+        const size_t size = m_mapped_file.get_byte_size();
+
+        size_t offset = 0;
+        const auto header = read_value<FileHeader>(data, size, offset);
+        OPENVINO_ASSERT(std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0, path, " is not a vector index file");
+        OPENVINO_ASSERT(header.version == FILE_VERSION, "Vector index file version ", header.version, " is not supported");
+
+        OPENVINO_ASSERT(header.metric <= static_cast<uint32_t>(Metric::HAMMING),
+                        "Vector index file has unknown metric ",
+                        header.metric);
+        // each vector takes at least one byte of the file, so the checks below don't overflow
+        OPENVINO_ASSERT(header.dimension > 0 && header.dimension <= size, "Vector index file is corrupted");
+        m_dimension = header.dimension;
+        m_config.element_type = from_file_element_type(header.element_type);
+        m_config.metric = static_cast<Metric>(header.metric);
+        m_config.max_neighbours = header.max_neighbours;
+        m_config.ef_construction = header.ef_construction;
+        m_config.ef_search = header.ef_search;
+        m_config.validate();
+        init();
+
+        const size_t num_nodes = header.num_nodes;
+        OPENVINO_ASSERT(num_nodes <= std::numeric_limits<uint32_t>::max() &&
+                            header.vectors_offset % VECTORS_ALIGNMENT == 0 && header.vectors_offset <= header.graph_offset &&
+                            header.graph_offset <= size &&
+                            num_nodes <= (header.graph_offset - header.vectors_offset) / m_vector_byte_size,
+                        "Vector index file is corrupted");
+        // id, removed flag, level and number of links on level 0 are stored for each node
+        constexpr size_t MIN_NODE_BYTE_SIZE = sizeof(uint64_t) + sizeof(uint8_t) + 2 * sizeof(uint32_t);
+        OPENVINO_ASSERT(num_nodes <= (size - header.graph_offset) / MIN_NODE_BYTE_SIZE, "Vector index file is truncated");
+        OPENVINO_ASSERT(num_nodes == 0 ? header.max_level == -1
+                                       : header.max_level >= 0 && header.entry_point < num_nodes,
+                        "Vector index file is corrupted");
+        m_mapped_vectors = data + header.vectors_offset;
+        m_num_mapped_nodes = num_nodes;
+
+        offset = header.graph_offset;
+        m_ids.reserve(num_nodes);
+        m_is_removed.reserve(num_nodes);
+        m_links.reserve(num_nodes);
+        for (size_t node = 0; node < num_nodes; ++node) {
+            const auto id = read_value<uint64_t>(data, size, offset);
+            const auto is_removed = read_value<uint8_t>(data, size, offset);
+            const auto level = read_value<uint32_t>(data, size, offset);
+            OPENVINO_ASSERT(level <= static_cast<uint32_t>(header.max_level),
+                            "Vector index file is corrupted: node ",
+                            node,
+                            " level ",
+                            level,
+                            " exceeds max level ",
+                            header.max_level);
+
+            m_ids.push_back(id);
+            m_is_removed.push_back(is_removed);
+            if (!is_removed) {
+                OPENVINO_ASSERT(m_id_to_node.emplace(id, static_cast<uint32_t>(node)).second,
+                                "Vector index file is corrupted: id ",
+                                id,
+                                " is duplicated");
+            }
+
+            auto& node_links = m_links.emplace_back(level + 1);
+            for (auto& level_links : node_links) {
+                const auto num_links = read_value<uint32_t>(data, size, offset);
+                OPENVINO_ASSERT(num_links <= (size - offset) / sizeof(uint32_t), "Vector index file is truncated");
+                level_links.resize(num_links);
+                std::memcpy(level_links.data(), data + offset, num_links * sizeof(uint32_t));
+                offset += num_links * sizeof(uint32_t);
+                OPENVINO_ASSERT(std::all_of(level_links.begin(),
+                                            level_links.end(),
+                                            [num_nodes](uint32_t link) {
+                                                return link < num_nodes;
+                                            }),
+                                "Vector index file is corrupted: node ",
+                                node,
+                                " links to a missing node");
+            }
+        }
+        OPENVINO_ASSERT(num_nodes == 0 || m_links[header.entry_point].size() == static_cast<size_t>(header.max_level) + 1,
+                        "Vector index file is corrupted: entry point is not on max level");
+
+        m_max_level = header.max_level;
+        m_entry_point = static_cast<uint32_t>(header.entry_point);
+    }
+
+    void add(const std::vector<size_t>& ids, const ov::Tensor& vectors) {
+        OPENVINO_ASSERT(vectors.get_element_type() == m_config.element_type,
+                        "Vectors element type ",
+                        vectors.get_element_type(),
+                        " doesn't match index element type ",
+                        m_config.element_type);
+        const ov::Shape shape = vectors.get_shape();
+        OPENVINO_ASSERT(shape.size() == 2 && shape[0] == ids.size() && shape[1] == m_dimension,
+                        "Vectors shape ",
+                        shape,
+                        " doesn't match [",
+                        ids.size(),
+                        ", ",
+                        m_dimension,
+                        "]");
+
+        // all ids are checked before the first insertion, so the index is unchanged if any of them is rejected
+        std::unordered_set<size_t> unique_ids;
+        unique_ids.reserve(ids.size());
+        for (size_t id : ids) {
+            OPENVINO_ASSERT(unique_ids.insert(id).second, "Vector id ", id, " is duplicated in the added vectors");
+        }
+
+        std::unique_lock lock(m_mutex);
+        for (size_t id : ids) {
+            OPENVINO_ASSERT(m_id_to_node.count(id) == 0, "Vector with id ", id, " is already in the index");
+        }
+        OPENVINO_ASSERT(m_ids.size() + ids.size() <= std::numeric_limits<uint32_t>::max(), "Vector index is full");
+
+        const auto* vectors_data = static_cast<const uint8_t*>(vectors.data());
+        for (size_t row = 0; row < ids.size(); ++row) {
+            const uint32_t node = static_cast<uint32_t>(m_ids.size());
+            m_added_vectors.insert(m_added_vectors.end(),
+                                   vectors_data + row * m_vector_byte_size,
+                                   vectors_data + (row + 1) * m_vector_byte_size);
+            m_ids.push_back(ids[row]);
+            m_is_removed.push_back(0);
+            m_id_to_node.emplace(ids[row], node);
+            insert(node);
+        }
+    }
+
+    void remove(const std::vector<size_t>& ids) {
+        std::unique_lock lock(m_mutex);
+        for (size_t id : ids) {
+            auto it = m_id_to_node.find(id);
+            OPENVINO_ASSERT(it != m_id_to_node.end(), "Vector with id ", id, " is not in the index");
+            m_is_removed[it->second] = 1;
+            m_id_to_node.erase(it);
+        }
+    }
+
+    std::vector<std::pair<size_t, float>> search(const void* query, size_t k) const {
+        std::shared_lock lock(m_mutex);
+        if (m_id_to_node.empty() || k == 0) {
+            return {};
+        }
+
+        const uint32_t entry_point = greedy_search(query, m_entry_point, m_max_level, 0);
+        const auto candidates = search_layer(query, entry_point, std::max(m_config.ef_search, k), 0, true);
+
+        std::vector<std::pair<size_t, float>> results;
+        results.reserve(std::min(k, candidates.size()));
+        for (size_t i = 0; i < candidates.size() && results.size() < k; ++i) {
+            results.emplace_back(m_ids[candidates[i].second], -candidates[i].first);
+        }
+        return results;
+    }
+
+    void check_query(const ov::element::Type& element_type, size_t size) const {
+        OPENVINO_ASSERT(element_type == m_config.element_type,
+                        "Query element type ",
+                        element_type,
+                        " doesn't match index element type ",
+                        m_config.element_type);
+        OPENVINO_ASSERT(size == m_dimension, "Query size ", size, " doesn't match index dimension ", m_dimension);
+    }
+
+    void save(const std::filesystem::path& path) {
+        {
+            // a mapped file can't be replaced on Windows, so the vectors are moved to memory and the mapping is dropped
+            std::unique_lock lock(m_mutex);
+            if (is_mapped_from(path)) {
+                unmap();
+            }
+        }
+        std::shared_lock lock(m_mutex);
+
+        // the file is replaced after it's written, so a failed save doesn't corrupt the existing index
+        std::filesystem::path tmp_path = path;
+        tmp_path += ".tmp";
+        std::ofstream file(tmp_path, std::ios::binary);
+        OPENVINO_ASSERT(file.is_open(), "Failed to open ", tmp_path, " for writing");
+
+        FileHeader header{};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.element_type = to_file_element_type(m_config.element_type);
+        header.metric = static_cast<uint32_t>(m_config.metric);
+        header.max_level = m_max_level;
+        header.dimension = m_dimension;
+        header.max_neighbours = m_config.max_neighbours;
+        header.ef_construction = m_config.ef_construction;
+        header.ef_search = m_config.ef_search;
+        header.num_nodes = m_ids.size();
+        header.entry_point = m_entry_point;
+        header.vectors_offset = (sizeof(FileHeader) + VECTORS_ALIGNMENT - 1) / VECTORS_ALIGNMENT * VECTORS_ALIGNMENT;
+        header.graph_offset = header.vectors_offset + m_ids.size() * m_vector_byte_size;
+        write_value(file, header);
+
+        const std::vector<char> padding(header.vectors_offset - sizeof(FileHeader), 0);
+        file.write(padding.data(), padding.size());
+        if (m_num_mapped_nodes > 0) {
+            file.write(reinterpret_cast<const char*>(m_mapped_vectors), m_num_mapped_nodes * m_vector_byte_size);
+        }
+        file.write(reinterpret_cast<const char*>(m_added_vectors.data()), m_added_vectors.size());
+
+        for (size_t node = 0; node < m_ids.size(); ++node) {
+            write_value(file, static_cast<uint64_t>(m_ids[node]));
+            write_value(file, m_is_removed[node]);
+            write_value(file, static_cast<uint32_t>(m_links[node].size() - 1));
+            for (const auto& level_links : m_links[node]) {
+                write_value(file, static_cast<uint32_t>(level_links.size()));
+                file.write(reinterpret_cast<const char*>(level_links.data()), level_links.size() * sizeof(uint32_t));
+            }
+        }
+        file.close();
+        OPENVINO_ASSERT(file.good(), "Failed to write vector index to ", tmp_path);
+        std::filesystem::rename(tmp_path, path);
+    }
+
+    size_t size() const {
+        std::shared_lock lock(m_mutex);
+        return m_id_to_node.size();
+    }
+
+    size_t get_dimension() const {
+        return m_dimension;
+    }
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    // distance and node index
+    using Candidate = std::pair<float, uint32_t>;
+
+    size_t m_dimension = 0;
+    Config m_config;
+    size_t m_vector_byte_size = 0;
+    DistanceFunction m_distance = nullptr;
+    double m_level_multiplier = 0.0;
+    std::mt19937 m_random_engine{42};
+
+    // vectors of the first m_num_mapped_nodes nodes are in the file the index is loaded from, others in m_added_vectors
+    ov::Tensor m_mapped_file;
+    std::filesystem::path m_mapped_path;
+    const uint8_t* m_mapped_vectors = nullptr;
+    size_t m_num_mapped_nodes = 0;
+    std::vector<uint8_t> m_added_vectors;
+
+    std::vector<size_t> m_ids;
+    std::vector<uint8_t> m_is_removed;
+    std::unordered_map<size_t, uint32_t> m_id_to_node;
+    // neighbours of nodes by levels of the graph
+    std::vector<std::vector<std::vector<uint32_t>>> m_links;
+    int32_t m_max_level = -1;
+    uint32_t m_entry_point = 0;
+
+    mutable std::shared_mutex m_mutex;
+
+    void init() {
+        m_vector_byte_size = m_dimension * m_config.element_type.size();
+        m_distance = get_distance_function(m_config);
+        m_level_multiplier = 1.0 / std::log(static_cast<double>(m_config.max_neighbours));
+    }
+
+    bool is_mapped_from(const std::filesystem::path& path) const {
+        std::error_code error;
+        return m_mapped_file && std::filesystem::equivalent(path, m_mapped_path, error);
+    }
+
+    void unmap() {
+        std::vector<uint8_t> vectors(m_mapped_vectors, m_mapped_vectors + m_num_mapped_nodes * m_vector_byte_size);
+        vectors.insert(vectors.end(), m_added_vectors.begin(), m_added_vectors.end());
+        m_added_vectors = std::move(vectors);
+        m_mapped_vectors = nullptr;
+        m_num_mapped_nodes = 0;
+        m_mapped_file = {};
+        m_mapped_path.clear();
+    }
+
+    const uint8_t* get_vector(uint32_t node) const {
+        if (node < m_num_mapped_nodes) {
+            return m_mapped_vectors + node * m_vector_byte_size;
+        }
+        return m_added_vectors.data() + (node - m_num_mapped_nodes) * m_vector_byte_size;
+    }
+
+    float get_distance(const void* query, uint32_t node) const {
+        return m_distance(query, get_vector(node), m_dimension);
+    }
+
+    size_t get_max_links(size_t level) const {
+        return level == 0 ? 2 * m_config.max_neighbours : m_config.max_neighbours;
+    }
+
+    int32_t get_random_level() {
+        // levels are distributed exponentially, so each level has max_neighbours times less nodes than the one below
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        return static_cast<int32_t>(-std::log(1.0 - distribution(m_random_engine)) * m_level_multiplier);
+    }
+
+    // moves to the closest node on each level from level_from down to level_to, exclusive
+    uint32_t greedy_search(const void* query, uint32_t entry_point, int32_t level_from, int32_t level_to) const {
+        uint32_t current = entry_point;
+        float current_distance = get_distance(query, current);
+        for (int32_t level = level_from; level > level_to; --level) {
+            bool is_changed = true;
+            while (is_changed) {
+                is_changed = false;
+                for (uint32_t neighbour : m_links[current][level]) {
+                    const float distance = get_distance(query, neighbour);
+                    if (distance < current_distance) {
+                        current_distance = distance;
+                        current = neighbour;
+                        is_changed = true;
+                    }
+                }
+            }
+        }
+        return current;
+    }
+
+    // returns up to ef closest nodes on the level sorted by distance
+    std::vector<Candidate> search_layer(const void* query,
+                                        uint32_t entry_point,
+                                        size_t ef,
+                                        int32_t level,
+                                        bool skip_removed) const {
+        std::vector<bool> is_visited(m_ids.size(), false);
+        // closest candidate on top
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+        // farthest result on top
+        std::priority_queue<Candidate> results;
+
+        const float entry_distance = get_distance(query, entry_point);
+        candidates.emplace(entry_distance, entry_point);
+        if (!skip_removed || !m_is_removed[entry_point]) {
+            results.emplace(entry_distance, entry_point);
+        }
+        is_visited[entry_point] = true;
+
+        while (!candidates.empty()) {
+            const auto [distance, node] = candidates.top();
+            // removed nodes are still traversed, so search continues until enough results are found
+            if (results.size() >= ef && distance > results.top().first) {
+                break;
+            }
+            candidates.pop();
+
+            for (uint32_t neighbour : m_links[node][level]) {
+                if (is_visited[neighbour]) {
+                    continue;
+                }
+                is_visited[neighbour] = true;
+
+                const float neighbour_distance = get_distance(query, neighbour);
+                if (results.size() < ef || neighbour_distance < results.top().first) {
+                    candidates.emplace(neighbour_distance, neighbour);
+                    if (!skip_removed || !m_is_removed[neighbour]) {
+                        results.emplace(neighbour_distance, neighbour);
+                        if (results.size() > ef) {
+                            results.pop();
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<Candidate> sorted_results(results.size());
+        for (size_t i = sorted_results.size(); i > 0; --i) {
+            sorted_results[i - 1] = results.top();
+            results.pop();
+        }
+        return sorted_results;
+    }
+
+    // heuristic of HNSW paper: a candidate is skipped if it's closer to an already selected neighbour than to the base
+    // node, which keeps links in different directions and the graph connected for clustered data
+    std::vector<uint32_t> select_neighbours(const std::vector<Candidate>& sorted_candidates, size_t max_neighbours) const {
+        std::vector<uint32_t> neighbours;
+        neighbours.reserve(max_neighbours);
+        for (const auto& [distance, candidate] : sorted_candidates) {
+            if (neighbours.size() >= max_neighbours) {
+                break;
+            }
+            const uint8_t* candidate_vector = get_vector(candidate);
+            const bool is_diverse = std::all_of(neighbours.begin(), neighbours.end(), [&](uint32_t neighbour) {
+                return m_distance(candidate_vector, get_vector(neighbour), m_dimension) >= distance;
+            });
+            if (is_diverse) {
+                neighbours.push_back(candidate);
+            }
+        }
+        return neighbours;
+    }
+
+    void insert(uint32_t node) {
+        const int32_t level = get_random_level();
+        m_links.emplace_back(level + 1);
+
+        if (m_max_level < 0) {
+            m_entry_point = node;
+            m_max_level = level;
+            return;
+        }
+
+        const uint8_t* vector = get_vector(node);
+        uint32_t entry_point = greedy_search(vector, m_entry_point, m_max_level, level);
+        for (int32_t current_level = std::min(level, m_max_level); current_level >= 0; --current_level) {
+            const auto candidates = search_layer(vector, entry_point, m_config.ef_construction, current_level, false);
+            m_links[node][current_level] = select_neighbours(candidates, m_config.max_neighbours);
+
+            const size_t max_links = get_max_links(current_level);
+            for (uint32_t neighbour : m_links[node][current_level]) {
+                auto& neighbour_links = m_links[neighbour][current_level];
+                neighbour_links.push_back(node);
+                if (neighbour_links.size() > max_links) {
+                    const uint8_t* neighbour_vector = get_vector(neighbour);
+                    std::vector<Candidate> neighbour_candidates;
+                    neighbour_candidates.reserve(neighbour_links.size());
+                    for (uint32_t link : neighbour_links) {
+                        neighbour_candidates.emplace_back(m_distance(neighbour_vector, get_vector(link), m_dimension), link);
+                    }
+                    std::sort(neighbour_candidates.begin(), neighbour_candidates.end());
+                    neighbour_links = select_neighbours(neighbour_candidates, max_links);
+                }
+            }
+            entry_point = candidates.front().second;
+        }
+
+        if (level > m_max_level) {
+            m_entry_point = node;
+            m_max_level = level;
+        }
+    }
+};
+
+VectorIndex::VectorIndex(size_t dimension, const Config& config)
+    : m_impl{std::make_unique<VectorIndexImpl>(dimension, config)} {}
+
+VectorIndex::VectorIndex(size_t dimension) : VectorIndex(dimension, Config{}) {}
+
+VectorIndex::VectorIndex(const std::filesystem::path& path) : m_impl{std::make_unique<VectorIndexImpl>(path)} {}
+
+void VectorIndex::add(const std::vector<size_t>& ids, const ov::Tensor& vectors) {
+    m_impl->add(ids, vectors);
+}
+
+void VectorIndex::remove(const std::vector<size_t>& ids) {
+    m_impl->remove(ids);
+}
+
+std::vector<std::pair<size_t, float>> VectorIndex::search(const ov::Tensor& query, size_t k) const {
+    const ov::Shape shape = query.get_shape();
+    OPENVINO_ASSERT(shape.size() == 1 || (shape.size() == 2 && shape[0] == 1),
+                    "Query shape should be [dimension] or [1, dimension], got ",
+                    shape);
+    m_impl->check_query(query.get_element_type(), query.get_size());
+    return m_impl->search(query.data(), k);
+}
+
+std::vector<std::pair<size_t, float>> VectorIndex::search(const EmbeddingResult& query, size_t k) const {
+    return std::visit(
+        [this, k](const auto& values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            m_impl->check_query(ov::element::from<T>(), values.size());
+            return m_impl->search(values.data(), k);
+        },
+        query);
+}
+
+void VectorIndex::save(const std::filesystem::path& path) const {
+    m_impl->save(path);
+}
+
+size_t VectorIndex::size() const {
+    return m_impl->size();
+}
+
+size_t VectorIndex::get_dimension() const {
+    return m_impl->get_dimension();
+}
+
+const VectorIndex::Config& VectorIndex::get_config() const {
+    return m_impl->get_config();
+}
+
+VectorIndex::~VectorIndex() = default;
+
+}  // namespace genai
+}  // namespace ov
@@ -16,8 +16,7 @@ protected:
     std::vector<std::shared_ptr<LogitTransformers::ILogitTransformer>> m_logit_transformers;
     std::vector<std::shared_ptr<LogitTransformers::IStatefulLogitTransformer>> m_stateful_logit_transformers;
     
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+    std::shared_ptr<LogitTransformers::TokenStatistics> m_token_statistics = std::make_shared<LogitTransformers::TokenStatistics>();
     size_t m_generated_tokens = 0;
 
     // speculative decoding parameters
@@ -29,9 +28,7 @@ public:
                    const LogitTransformers::TokenIds& input_ids,
                    std::shared_ptr<ov::genai::StructuredOutputController> structured_output_controller = nullptr
     ) {
-        for (const auto& input_id : input_ids) {
-            m_unique_prompt_token_ids->insert(input_id);
-        }
+        m_token_statistics->set_prompt_token_ids(input_ids);
 
         if (sampling_params.min_new_tokens > 0) {
             m_logit_transformers.emplace_back(
@@ -47,24 +44,11 @@ public:
         }
 
         if (sampling_params.is_multinomial() || sampling_params.is_greedy_decoding()) {
-            if (sampling_params.repetition_penalty != 1.0f) {
-                std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform> transformer =
-                    std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform>(new LogitTransformers::RepetitionPenaltyTransform(sampling_params.repetition_penalty));
-                transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-            }
-            if (sampling_params.presence_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::PresencePenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::PresencePenaltyTransform>(new LogitTransformers::PresencePenaltyTransform(sampling_params.presence_penalty)); 
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-                
-            }
-            if (sampling_params.frequency_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform>(new LogitTransformers::FrequencyPenaltyTransform(sampling_params.frequency_penalty));
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+            if (sampling_params.repetition_penalty != 1.0f || sampling_params.presence_penalty != 0.0f || sampling_params.frequency_penalty != 0.0f) {
+                // all penalties are applied in a single pass over prompt and generated tokens
+                std::shared_ptr<LogitTransformers::PenaltyTransform> transformer =
+                    std::make_shared<LogitTransformers::PenaltyTransform>(sampling_params.repetition_penalty, sampling_params.presence_penalty, sampling_params.frequency_penalty);
+                transformer->set_token_statistics(m_token_statistics);
                 m_logit_transformers.push_back(transformer);
             }
 
@@ -95,6 +79,18 @@ public:
         }
     }
 
+    bool has_stateful_transformers() const {
+        return !m_stateful_logit_transformers.empty();
+    }
+
+    void prepare() {
+        for (const auto& transformer : m_stateful_logit_transformers) {
+            if (transformer->is_applicable(m_generated_tokens)) {
+                transformer->prepare();
+            }
+        }
+    }
+
     void update_generated_len(size_t updated_len) {
         m_generated_tokens = updated_len;
     }
@@ -104,12 +100,7 @@ public:
     }
 
     void register_new_generated_token(int64_t new_token_id) {
-        auto it = m_unique_generated_token_ids->find(new_token_id);
-        if (it == m_unique_generated_token_ids->end()) {
-            m_unique_generated_token_ids->insert({new_token_id, 1});
-        } else {
-            it->second++;
-        }
+        m_token_statistics->register_generated_token(new_token_id);
         for (const auto& transformer : m_stateful_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
                 transformer->accept_tokens({new_token_id});
@@ -118,8 +109,7 @@ public:
     }
 
     void decrease_generated_token_occurance(int64_t token_id) {
-        OPENVINO_ASSERT(m_unique_generated_token_ids->count(token_id) > 0);
-        m_unique_generated_token_ids->at(token_id)--;
+        m_token_statistics->unregister_generated_token(token_id);
     }
 
 };
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <memory>
 
 #include "openvino/genai/generation_config.hpp"
 
@@ -66,6 +68,10 @@ public:
 class IStatefulLogitTransformer: public ILogitTransformer {
 public:
     virtual void accept_tokens(const TokenIds& input_ids) = 0;
+
+    // Precomputes data for the next apply call which depends on the state only (e.g. mask of allowed tokens).
+    // It's called while the model inference is in flight, so it must not access logits.
+    virtual void prepare() {}
 };
 
 
@@ -170,153 +176,207 @@ protected:
 };
 
 
-class IPenaltyTransformer : public ILogitTransformer {
+class EOSPenaltyTransform : public ILogitTransformer {
 public:
-    void set_unique_generated_token_ids(const std::shared_ptr<std::map<int64_t, size_t>>& unique_generated_token_ids) {
-        if (unique_generated_token_ids != nullptr) {
-            m_unique_generated_token_ids = unique_generated_token_ids;
-        } else {
-            m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-        }
+    EOSPenaltyTransform(const std::set<int64_t>& stop_token_ids, size_t min_generated_tokens) :
+        m_stop_token_ids(stop_token_ids), m_applicable_tensor_len(min_generated_tokens) {}
+
+    void apply(Logits& logits) override {
+        // Since EOS penalty is applied early, the token vector is not initialized yet
+        // and we can assume element order match token ids.
+        for (auto stop_token_id: m_stop_token_ids)
+            logits.m_data[stop_token_id] = 0.f;
     }
 
-    void extract_generated_tokens(const TokenIds& input_ids) {
-        set_unique_generated_token_ids(m_unique_generated_token_ids);
 
-        for (const auto& input_id : input_ids) {
-            if (m_unique_generated_token_ids->count(input_id)) {
-                m_unique_generated_token_ids->at(input_id)++;
-            } else {
-                m_unique_generated_token_ids->insert({input_id, 1});
-            }
-        }
+    bool is_applicable(size_t generated_tokens_cnt = 0) override {
+        return generated_tokens_cnt < m_applicable_tensor_len;
     }
 
 protected:
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = nullptr;
-    double m_penalty = 0.f;
+    size_t m_applicable_tensor_len = std::numeric_limits<size_t>::max();
+    std::set<int64_t> m_stop_token_ids;
 };
 
-class RepetitionPenaltyTransform : public IPenaltyTransformer {
+/**
+ * @brief Prompt and generated token statistics of a request used by penalty transforms.
+ *
+ * Unique prompt token ids are stored as a sorted array, generated token ids with their occurrence counters are stored
+ * densely in insertion order and indexed by an open addressing hash table, so both penalties application and
+ * registration of a new token do not allocate per token and touch contiguous memory only.
+ */
+class TokenStatistics {
 public:
-    RepetitionPenaltyTransform(double repetition_penalty) {
-        m_penalty = repetition_penalty;
-    };
+    void set_prompt_token_ids(const TokenIds& prompt_token_ids) {
+        m_unique_prompt_token_ids.assign(prompt_token_ids.begin(), prompt_token_ids.end());
+        std::sort(m_unique_prompt_token_ids.begin(), m_unique_prompt_token_ids.end());
+        m_unique_prompt_token_ids.erase(std::unique(m_unique_prompt_token_ids.begin(), m_unique_prompt_token_ids.end()), m_unique_prompt_token_ids.end());
+        m_unique_prompt_token_ids.shrink_to_fit();
+    }
 
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& prompt_id : *m_unique_prompt_token_ids) {
-            OPENVINO_ASSERT((prompt_id >= 0) && (prompt_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[prompt_id] >= 0) {
-                logits.m_data[prompt_id] /= m_penalty;
-            } else {
-                logits.m_data[prompt_id] *= m_penalty;
-            };
+    const TokenIds& get_unique_prompt_token_ids() const {
+        return m_unique_prompt_token_ids;
+    }
+
+    bool is_prompt_token(int64_t token_id) const {
+        return std::binary_search(m_unique_prompt_token_ids.begin(), m_unique_prompt_token_ids.end(), token_id);
+    }
+
+    void register_generated_token(int64_t token_id) {
+        size_t slot = _find_slot(token_id);
+        if (m_slots[slot] != EMPTY_SLOT) {
+            m_generated_token_counts[m_slots[slot]]++;
+            return;
         }
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            if (1 == m_unique_prompt_token_ids->count(input_id)) {
-                // repetition_penalty was already accounted by the for
-                // loop above.
-                continue;
-            }
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] /= m_penalty;
-            } else {
-                logits.m_data[input_id] *= m_penalty;
-            };
+        // keep load factor of the hash table below 0.5
+        if (2 * (m_generated_token_ids.size() + 1) > m_slots.size()) {
+            _rehash(2 * m_slots.size());
+            slot = _find_slot(token_id);
         }
+        m_slots[slot] = m_generated_token_ids.size();
+        m_generated_token_ids.push_back(token_id);
+        m_generated_token_counts.push_back(1);
     }
 
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        set_unique_prompt_token_ids(nullptr);
-        extract_generated_tokens(input_ids);
-        apply(logits);
+    void unregister_generated_token(int64_t token_id) {
+        size_t slot = _find_slot(token_id);
+        OPENVINO_ASSERT(m_slots[slot] != EMPTY_SLOT, "Token ", token_id, " was not generated");
+        size_t& count = m_generated_token_counts[m_slots[slot]];
+        if (count > 0) {
+            count--;
+        }
     }
 
-    void set_unique_prompt_token_ids(const std::shared_ptr<std::set<int64_t>>& unique_prompt_token_ids) {
-        if (unique_prompt_token_ids != nullptr) {
-            m_unique_prompt_token_ids = unique_prompt_token_ids;
-        } else {
-            m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
-        }
+    size_t get_generated_token_count(int64_t token_id) const {
+        size_t slot = _find_slot(token_id);
+        return m_slots[slot] == EMPTY_SLOT ? 0 : m_generated_token_counts[m_slots[slot]];
     }
 
-protected:
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = nullptr;
-};
+    // Ids of generated tokens in order of first occurrence, tokens with zero count (e.g. removed by speculative decoding) are kept
+    const TokenIds& get_generated_token_ids() const {
+        return m_generated_token_ids;
+    }
 
-class EOSPenaltyTransform : public ILogitTransformer {
-public:
-    EOSPenaltyTransform(const std::set<int64_t>& stop_token_ids, size_t min_generated_tokens) :
-        m_stop_token_ids(stop_token_ids), m_applicable_tensor_len(min_generated_tokens) {}
+    const std::vector<size_t>& get_generated_token_counts() const {
+        return m_generated_token_counts;
+    }
 
-    void apply(Logits& logits) override {
-        // Since EOS penalty is applied early, the token vector is not initialized yet
-        // and we can assume element order match token ids.
-        for (auto stop_token_id: m_stop_token_ids)
-            logits.m_data[stop_token_id] = 0.f;
+    // Heap memory held by the statistics, it depends on the number of unique tokens rather than on the prompt length
+    size_t get_byte_size() const {
+        return m_unique_prompt_token_ids.capacity() * sizeof(int64_t) +
+               m_generated_token_ids.capacity() * sizeof(int64_t) +
+               m_generated_token_counts.capacity() * sizeof(size_t) +
+               m_slots.capacity() * sizeof(size_t);
     }
 
+private:
+    static constexpr size_t EMPTY_SLOT = std::numeric_limits<size_t>::max();
 
-    bool is_applicable(size_t generated_tokens_cnt = 0) override {
-        return generated_tokens_cnt < m_applicable_tensor_len;
+    size_t _find_slot(int64_t token_id) const {
+        const size_t mask = m_slots.size() - 1;
+        // Fibonacci hashing spreads consecutive token ids over the table
+        size_t slot = static_cast<size_t>((static_cast<uint64_t>(token_id) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        while (m_slots[slot] != EMPTY_SLOT && m_generated_token_ids[m_slots[slot]] != token_id) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
     }
 
-protected:
-    size_t m_applicable_tensor_len = std::numeric_limits<size_t>::max();
-    std::set<int64_t> m_stop_token_ids;
+    void _rehash(size_t num_slots) {
+        m_slots.assign(num_slots, EMPTY_SLOT);
+        for (size_t idx = 0; idx < m_generated_token_ids.size(); ++idx) {
+            m_slots[_find_slot(m_generated_token_ids[idx])] = idx;
+        }
+    }
+
+    TokenIds m_unique_prompt_token_ids;
+
+    TokenIds m_generated_token_ids;
+    std::vector<size_t> m_generated_token_counts;
+    // indices into m_generated_token_ids, the number of slots is always a power of 2
+    std::vector<size_t> m_slots = std::vector<size_t>(16, EMPTY_SLOT);
 };
 
-class FrequencyPenaltyTransform : public IPenaltyTransformer {
+/**
+ * @brief Applies repetition, presence and frequency penalties in a single pass over the prompt and generated tokens.
+ *
+ * For each token the penalties are applied in the order: repetition, presence, frequency. Repetition penalty is applied once
+ * to each token found either in the prompt or among generated tokens, presence and frequency penalties are applied to generated tokens only.
+ */
+class PenaltyTransform : public ILogitTransformer {
 public:
-    FrequencyPenaltyTransform(double value) {
-        m_penalty = value;
-    };
+    PenaltyTransform(double repetition_penalty, double presence_penalty, double frequency_penalty) :
+        m_repetition_penalty(repetition_penalty), m_presence_penalty(presence_penalty), m_frequency_penalty(frequency_penalty) {}
 
     void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
+        const size_t vocab_size = logits.m_size;
+        const bool has_repetition_penalty = m_repetition_penalty != 1.0;
+        if (has_repetition_penalty) {
+            for (const auto& prompt_id : m_token_statistics->get_unique_prompt_token_ids()) {
+                OPENVINO_ASSERT((prompt_id >= 0) && (prompt_id < vocab_size), "input_ids token out of bounds");
+                logits.m_data[prompt_id] = _apply_repetition_penalty(logits.m_data[prompt_id]);
+            }
+        }
+
+        const auto& generated_ids = m_token_statistics->get_generated_token_ids();
+        const auto& generated_counts = m_token_statistics->get_generated_token_counts();
+        for (size_t idx = 0; idx < generated_ids.size(); ++idx) {
+            const size_t count = generated_counts[idx];
+            if (count == 0) {
+                continue;
+            }
+            const int64_t input_id = generated_ids[idx];
             OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty * input_id_pair.second;
-            } else {
-                logits.m_data[input_id] += m_penalty * input_id_pair.second;
-            };
+            float value = logits.m_data[input_id];
+            // repetition_penalty of prompt tokens was already accounted by the loop above
+            if (has_repetition_penalty && !m_token_statistics->is_prompt_token(input_id)) {
+                value = _apply_repetition_penalty(value);
+            }
+            if (m_presence_penalty != 0.0) {
+                value = value >= 0 ? value - m_presence_penalty : value + m_presence_penalty;
+            }
+            if (m_frequency_penalty != 0.0) {
+                value = value >= 0 ? value - m_frequency_penalty * count : value + m_frequency_penalty * count;
+            }
+            logits.m_data[input_id] = value;
         }
     }
 
     void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
+        for (const auto& input_id : input_ids) {
+            m_token_statistics->register_generated_token(input_id);
+        }
         apply(logits);
     }
+
+    void set_token_statistics(const std::shared_ptr<TokenStatistics>& token_statistics) {
+        m_token_statistics = token_statistics != nullptr ? token_statistics : std::make_shared<TokenStatistics>();
+    }
+
+protected:
+    float _apply_repetition_penalty(float value) const {
+        return value >= 0 ? value / m_repetition_penalty : value * m_repetition_penalty;
+    }
+
+    double m_repetition_penalty = 1.0;
+    double m_presence_penalty = 0.0;
+    double m_frequency_penalty = 0.0;
+    std::shared_ptr<TokenStatistics> m_token_statistics = std::make_shared<TokenStatistics>();
 };
 
-class PresencePenaltyTransform : public IPenaltyTransformer {
+class RepetitionPenaltyTransform : public PenaltyTransform {
 public:
-    PresencePenaltyTransform(double value) {
-        m_penalty = value;
-    };
+    RepetitionPenaltyTransform(double repetition_penalty) : PenaltyTransform(repetition_penalty, 0.0, 0.0) {}
+};
 
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty;
-            } else {
-                logits.m_data[input_id] += m_penalty;
-            };
-        }
-    }
+class PresencePenaltyTransform : public PenaltyTransform {
+public:
+    PresencePenaltyTransform(double value) : PenaltyTransform(1.0, value, 0.0) {}
+};
 
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
-        apply(logits);
-    }
+class FrequencyPenaltyTransform : public PenaltyTransform {
+public:
+    FrequencyPenaltyTransform(double value) : PenaltyTransform(1.0, 0.0, value) {}
 };
 
 } // namespace LogitTransformers
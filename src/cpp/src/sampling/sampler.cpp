@@ -88,101 +88,6 @@ std::string clean_wrapped_text(const std::string& wrapped_text, const std::strin
     return clean_text;
 }
 
-std::vector<int64_t> encode_and_process_string(const std::string& stop_string, ov::genai::Tokenizer& tokenizer) {
-    // encode stop_string
-    std::string stop_string_copy = stop_string;
-    ov::Tensor ov_encoded_stop_string = tokenizer.encode(stop_string_copy, ov::genai::add_special_tokens(false)).input_ids;
-    size_t tensor_size = ov_encoded_stop_string.get_size();
-    std::vector<int64_t> encoded_stop_string(tensor_size);
-    std::copy_n(ov_encoded_stop_string.data<int64_t>(), tensor_size, encoded_stop_string.begin());
-    return encoded_stop_string;
-}
-
-struct MatchStopStringResult {
-    size_t to_remove = 0;
-    // int64_t last_token_id = 0;
-    // bool is_to_update_last_token = false;
-    bool is_matched = false;
-};
-
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
-                      const TokenIds& generated_tokens,
-                      const std::pair<size_t, std::set<std::string>>& stop_strings,
-                      bool is_include_to_output,
-                      size_t draft_generated_tokens = 0) {
-    MatchStopStringResult result;
-    if (generated_tokens.size() >= stop_strings.first) {
-        // draft_generated_tokens is to handle case with >= 1 generated tokens per step
-        size_t offset = generated_tokens.size() - draft_generated_tokens;
-        if (offset < stop_strings.first) {
-            return result;
-        }
-        offset -= stop_strings.first;
-        TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
-        std::string decoded_buffer = tokenizer.decode(buffer);
-        for (const auto& stop_string : stop_strings.second) {
-            auto pos = decoded_buffer.find(stop_string);
-            if (pos != std::string::npos) {
-                result.is_matched = true;
-
-                auto stop_string_len = is_include_to_output ? stop_string.length() : 0;
-                decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
-                // to remove word splitting symbols from tail
-                while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
-                    decoded_buffer.pop_back();
-                }
-                if (decoded_buffer.empty()) {
-                    result.to_remove = buffer.size();
-                    return result;
-                }
-
-                // find token cnt to be removed from sequence by decoding token by token
-                std::string decoded_partially_string;
-                for (size_t i = 0; i < buffer.size(); ++i) {
-                    decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
-                    if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
-                        result.to_remove = buffer.size() - i - 1;
-                        break;
-                    }
-                }
-                return result;
-            }
-        }
-    }
-    return result;
-}
-
-// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
-// Number of tokens might not be exact as if there's no direct token match, we decode generated tokens incrementally expanding decoding scope
-// with 4 next tokens with each iteration until we check all tokens.
-int match_stop_string2(Tokenizer & tokenizer, const TokenIds & generated_tokens, const std::set<std::string> & stop_strings) {
-    for (auto stop_string: stop_strings) {
-        auto stop_tokens_ov = tokenizer.encode(stop_string).input_ids;
-        size_t num_tokens = stop_tokens_ov.get_size();
-        if(num_tokens > generated_tokens.size())
-            continue;
-
-        // Check direct token match
-        std::vector<int64_t> stop_tokens(stop_tokens_ov.data<int64_t>(), stop_tokens_ov.data<int64_t>() + num_tokens);
-        std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-        if (stop_tokens == last_generated_tokens)
-            return num_tokens;
-        
-        // Continue checking chunks of 4 tokens
-        num_tokens += 4;
-        while (num_tokens <= generated_tokens.size()) {
-            std::vector<int64_t> last_generated_tokens(generated_tokens.end()-num_tokens, generated_tokens.end());
-            std::string decoded_last_tokens = tokenizer.decode(last_generated_tokens);
-            if (decoded_last_tokens.find(stop_string) != std::string::npos) {
-                return num_tokens;
-            }
-            num_tokens += 4;
-        }
-    }
-    return 0;
-}
-
 void Sampler::GroupBeamSearcher::finalize(SamplerOutput& sampler_output) {
     for (Group& group : m_groups) {
         if (!group.done) {
@@ -259,7 +164,7 @@ void Sampler::clear_structured_output_compile_times() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    const StopStringMatcher& stop_strings) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -407,7 +312,7 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                 // There's probably a better way to do that, than copying whole vector...
                 std::vector<int64_t> token_ids = candidate.m_sequence->get_generated_ids();
                 token_ids.push_back(candidate.m_token_id);
-                auto match_result = match_stop_string(m_tokenizer, token_ids, stop_strings, m_parameters.include_stop_str_in_output);
+                auto match_result = stop_strings.match(m_tokenizer, token_ids, m_parameters.include_stop_str_in_output);
                 if (match_result.is_matched) {
                     // If beam_token does not belong to top num_beams tokens, it should not be added
                     if (cand_idx >= group_size)
@@ -590,8 +495,8 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
 
         if (!sampling_params.stop_strings.empty()) {
             auto& stop_strings = m_stop_strings.at(sequence_group->get_request_id());
-            auto match_result = match_stop_string(m_tokenizer, running_sequence->get_generated_ids(), stop_strings,
-                                                  sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
+            auto match_result = stop_strings.match(m_tokenizer, running_sequence->get_generated_ids(),
+                                                   sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
             if (match_result.is_matched) {
                 running_sequence->remove_last_tokens(match_result.to_remove);
 
@@ -757,21 +662,8 @@ float get_p_prime(Sequence::Ptr& running_sequence,
     return p_prime;
 }
 
-std::pair<size_t, std::set<std::string>>
-process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer) {
-    std::pair<size_t, std::set<std::string>> result;
-    for (const auto& stop_string : stop_strings) {
-        auto encoded_stop_string = encode_and_process_string(stop_string, tokenizer);
-        if (result.first < encoded_stop_string.size()) {
-            result.first = encoded_stop_string.size();
-        }
-        result.second.insert(stop_string);
-    }
-    return result;
-}
-
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
-                                                              LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
+                                                              LogitProcessor& logit_processor, const StopStringMatcher& stop_strings, 
                                                               bool is_validation_mode_enabled) {
     SequenceGroupSamplingInfo sg_sampling_info;
     // Assistant pipeline info is relevant for speculative and prompt lookup decoding
@@ -924,6 +816,8 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
 SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_groups,
                               ov::Tensor logits,
                               bool is_validation_mode_enabled) {
+    _wait_logit_processors_preparation();
+
     const float * logits_data = logits.data<float>();
     ov::Shape logits_shape = logits.get_shape();
     OPENVINO_ASSERT(logits_shape.size() == 3);
@@ -949,9 +843,9 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
             m_logit_processors.insert({request_id, LogitProcessor(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller)});
         }
         if (!m_stop_strings.count(request_id)) {
-            auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
-            m_stop_strings.insert({request_id, processed_stop_string});
-            sequence_group->set_stream_window_size(processed_stop_string.first);
+            StopStringMatcher stop_string_matcher(sampling_params.stop_strings, m_tokenizer);
+            sequence_group->set_stream_window_size(stop_string_matcher.get_max_encoded_length());
+            m_stop_strings.insert({request_id, std::move(stop_string_matcher)});
         }
         const auto& stop_strings = m_stop_strings.at(request_id);
         auto& logit_processor = m_logit_processors.at(request_id);
@@ -960,7 +854,7 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         if (sequence_group->requires_sampling()) {
             // Call sample_from_sequence_group asynchronously
             sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+                                                                      logit_processor, std::cref(stop_strings), is_validation_mode_enabled);
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -1026,7 +920,40 @@ void Sampler::create_logit_processor(uint64_t request_id, const GenerationConfig
     m_logit_processors.insert({request_id, LogitProcessor(sampling_params, prompt, structured_output_controller)});
 }
 
+void Sampler::prefetch_structured_output(const GenerationConfig& sampling_params) {
+    // the pipeline creates the controller with vocab size of the model, so the grammar is compiled for the same controller
+    // which is used by sample()
+    if (sampling_params.is_structured_output_generation() && m_tokenizer.m_pimpl != nullptr) {
+        m_tokenizer.m_pimpl->get_structured_output_controller()->prefetch_grammar(sampling_params);
+    }
+}
+
+void Sampler::prepare_logit_processors(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    _wait_logit_processors_preparation();
+    for (const auto& sequence_group : sequence_groups) {
+        if (!sequence_group->is_scheduled() || !sequence_group->requires_sampling()) {
+            continue;
+        }
+        auto logit_processor_it = m_logit_processors.find(sequence_group->get_request_id());
+        if (logit_processor_it != m_logit_processors.end() && logit_processor_it->second.has_stateful_transformers()) {
+            LogitProcessor& logit_processor = logit_processor_it->second;
+            m_logit_processors_preparation.push_back(m_thread_pool.submit([&logit_processor] {
+                logit_processor.prepare();
+            }));
+        }
+    }
+}
+
+void Sampler::_wait_logit_processors_preparation() {
+    // errors are not propagated here, failed preparation is repeated and reported by LogitProcessor::apply
+    for (auto& preparation : m_logit_processors_preparation) {
+        preparation.wait();
+    }
+    m_logit_processors_preparation.clear();
+}
+
 void Sampler::clear_request_info(uint64_t request_id) {
+    _wait_logit_processors_preparation();
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
     m_stop_strings.erase(request_id);
@@ -18,6 +18,7 @@
 
 #include "sampling/logit_transformers.hpp"
 #include "sampling/logit_processor.hpp"
+#include "sampling/stop_string_matcher.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "sequence_group.hpp"
 #include "threadpool.hpp"
@@ -77,12 +78,13 @@ class Sampler {
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
     std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
     std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
+    void _wait_logit_processors_preparation();
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample, bool has_real_probolities);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
-                                                        LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
+                                                        LogitProcessor& logit_processor, const StopStringMatcher& stop_strings,
                                                         bool is_validation_mode_enabled);
 
     // request ID => beam search tracking information
@@ -93,8 +95,10 @@ class Sampler {
     size_t seed = rng_engine.default_seed;
     // { request_id, logit_processor }
     std::map<uint64_t, LogitProcessor> m_logit_processors;
-    // { request_id, { max_encoded_len, { stop_strings }}}
-    std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // { request_id, stop_strings }
+    std::map<int64_t, StopStringMatcher> m_stop_strings;
+    // preparation tasks of logit processors started before model inference
+    std::vector<std::future<void>> m_logit_processors_preparation;
 
     Tokenizer m_tokenizer;
 
@@ -103,7 +107,8 @@ public:
     Sampler(const Sampler& rhs) = delete;
     Sampler(Sampler&& rhs) = delete;
     Sampler(size_t num_threads = 1): m_thread_pool(num_threads) {};
-    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
+    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1, const std::vector<size_t>& cpu_ids = {}) :
+        m_tokenizer(tokenizer), m_thread_pool(num_threads, cpu_ids) {};
 
     SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
     void set_seed(size_t new_seed) {
@@ -118,6 +123,12 @@ public:
 
     void clear_request_info(uint64_t request_id);
 
+    // Starts compilation of structured output grammar of a new request in background
+    void prefetch_structured_output(const GenerationConfig& sampling_parameters);
+    // Starts preparation of logit processors of scheduled requests (e.g. structured output token masks computation)
+    // in the sampler thread pool, so it overlaps with the model inference. sample() waits for its completion.
+    void prepare_logit_processors(const std::vector<SequenceGroup::Ptr>& sequence_groups);
+
     LogitProcessor& get_logit_processor(uint64_t request_id);
     void create_logit_processor(uint64_t request_id, const GenerationConfig& sampling_parameters, const TokenIds& prompt);
 
@@ -167,7 +178,7 @@ class Sampler::GroupBeamSearcher {
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const StopStringMatcher& stop_strings);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
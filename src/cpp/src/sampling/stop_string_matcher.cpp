@@ -0,0 +1,201 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampling/stop_string_matcher.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <string_view>
+
+#include "tokenizer/tokenizer_impl.hpp"
+
+namespace ov::genai {
+
+StopStringAutomaton::StopStringAutomaton(const std::set<std::string>& stop_strings) {
+    constexpr uint32_t NO_STATE = std::numeric_limits<uint32_t>::max();
+    // build trie, state 0 is the root
+    m_transitions.assign(ALPHABET_SIZE, NO_STATE);
+    m_match_lengths.assign(1, 0);
+    for (const auto& stop_string : stop_strings) {
+        if (stop_string.empty()) {
+            continue;
+        }
+        size_t state = 0;
+        for (char byte : stop_string) {
+            uint32_t& next = m_transitions[state * ALPHABET_SIZE + static_cast<uint8_t>(byte)];
+            if (next == NO_STATE) {
+                next = static_cast<uint32_t>(m_match_lengths.size());
+                m_transitions.resize(m_transitions.size() + ALPHABET_SIZE, NO_STATE);
+                m_match_lengths.push_back(0);
+            }
+            state = next;
+        }
+        m_match_lengths[state] = stop_string.size();
+        m_max_stop_string_length = std::max(m_max_stop_string_length, stop_string.size());
+    }
+
+    // resolve failure links in BFS order, so the transitions of a failure state are complete when they are copied
+    std::vector<uint32_t> failure(m_match_lengths.size(), 0);
+    std::queue<uint32_t> states;
+    for (size_t byte = 0; byte < ALPHABET_SIZE; ++byte) {
+        uint32_t& next = m_transitions[byte];
+        if (next == NO_STATE) {
+            next = 0;
+        } else {
+            states.push(next);
+        }
+    }
+    while (!states.empty()) {
+        uint32_t state = states.front();
+        states.pop();
+        m_match_lengths[state] = std::max(m_match_lengths[state], m_match_lengths[failure[state]]);
+        for (size_t byte = 0; byte < ALPHABET_SIZE; ++byte) {
+            uint32_t& next = m_transitions[state * ALPHABET_SIZE + byte];
+            const uint32_t failure_next = m_transitions[failure[state] * ALPHABET_SIZE + byte];
+            if (next == NO_STATE) {
+                next = failure_next;
+            } else {
+                failure[next] = failure_next;
+                states.push(next);
+            }
+        }
+    }
+}
+
+MatchStopStringResult StopStringAutomaton::match(const TokenIds& generated_tokens,
+                                                 const std::vector<std::string>& vocab,
+                                                 bool is_include_to_output,
+                                                 size_t num_new_tokens) const {
+    MatchStopStringResult result;
+    if (generated_tokens.empty() || m_max_stop_string_length == 0) {
+        return result;
+    }
+
+    auto token_bytes = [&](size_t token_idx) -> std::string_view {
+        const int64_t token_id = generated_tokens[token_idx];
+        return token_id >= 0 && static_cast<size_t>(token_id) < vocab.size() ? std::string_view(vocab[token_id]) : std::string_view();
+    };
+
+    // only stop strings ending in new tokens are of interest, all earlier positions were checked at previous steps;
+    // the automaton starts from the root early enough to see any stop string which ends in new tokens
+    const size_t first_new_token_idx = generated_tokens.size() - std::min(generated_tokens.size(), num_new_tokens + 1);
+    size_t window_begin = first_new_token_idx;
+    for (size_t context_length = 0; window_begin > 0 && context_length + 1 < m_max_stop_string_length; ) {
+        context_length += token_bytes(--window_begin).size();
+    }
+
+    size_t state = 0, kept_length = 0, processed_length = 0;
+    for (size_t token_idx = window_begin; token_idx < generated_tokens.size() && !result.is_matched; ++token_idx) {
+        for (char byte : token_bytes(token_idx)) {
+            state = _next_state(state, byte);
+            ++processed_length;
+            if (m_match_lengths[state] > 0 && token_idx >= first_new_token_idx) {
+                result.is_matched = true;
+                kept_length = is_include_to_output ? processed_length : processed_length - m_match_lengths[state];
+                break;
+            }
+        }
+    }
+    if (!result.is_matched) {
+        return result;
+    }
+
+    // find the token containing the last kept byte, the kept text starts at window_begin
+    int64_t token_idx = static_cast<int64_t>(window_begin) - 1;
+    size_t num_kept_bytes = token_idx >= 0 ? token_bytes(token_idx).size() : 0;
+    while (kept_length > 0) {
+        const size_t token_length = token_bytes(++token_idx).size();
+        num_kept_bytes = std::min(kept_length, token_length);
+        kept_length -= num_kept_bytes;
+    }
+    // to remove word splitting symbols from tail
+    while (token_idx >= 0) {
+        if (num_kept_bytes == 0) {
+            if (--token_idx >= 0) {
+                num_kept_bytes = token_bytes(token_idx).size();
+            }
+            continue;
+        }
+        const char last_byte = token_bytes(token_idx)[num_kept_bytes - 1];
+        if (last_byte != ' ' && last_byte != '\n') {
+            break;
+        }
+        --num_kept_bytes;
+    }
+    result.to_remove = generated_tokens.size() - static_cast<size_t>(token_idx + 1);
+    return result;
+}
+
+StopStringMatcher::StopStringMatcher(const std::set<std::string>& stop_strings, Tokenizer& tokenizer)
+    : m_stop_strings(stop_strings) {
+    for (const auto& stop_string : stop_strings) {
+        ov::Tensor encoded_stop_string = tokenizer.encode(stop_string, ov::genai::add_special_tokens(false)).input_ids;
+        m_max_encoded_length = std::max(m_max_encoded_length, encoded_stop_string.get_size());
+    }
+    if (!stop_strings.empty() && tokenizer.m_pimpl != nullptr) {
+        m_vocab = tokenizer.m_pimpl->get_detokenized_vocab();
+    }
+    if (m_vocab != nullptr) {
+        m_automaton = StopStringAutomaton(stop_strings);
+    }
+}
+
+MatchStopStringResult StopStringMatcher::match(Tokenizer& tokenizer,
+                                               const TokenIds& generated_tokens,
+                                               bool is_include_to_output,
+                                               size_t num_new_tokens) const {
+    if (m_automaton.get_max_stop_string_length() > 0) {
+        return m_automaton.match(generated_tokens, *m_vocab, is_include_to_output, num_new_tokens);
+    }
+    return _match_with_detokenizer(tokenizer, generated_tokens, is_include_to_output, num_new_tokens);
+}
+
+// Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
+MatchStopStringResult StopStringMatcher::_match_with_detokenizer(Tokenizer& tokenizer,
+                                                                 const TokenIds& generated_tokens,
+                                                                 bool is_include_to_output,
+                                                                 size_t num_new_tokens) const {
+    MatchStopStringResult result;
+    if (generated_tokens.size() >= m_max_encoded_length) {
+        // num_new_tokens is to handle case with >= 1 generated tokens per step
+        size_t offset = generated_tokens.size() - num_new_tokens;
+        if (offset < m_max_encoded_length) {
+            return result;
+        }
+        offset -= m_max_encoded_length;
+        TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
+        std::string decoded_buffer = tokenizer.decode(buffer);
+        for (const auto& stop_string : m_stop_strings) {
+            auto pos = decoded_buffer.find(stop_string);
+            if (pos != std::string::npos) {
+                result.is_matched = true;
+
+                auto stop_string_len = is_include_to_output ? stop_string.length() : 0;
+                decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
+                // to remove word splitting symbols from tail
+                while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
+                    decoded_buffer.pop_back();
+                }
+                if (decoded_buffer.empty()) {
+                    result.to_remove = buffer.size();
+                    return result;
+                }
+
+                // find token cnt to be removed from sequence by decoding token by token
+                std::string decoded_partially_string;
+                for (size_t i = 0; i < buffer.size(); ++i) {
+                    decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
+                    if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
+                        result.to_remove = buffer.size() - i - 1;
+                        break;
+                    }
+                }
+                return result;
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace ov::genai
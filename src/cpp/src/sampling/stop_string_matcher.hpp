@@ -0,0 +1,105 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+using TokenIds = std::vector<int64_t>;
+
+struct MatchStopStringResult {
+    // number of last generated tokens to be removed from the sequence
+    size_t to_remove = 0;
+    bool is_matched = false;
+};
+
+/**
+ * @brief Byte level Aho-Corasick automaton over a set of stop strings.
+ *
+ * Generated tokens are matched by feeding their bytes in decoded text into the automaton,
+ * so a step costs O(number of bytes in the new tokens + length of the longest stop string) and requires no detokenizer
+ * inference. The state is not kept between steps, so sequences forked by beam search or truncated by speculative decoding
+ * need no special handling.
+ */
+class StopStringAutomaton {
+public:
+    StopStringAutomaton() = default;
+    explicit StopStringAutomaton(const std::set<std::string>& stop_strings);
+
+    /**
+     * Looks for a stop string ending within the last `num_new_tokens + 1` generated tokens.
+     * If several stop strings are found, the one which ends first is selected, and the longest one among those ending at the same byte.
+     * @param generated_tokens Generated token ids.
+     * @param vocab Bytes of tokens in decoded text indexed by token id.
+     * @param is_include_to_output Whether the stop string is kept in the output.
+     * @param num_new_tokens Number of tokens generated in addition to one token at the current step (e.g. during speculative decoding).
+     */
+    MatchStopStringResult match(const TokenIds& generated_tokens,
+                                const std::vector<std::string>& vocab,
+                                bool is_include_to_output,
+                                size_t num_new_tokens = 0) const;
+
+    size_t get_max_stop_string_length() const {
+        return m_max_stop_string_length;
+    }
+
+private:
+    static constexpr size_t ALPHABET_SIZE = 256;
+
+    size_t _next_state(size_t state, char byte) const {
+        return m_transitions[state * ALPHABET_SIZE + static_cast<uint8_t>(byte)];
+    }
+
+    // dense transition function of the automaton, failure links are already resolved
+    std::vector<uint32_t> m_transitions;
+    // length of the longest stop string which is a suffix of the state string, 0 if there is none
+    std::vector<size_t> m_match_lengths;
+    size_t m_max_stop_string_length = 0;
+};
+
+/**
+ * @brief Stop strings of a single request.
+ *
+ * Uses StopStringAutomaton when the tokenizer provides decoded text of tokens (see TokenizerImpl::get_detokenized_vocab),
+ * otherwise falls back to decoding of the recent tokens with the detokenizer.
+ */
+class StopStringMatcher {
+public:
+    StopStringMatcher() = default;
+    StopStringMatcher(const std::set<std::string>& stop_strings, Tokenizer& tokenizer);
+
+    MatchStopStringResult match(Tokenizer& tokenizer,
+                                const TokenIds& generated_tokens,
+                                bool is_include_to_output,
+                                size_t num_new_tokens = 0) const;
+
+    // Maximal number of tokens in encoded stop strings
+    size_t get_max_encoded_length() const {
+        return m_max_encoded_length;
+    }
+
+    const std::set<std::string>& get_stop_strings() const {
+        return m_stop_strings;
+    }
+
+private:
+    MatchStopStringResult _match_with_detokenizer(Tokenizer& tokenizer,
+                                                  const TokenIds& generated_tokens,
+                                                  bool is_include_to_output,
+                                                  size_t num_new_tokens) const;
+
+    size_t m_max_encoded_length = 0;
+    std::set<std::string> m_stop_strings;
+    StopStringAutomaton m_automaton;
+    std::shared_ptr<const std::vector<std::string>> m_vocab = nullptr;
+};
+
+}  // namespace ov::genai
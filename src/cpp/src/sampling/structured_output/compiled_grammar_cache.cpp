@@ -0,0 +1,40 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "compiled_grammar_cache.hpp"
+
+#include <nlohmann/json.hpp>
+
+namespace ov {
+namespace genai {
+
+std::string get_grammar_key(const StructuredOutputConfig& structured_output_config) {
+    if (structured_output_config.json_schema.has_value()) {
+        const std::string& json_schema = structured_output_config.json_schema.value();
+        try {
+            return "json_schema:" + nlohmann::ordered_json::parse(json_schema).dump();
+        } catch (const nlohmann::json::parse_error&) {
+            return "json_schema:" + json_schema;
+        }
+    } else if (structured_output_config.regex.has_value()) {
+        return "regex:" + structured_output_config.regex.value();
+    } else if (structured_output_config.grammar.has_value()) {
+        return "ebnf:" + structured_output_config.grammar.value();
+    } else if (structured_output_config.structural_tags_config.has_value()) {
+        return "structural_tags:" + structured_output_config.structural_tags_config.value().to_string();
+    } else if (structured_output_config.compound_grammar.has_value()) {
+        return "compound:" + std::visit([](const auto& grammar) -> std::string {
+            using T = std::decay_t<decltype(grammar)>;
+            if constexpr (std::is_same_v<T, std::shared_ptr<StructuredOutputConfig::Concat>> ||
+                          std::is_same_v<T, std::shared_ptr<StructuredOutputConfig::Union>>) {
+                return grammar ? grammar->to_string() : "null";
+            } else {
+                return grammar.to_string();
+            }
+        }, structured_output_config.compound_grammar.value());
+    }
+    OPENVINO_THROW("No grammar definition provided for structured output generation.");
+}
+
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,102 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "openvino/genai/generation_config.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Returns the key under which the compiled grammar is cached.
+ *
+ * JSON schemas are normalized, so schemas which differ only in formatting share the compiled grammar. Order of object
+ * keys is preserved, since it defines the order of properties in the generated JSON.
+ */
+std::string get_grammar_key(const StructuredOutputConfig& structured_output_config);
+
+/**
+ * @brief Thread-safe LRU cache of grammars compiled in background.
+ *
+ * Cached grammars are shared between requests as futures, so a request may start before its grammar is compiled.
+ * Grammars which failed to compile are not kept, the compilation is started again on the next request.
+ */
+template <typename CompiledGrammar>
+class CompiledGrammarCache {
+public:
+    using CompiledGrammarFuture = std::shared_future<CompiledGrammar>;
+
+    explicit CompiledGrammarCache(size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Returns cached grammar for a given key or starts its compilation.
+     * @param compile starts the compilation on cache miss, it's called under the cache lock
+     */
+    CompiledGrammarFuture get_or_compile(const std::string& key, const std::function<CompiledGrammarFuture()>& compile) {
+        // destroyed after the lock is released, as destruction of the last reference to a future may wait for
+        // the compilation to finish
+        CompiledGrammarsList evicted;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(key);
+        if (it != m_index.end()) {
+            if (!has_failed(it->second->second)) {
+                m_compiled_grammars.splice(m_compiled_grammars.begin(), m_compiled_grammars, it->second);
+                return it->second->second;
+            }
+            evicted.splice(evicted.end(), m_compiled_grammars, it->second);
+            m_index.erase(it);
+        }
+
+        CompiledGrammarFuture compiled_grammar = compile();
+        m_compiled_grammars.emplace_front(key, compiled_grammar);
+        m_index[key] = m_compiled_grammars.begin();
+        if (m_compiled_grammars.size() > m_capacity) {
+            m_index.erase(m_compiled_grammars.back().first);
+            evicted.splice(evicted.end(), m_compiled_grammars, std::prev(m_compiled_grammars.end()));
+        }
+        return compiled_grammar;
+    }
+
+    bool contains(const std::string& key) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_index.count(key) > 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_compiled_grammars.size();
+    }
+
+private:
+    static bool has_failed(const CompiledGrammarFuture& compiled_grammar) {
+        if (compiled_grammar.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        try {
+            compiled_grammar.get();
+        } catch (...) {
+            return true;
+        }
+        return false;
+    }
+
+    // { grammar key, compiled grammar }, most recently used first
+    using CompiledGrammarsList = std::list<std::pair<std::string, CompiledGrammarFuture>>;
+    CompiledGrammarsList m_compiled_grammars;
+    std::unordered_map<std::string, typename CompiledGrammarsList::iterator> m_index;
+    size_t m_capacity;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace genai
+} // namespace ov
@@ -33,13 +33,7 @@ StructuredOutputController::StructuredOutputController(const ov::genai::Tokenize
                                                        std::optional<int> vocab_size)
     : m_tokenizer_impl(tokenizer_impl), m_vocab_size(vocab_size) {}
 
-void StructuredOutputController::validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) {
-    OPENVINO_ASSERT(structured_output_config.has_value());
-    std::string backend_name = structured_output_config.value().backend.value_or(get_default_backend_name());
-
-    std::unique_lock<std::mutex> lock(m_mutex);
-
-    // Check if backend already instantiated
+IStructuredOutputImpl& StructuredOutputController::get_backend(const std::string& backend_name) {
     auto impl_it = m_impls.find(backend_name);
     if (impl_it == m_impls.end()) {
         // Backend not instantiated yet, create it
@@ -48,50 +42,57 @@ void StructuredOutputController::validate_grammar(const std::optional<Structured
         if (factory_it == registry.end()) {
             OPENVINO_THROW("Structured output backend not found: " + backend_name);
         }
+
         // Create the backend instance and store it
+        const auto start = std::chrono::steady_clock::now();
         m_impls[backend_name] = factory_it->second(m_tokenizer_impl, m_vocab_size);
         impl_it = m_impls.find(backend_name);
+        const auto end = std::chrono::steady_clock::now();
+        m_init_grammar_compiler_times[backend_name] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
     }
-    impl_it->second->validate_grammar(structured_output_config);
+    return *impl_it->second;
+}
+
+void StructuredOutputController::validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) {
+    OPENVINO_ASSERT(structured_output_config.has_value());
+    std::string backend_name = structured_output_config.value().backend.value_or(get_default_backend_name());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    get_backend(backend_name).validate_grammar(structured_output_config);
 }
 
 std::shared_ptr<LogitTransformers::ILogitTransformer> StructuredOutputController::get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) {
     OPENVINO_ASSERT(sampling_parameters.structured_output_config.has_value());
     std::string backend_name = sampling_parameters.structured_output_config.value().backend.value_or(get_default_backend_name());
     std::unique_lock<std::mutex> lock(m_mutex);
-    auto impl_it = m_impls.find(backend_name);
-    if (impl_it == m_impls.end()) {
-        // Backend not instantiated yet, create it
-        auto& registry = get_backend_registry();
-        auto factory_it = registry.find(backend_name);
-        if (factory_it == registry.end()) {
-            OPENVINO_THROW("Structured output backend not found: " + backend_name);
-        }
+    // compilation time is recorded by the backend, the transformer may be returned before the grammar is compiled
+    return get_backend(backend_name).get_logits_transformer(sampling_parameters);
+}
 
-        // Create the backend instance and store it
-        const auto start = std::chrono::steady_clock::now();
-        m_impls[backend_name] = factory_it->second(m_tokenizer_impl, m_vocab_size);
-        impl_it = m_impls.find(backend_name);
-        const auto end = std::chrono::steady_clock::now();
-        m_init_grammar_compiler_times[backend_name] = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+void StructuredOutputController::prefetch_grammar(const ov::genai::GenerationConfig& sampling_parameters) {
+    if (!sampling_parameters.structured_output_config.has_value()) {
+        return;
     }
-
-    // Use the instantiated backend
-    const auto start = std::chrono::steady_clock::now();
-    auto logit_transformer = impl_it->second->get_logits_transformer(sampling_parameters);
-    const auto end = std::chrono::steady_clock::now();
-    m_grammar_compile_times.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
-    return logit_transformer;
+    std::string backend_name = sampling_parameters.structured_output_config.value().backend.value_or(get_default_backend_name());
+    std::unique_lock<std::mutex> lock(m_mutex);
+    get_backend(backend_name).prefetch_grammar(sampling_parameters);
 }
 
 std::pair<std::map<std::string, float>, std::vector<float>> StructuredOutputController::get_times() const {
     std::unique_lock<std::mutex> lock(m_mutex);
-    return {m_init_grammar_compiler_times, m_grammar_compile_times};
+    std::vector<float> grammar_compile_times;
+    for (const auto& [backend_name, impl] : m_impls) {
+        const std::vector<float> backend_compile_times = impl->get_compile_times();
+        grammar_compile_times.insert(grammar_compile_times.end(), backend_compile_times.begin(), backend_compile_times.end());
+    }
+    return {m_init_grammar_compiler_times, grammar_compile_times};
 }
 
 void StructuredOutputController::clear_compile_times() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_grammar_compile_times.clear();
+    for (const auto& [backend_name, impl] : m_impls) {
+        impl->clear_compile_times();
+    }
 }
 
 } // namespace genai
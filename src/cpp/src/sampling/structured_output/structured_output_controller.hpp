@@ -49,6 +49,11 @@ public:
     virtual std::shared_ptr<ov::genai::LogitTransformers::ILogitTransformer>
         get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) = 0;
     virtual void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) = 0;
+    // Starts preparation of the grammar (e.g. compilation) in background ahead of the get_logits_transformer call
+    virtual void prefetch_grammar(const ov::genai::GenerationConfig& sampling_parameters) {}
+    // Durations of grammar compilations in microseconds, recorded when the compilations finish
+    virtual std::vector<float> get_compile_times() const { return {}; }
+    virtual void clear_compile_times() {}
 };
 
 /**
@@ -72,6 +77,7 @@ public:
 
     void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config);
     std::shared_ptr<ov::genai::LogitTransformers::ILogitTransformer> get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters);
+    void prefetch_grammar(const ov::genai::GenerationConfig& sampling_parameters);
 
     static void register_backend(const std::string& name, BackendFactory factory);
     static void set_default_backend(const std::string& name);
@@ -82,8 +88,10 @@ public:
     void clear_compile_times();
     std::optional<int> get_vocab_size() const { return m_vocab_size; }
 private:
+    // returns instantiated backend, creates it if needed; m_mutex must be held by the caller
+    IStructuredOutputImpl& get_backend(const std::string& backend_name);
+
     std::map<std::string, float> m_init_grammar_compiler_times;
-    std::vector<float> m_grammar_compile_times;
     std::unordered_map<std::string, std::unique_ptr<IStructuredOutputImpl>> m_impls;
     const Tokenizer::TokenizerImpl& m_tokenizer_impl;
     std::optional<int> m_vocab_size;
@@ -12,6 +12,7 @@ XGrammarStructuredOutput::XGrammarStructuredOutput(const ov::genai::Tokenizer::T
     if (!vocab_size.has_value()) {
         vocab_size = vocab_vector.size();
     }
+    m_vocab_size = vocab_size.value();
     
     auto tokenizer_info = xgrammar::TokenizerInfo(
         std::move(vocab_vector),
@@ -20,7 +21,7 @@ XGrammarStructuredOutput::XGrammarStructuredOutput(const ov::genai::Tokenizer::T
         std::vector<int32_t>{static_cast<int32_t>(tokenizer_impl.m_eos_token_id)},
         true
     );
-    m_grammar_compiler = std::make_unique<xgrammar::GrammarCompiler>(std::move(tokenizer_info));
+    m_grammar_compiler = std::make_shared<xgrammar::GrammarCompiler>(std::move(tokenizer_info));
 }
 
 
@@ -87,32 +88,65 @@ void XGrammarStructuredOutput::validate_grammar(const std::optional<StructuredOu
     create_grammar(structured_output_config);
 }
 
+std::shared_future<xgrammar::CompiledGrammar>
+XGrammarStructuredOutput::get_compiled_grammar(const StructuredOutputConfig& structured_output_config) {
+    // the cache holds grammars being compiled as well, so concurrent requests with the same grammar share one compilation
+    return m_compiled_grammars.get_or_compile(get_grammar_key(structured_output_config), [&]() {
+        // grammar is parsed synchronously to report errors in its definition right away, only compilation is deferred
+        auto grammar = create_grammar(structured_output_config);
+        return m_compile_threads.submit([this, grammar = std::move(grammar)]() {
+            const auto start = std::chrono::steady_clock::now();
+            auto compiled_grammar = m_grammar_compiler->CompileGrammar(grammar);
+            const auto end = std::chrono::steady_clock::now();
+            std::lock_guard<std::mutex> lock(m_compile_times_mutex);
+            m_compile_times.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            return compiled_grammar;
+        }).share();
+    });
+}
+
+std::vector<float> XGrammarStructuredOutput::get_compile_times() const {
+    std::lock_guard<std::mutex> lock(m_compile_times_mutex);
+    return m_compile_times;
+}
+
+void XGrammarStructuredOutput::clear_compile_times() {
+    std::lock_guard<std::mutex> lock(m_compile_times_mutex);
+    m_compile_times.clear();
+}
+
+void XGrammarStructuredOutput::prefetch_grammar(const ov::genai::GenerationConfig& sampling_parameters) {
+    if (!sampling_parameters.structured_output_config.has_value()) {
+        return;
+    }
+    sampling_parameters.structured_output_config.value().validate();
+    get_compiled_grammar(sampling_parameters.structured_output_config.value());
+}
+
 std::shared_ptr<LogitTransformers::ILogitTransformer>
 XGrammarStructuredOutput::get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) {
     if (!sampling_parameters.structured_output_config.has_value()) {
         OPENVINO_THROW("Structured output is not enabled in the provided GenerationConfig.");
     }
     sampling_parameters.structured_output_config.value().validate();
-    auto grammar = create_grammar(sampling_parameters.structured_output_config);
-    auto compiled_grammar = m_grammar_compiler->CompileGrammar(grammar);
+    auto compiled_grammar = get_compiled_grammar(sampling_parameters.structured_output_config.value());
     std::vector<int> override_stop_tokens(sampling_parameters.stop_token_ids.begin(), sampling_parameters.stop_token_ids.end());
-    return std::make_shared<LogitTransformers::XGrammarLogitsTransformer>(std::move(compiled_grammar), override_stop_tokens);
+    return std::make_shared<LogitTransformers::XGrammarLogitsTransformer>(std::move(compiled_grammar), m_vocab_size, override_stop_tokens);
 }
 
 namespace LogitTransformers {
 
 XGrammarLogitsTransformer::XGrammarLogitsTransformer(
-    const xgrammar::CompiledGrammar& compiled_grammar,
+    std::shared_future<xgrammar::CompiledGrammar> compiled_grammar,
+    int vocab_size,
     std::optional<std::vector<int>> override_stop_tokens,
     bool terminate_without_stop_token,
     int max_rollback_tokens
-): m_grammar_matcher(
-      compiled_grammar,
-      override_stop_tokens,
-      terminate_without_stop_token,
-      max_rollback_tokens
-  ) {
-    m_vocab_size = compiled_grammar.GetTokenizerInfo().GetVocabSize();
+): m_compiled_grammar(std::move(compiled_grammar)),
+   m_override_stop_tokens(std::move(override_stop_tokens)),
+   m_terminate_without_stop_token(terminate_without_stop_token),
+   m_max_rollback_tokens(max_rollback_tokens) {
+    m_vocab_size = vocab_size;
     
     // Divide vocab into 32 for bitmask and ceil to the nearest integer
     // This is to ensure that we can use a bitmask to represent the vocabulary
@@ -143,17 +177,39 @@ XGrammarLogitsTransformer::XGrammarLogitsTransformer(
     m_next_token_logits->shape = &m_logits_shape[0];
 }
 
+xgrammar::GrammarMatcher& XGrammarLogitsTransformer::get_grammar_matcher() {
+    if (!m_grammar_matcher.has_value()) {
+        // waits for the grammar compilation if it's still in progress
+        m_grammar_matcher.emplace(
+            m_compiled_grammar.get(),
+            m_override_stop_tokens,
+            m_terminate_without_stop_token,
+            m_max_rollback_tokens
+        );
+    }
+    return m_grammar_matcher.value();
+}
+
 void XGrammarLogitsTransformer::accept_tokens(const TokenIds& input_ids) {
+    auto& grammar_matcher = get_grammar_matcher();
     for (const auto& token : input_ids) {
-        m_grammar_matcher.AcceptToken(token);
+        grammar_matcher.AcceptToken(token);
+    }
+    m_is_token_bitmask_filled = false;
+}
+
+void XGrammarLogitsTransformer::prepare() {
+    if (!m_is_token_bitmask_filled) {
+        get_grammar_matcher().FillNextTokenBitmask(m_token_bitmask.get());
+        m_is_token_bitmask_filled = true;
     }
 }
 
 void XGrammarLogitsTransformer::apply(Logits& logits) {
     m_next_token_logits->data = logits.m_data;
 
-    m_grammar_matcher.FillNextTokenBitmask(m_token_bitmask.get());
-    if (!m_grammar_matcher.IsTerminated()) {
+    prepare();
+    if (!get_grammar_matcher().IsTerminated()) {
         xgrammar::ApplyTokenBitmaskInplaceCPU(m_next_token_logits.get(), *m_token_bitmask, m_vocab_size);
     }
 }
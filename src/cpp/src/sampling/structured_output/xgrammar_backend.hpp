@@ -7,8 +7,12 @@
 #include <xgrammar/compiler.h>
 #include <xgrammar/tokenizer_info.h>
 #include "structured_output_controller.hpp"
+#include "compiled_grammar_cache.hpp"
 #include "dlpack/dlpack.h"
+#include "sampling/threadpool.hpp"
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -23,11 +27,14 @@ namespace LogitTransformers {
  * It encapsulates the XGrammar backend implementation and exposes a public apply method, 
  * which applies grammar constraints to the logits each time a new token is generated, and 
  * accepts tokens to update the internal state of the grammar matcher.
+ * The grammar may still be compiled in background when the transformer is created, the grammar matcher
+ * is created on the first use.
  */
 class XGrammarLogitsTransformer : public IStatefulLogitTransformer {
 public:                            
-    explicit XGrammarLogitsTransformer(
-        const xgrammar::CompiledGrammar& compiled_grammar,
+    XGrammarLogitsTransformer(
+        std::shared_future<xgrammar::CompiledGrammar> compiled_grammar,
+        int vocab_size,
         std::optional<std::vector<int>> override_stop_tokens = std::nullopt,
         bool terminate_without_stop_token = false,
         int max_rollback_tokens = 0
@@ -35,9 +42,19 @@ public:
 
     void accept_tokens(const TokenIds& input_ids) override;
 
+    // Fills the token bitmask for the current matcher state, so apply only masks logits
+    void prepare() override;
+
     void apply(Logits& logits) override;
 protected:
-    xgrammar::GrammarMatcher m_grammar_matcher;
+    xgrammar::GrammarMatcher& get_grammar_matcher();
+
+    std::shared_future<xgrammar::CompiledGrammar> m_compiled_grammar;
+    std::optional<xgrammar::GrammarMatcher> m_grammar_matcher;
+    std::optional<std::vector<int>> m_override_stop_tokens;
+    bool m_terminate_without_stop_token;
+    int m_max_rollback_tokens;
+    bool m_is_token_bitmask_filled = false;
 
     ov::Tensor m_token_bitmask_ov;
     std::shared_ptr<DLTensor> m_token_bitmask;
@@ -73,17 +90,38 @@ public:
      * The get_logits_transformer method retrieves the appropriate logit transformer based on
      * the JSON schema, regex, or EBNF grammar provided in the GenerationConfig. Note that although
      * m_grammar_compiler is created only once in the constructor, a new logit transformer is created each time
-     * get_logits_transformer is called.
+     * get_logits_transformer is called. Compiled grammars are shared between requests via LRU cache.
      * @param sampling_parameters The generation configuration parameters that may include JSON schema, regex, or EBNF grammar.
      * @return A shared pointer to the logit transformer that applies XGrammar grammar matching.
      */
     std::shared_ptr<LogitTransformers::ILogitTransformer> get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) override;
     void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) override;
+    void prefetch_grammar(const ov::genai::GenerationConfig& sampling_parameters) override;
+    std::vector<float> get_compile_times() const override;
+    void clear_compile_times() override;
 private:
-    std::unique_ptr<xgrammar::GrammarCompiler> m_grammar_compiler;
+    std::shared_ptr<xgrammar::GrammarCompiler> m_grammar_compiler;
+    int m_vocab_size;
+
+    // number of compiled grammars kept in cache
+    static constexpr size_t COMPILED_GRAMMARS_CACHE_SIZE = 64;
+    CompiledGrammarCache<xgrammar::CompiledGrammar> m_compiled_grammars{COMPILED_GRAMMARS_CACHE_SIZE};
 
     static xgrammar::Grammar parse_compound_grammar(const StructuredOutputConfig::CompoundGrammar& compound_grammar);
     xgrammar::Grammar create_grammar(const std::optional<StructuredOutputConfig>& structured_output_config);
+
+    /**
+     * @brief Returns compiled grammar from the cache or queues its compilation to the compilation threads.
+     */
+    std::shared_future<xgrammar::CompiledGrammar> get_compiled_grammar(const StructuredOutputConfig& structured_output_config);
+
+    std::vector<float> m_compile_times;
+    mutable std::mutex m_compile_times_mutex;
+
+    // the grammar compiler parallelizes compilation of a single grammar itself, so a few threads are enough
+    static constexpr size_t NUM_COMPILE_THREADS = 2;
+    // declared last, so queued compilations are finished before other members are destroyed
+    ThreadPool m_compile_threads{NUM_COMPILE_THREADS};
 };
 
 
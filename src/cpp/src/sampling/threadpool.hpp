@@ -1,3 +1,5 @@
+#pragma once
+
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -7,6 +9,11 @@
 #include <thread>
 #include <utility>
 #include <atomic>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 class ThreadPool {
 
@@ -20,10 +27,15 @@ private:
 public:
     ThreadPool(const ThreadPool& rhs) = delete;
     ThreadPool(ThreadPool&& rhs) = delete;
-    ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
+    /**
+     * @param cpu_ids CPUs to run worker threads on, threads are not pinned if empty.
+     * Pinning is applied on Linux only.
+     */
+    ThreadPool(size_t num_threads = std::thread::hardware_concurrency(), std::vector<size_t> cpu_ids = {})
     {
         for (size_t i = 0; i < num_threads; ++i) {
-            threads.emplace_back([this] {
+            threads.emplace_back([this, cpu_ids] {
+                pin_current_thread(cpu_ids);
                 while (true) {
                     std::function<void()> task;
                     {
@@ -43,6 +55,23 @@ public:
         }
     }
 
+    static void pin_current_thread(const std::vector<size_t>& cpu_ids) {
+#ifdef __linux__
+        if (cpu_ids.empty()) {
+            return;
+        }
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (size_t cpu_id : cpu_ids) {
+            if (cpu_id < CPU_SETSIZE) {
+                CPU_SET(cpu_id, &cpu_set);
+            }
+        }
+        // best effort, pinning fails if none of the CPUs is available to the process
+        sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#endif
+    }
+
     ~ThreadPool()
     {
         {
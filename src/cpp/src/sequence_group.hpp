@@ -5,6 +5,8 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
+#include <limits>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -259,6 +261,9 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
     size_t m_max_content_len = 0;
     // max validation length within a group to check generated tokens
     size_t m_num_validation_tokens = 0;
+    // number of candidates to be generated by draft model / prompt lookup per step,
+    // differs from GenerationConfig::num_assistant_tokens when adaptive_num_assistant_tokens is set
+    size_t m_num_assistant_tokens = 0;
     // flag to enable/disable token generation, e.g. in speculative decoding scenario
     bool m_is_gen_paused = false;
     // output seq len at current iteration
@@ -266,11 +271,17 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // time when the request was created, used by latency-aware scheduling and latency metrics
+    std::chrono::steady_clock::time_point m_arrival_time = std::chrono::steady_clock::now();
+    // whether time to first token was already reported to pipeline metrics
+    bool m_is_first_token_registered = false;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
           m_block_size(block_size),
-          m_generation_stream(GenerationStream::create()) { }
+          m_generation_stream(GenerationStream::create()),
+          m_num_assistant_tokens(sampling_params.num_assistant_tokens) { }
 
     bool out_of_memory() const {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
@@ -662,6 +673,15 @@ public:
         return m_sampling_params;
     }
 
+    size_t get_num_assistant_tokens() const {
+        return m_num_assistant_tokens;
+    }
+
+    void set_num_assistant_tokens(size_t num_assistant_tokens) {
+        OPENVINO_ASSERT(num_assistant_tokens > 0 && num_assistant_tokens <= m_sampling_params.num_assistant_tokens);
+        m_num_assistant_tokens = num_assistant_tokens;
+    }
+
     void set_out_of_memory() {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
             if (m_sequences[seq_id]->is_running()) {
@@ -808,6 +828,45 @@ public:
     size_t get_max_new_tokens() const {
         return m_sampling_params.get_max_new_tokens(get_prompt_len());
     }
+
+    size_t get_priority() const {
+        return m_sampling_params.priority;
+    }
+
+    /**
+     * @return Time in milliseconds passed since the request was added to the pipeline.
+     */
+    float get_elapsed_time_ms() const {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_arrival_time).count();
+    }
+
+    /**
+     * @return Whether at least one sequence of the group has generated a token.
+     */
+    bool has_generated_tokens() const {
+        return std::any_of(m_sequences.begin(), m_sequences.end(), [] (Sequence::CPtr seq) {
+            return seq->get_generated_len() > 0;
+        });
+    }
+
+    /**
+     * @return Remaining time in milliseconds before the TTFT target of the request is missed (negative if it is already missed).
+     * Requests without a TTFT target or which have already produced a token have infinite slack.
+     */
+    float get_ttft_slack_ms() const {
+        if (m_sampling_params.ttft_target_ms == 0 || m_is_first_token_registered || has_generated_tokens()) {
+            return std::numeric_limits<float>::infinity();
+        }
+        return static_cast<float>(m_sampling_params.ttft_target_ms) - get_elapsed_time_ms();
+    }
+
+    bool is_first_token_registered() const {
+        return m_is_first_token_registered;
+    }
+
+    void set_first_token_registered() {
+        m_is_first_token_registered = true;
+    }
 };
 
 inline std::shared_ptr<SequenceGroup> Sequence::get_sequence_group_ptr() const {
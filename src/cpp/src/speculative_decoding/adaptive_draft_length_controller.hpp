@@ -0,0 +1,95 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Selects the number of candidates generated by draft model / prompt lookup per step for a single request,
+ * so that the expected number of accepted tokens per unit of time is maximal.
+ *
+ * Candidates are assumed to be accepted independently with probability `alpha`, so a chain of `k` candidates yields
+ * `(1 - alpha^(k + 1)) / (1 - alpha)` tokens per step (accepted candidates plus the token sampled by the main model),
+ * while the step costs `1 + k * (draft_cost_ratio + validation_cost_ratio)` main model steps, where the ratios are costs of
+ * generation and validation of one candidate relative to the main model step. `alpha` is estimated from exponentially weighted
+ * counts of accepted and rejected candidates.
+ */
+class AdaptiveDraftLengthController {
+public:
+    /**
+     * Constructs the AdaptiveDraftLengthController.
+     * @param max_num_assistant_tokens Upper bound of the number of candidates per step.
+     * @param validation_cost_ratio Cost of validation of one candidate by the main model relative to the main model step.
+     * Main model steps are usually memory bound, so validation of extra tokens is cheap, but not free.
+     * @param forgetting_factor Weight decay applied to previous observations on each new observation, in (0, 1].
+     */
+    explicit AdaptiveDraftLengthController(size_t max_num_assistant_tokens, float validation_cost_ratio = 0.02f, float forgetting_factor = 0.8f)
+        : m_max_num_assistant_tokens(max_num_assistant_tokens),
+          m_validation_cost_ratio(validation_cost_ratio),
+          m_forgetting_factor(forgetting_factor) {
+        OPENVINO_ASSERT(max_num_assistant_tokens > 0, "Max number of assistant tokens must be positive");
+        OPENVINO_ASSERT(forgetting_factor > 0.0f && forgetting_factor <= 1.0f, "Forgetting factor must be in (0, 1], got ", forgetting_factor);
+    }
+
+    /**
+     * Registers result of candidates validation by the main model.
+     * @param num_candidates Number of candidates validated at the step.
+     * @param num_accepted Number of candidates accepted by the main model.
+     */
+    void register_validation(size_t num_candidates, size_t num_accepted) {
+        if (num_candidates == 0) {
+            return;
+        }
+        OPENVINO_ASSERT(num_accepted <= num_candidates);
+        m_num_accepted = m_num_accepted * m_forgetting_factor + num_accepted;
+        m_num_rejected = m_num_rejected * m_forgetting_factor + (num_accepted < num_candidates ? 1.0f : 0.0f);
+    }
+
+    /**
+     * @return Estimated probability of a candidate to be accepted, or 1 if no candidates were validated yet.
+     */
+    float get_acceptance_probability() const {
+        const float num_observed = m_num_accepted + m_num_rejected;
+        return num_observed > 0.0f ? m_num_accepted / num_observed : 1.0f;
+    }
+
+    /**
+     * @param draft_cost_ratio Cost of generation of one candidate relative to the cost of the main model step.
+     * @return Number of candidates in [1, max_num_assistant_tokens] maximizing the expected number of generated tokens per unit of time.
+     */
+    size_t get_num_assistant_tokens(float draft_cost_ratio) const {
+        const double candidate_cost = static_cast<double>(draft_cost_ratio) + m_validation_cost_ratio;
+        const double alpha = std::min(get_acceptance_probability(), 1.0f);
+        size_t best_num_assistant_tokens = 1;
+        double best_throughput = 0.0, expected_tokens = 1.0, alpha_power = 1.0;
+        for (size_t num_assistant_tokens = 1; num_assistant_tokens <= m_max_num_assistant_tokens; ++num_assistant_tokens) {
+            // expected tokens per step is a geometric series sum: 1 + alpha + ... + alpha^k
+            alpha_power *= alpha;
+            expected_tokens += alpha_power;
+            const double throughput = expected_tokens / (1.0 + num_assistant_tokens * candidate_cost);
+            if (throughput > best_throughput) {
+                best_throughput = throughput;
+                best_num_assistant_tokens = num_assistant_tokens;
+            }
+        }
+        return best_num_assistant_tokens;
+    }
+
+private:
+    size_t m_max_num_assistant_tokens;
+    float m_validation_cost_ratio;
+    float m_forgetting_factor;
+
+    // exponentially weighted number of accepted candidates and number of rejections
+    float m_num_accepted = 0.0f;
+    float m_num_rejected = 0.0f;
+};
+
+}  // namespace ov::genai
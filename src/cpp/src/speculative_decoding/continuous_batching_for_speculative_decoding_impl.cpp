@@ -302,6 +302,14 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_num_assistant_tokens(uint64_t request_id, size_t num_assistant_tokens) {
+    for (auto& request : m_requests) {
+        if (request->get_request_id() == request_id) {
+            request->set_num_assistant_tokens(num_assistant_tokens);
+        }
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
@@ -335,7 +343,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == 0 && sampling_params.num_return_sequences > 1) {
                 request->pause_generation(true);
-            } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
+            } else if (request->get_num_assistant_tokens() <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
                 request->pause_generation(true);
             } else if (request->get_max_new_tokens() == 0) {
                 request->pause_generation(true);
@@ -33,6 +33,8 @@ public:
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    void set_num_assistant_tokens(uint64_t request_id, size_t num_assistant_tokens);
+
     RawPerfMetrics raw_perf_metrics;
 
 protected:
@@ -112,6 +112,9 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
     draft_sampling_params.stop_strings = {};
+    if (sampling_params.adaptive_num_assistant_tokens) {
+        m_draft_length_controllers.insert_or_assign(request_id, AdaptiveDraftLengthController(sampling_params.num_assistant_tokens));
+    }
     m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids, draft_sampling_params, token_type_ids)});
     return m_main_pipeline->add_request(request_id, input_ids, sampling_params, token_type_ids);
 }
@@ -124,6 +127,9 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
     draft_sampling_params.stop_strings = {};
+    if (sampling_params.adaptive_num_assistant_tokens) {
+        m_draft_length_controllers.insert_or_assign(request_id, AdaptiveDraftLengthController(sampling_params.num_assistant_tokens));
+    }
     m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, prompt, draft_sampling_params)});
     return m_main_pipeline->add_request(request_id, prompt, sampling_params);
 }
@@ -188,6 +194,16 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
     }
 
+    // draft model makes one step per candidate, so the longest chain of candidates defines the number of draft model steps
+    size_t num_draft_steps = 0;
+    for (const auto& sequence_info : update_sequence_info) {
+        num_draft_steps = std::max(num_draft_steps, sequence_info.second.inserted_tokens_cnt);
+    }
+    if (num_draft_steps > 0 && main_timer.get_duration() > 0) {
+        float draft_cost_ratio = draft_timer.get_duration() / num_draft_steps / main_timer.get_duration();
+        m_draft_cost_ratio = m_draft_cost_ratio == 0.0f ? draft_cost_ratio : 0.9f * m_draft_cost_ratio + 0.1f * draft_cost_ratio;
+    }
+
     // finish draft request if the generation was completed
     for (const auto& draft_request : draft_generated_requests) {
         auto request_id = draft_request.first;
@@ -195,6 +211,7 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
             m_draft_pipeline->finish_request(request_id);
             // remove draft_generation_handle from queue
             m_draft_generations.erase(request_id);
+            m_draft_length_controllers.erase(request_id);
         }
         auto updated_seq_info = update_sequence_info[request_id];
         m_sd_metrics.update_draft_generated_len(request_id, updated_seq_info.inserted_tokens_cnt);
@@ -206,6 +223,13 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+
+        auto controller_it = m_draft_length_controllers.find(request_id);
+        if (controller_it != m_draft_length_controllers.end()) {
+            size_t num_accepted = updated_seq_info.inserted_tokens_cnt - std::min(updated_seq_info.removed_tokens_cnt, updated_seq_info.inserted_tokens_cnt);
+            controller_it->second.register_validation(updated_seq_info.inserted_tokens_cnt, num_accepted);
+            m_draft_pipeline->set_num_assistant_tokens(request_id, controller_it->second.get_num_assistant_tokens(m_draft_cost_ratio));
+        }
     }
 
     step_timer.end();
@@ -354,6 +378,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_speculative_decoding_me
 void ContinuousBatchingPipeline::SpeculativeDecodingImpl::drop_requests() {
     m_draft_pipeline->finish_request();
     m_main_pipeline->finish_request();
+    m_draft_length_controllers.clear();
 }
 
 
@@ -7,6 +7,7 @@
 #include "continuous_batching/pipeline_impl.hpp"
 #include "speculative_decoding/continuous_batching_for_speculative_decoding_impl.hpp"
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
+#include "speculative_decoding/adaptive_draft_length_controller.hpp"
 #include "openvino/genai/speculative_decoding/perf_metrics.hpp"
 
 namespace ov::genai {
@@ -46,6 +47,11 @@ protected:
     std::mutex m_draft_generations_mutex;
     std::map<uint64_t, GenerationHandle> m_draft_generations;
 
+    // controllers of candidates number for requests with adaptive_num_assistant_tokens
+    std::map<uint64_t, AdaptiveDraftLengthController> m_draft_length_controllers;
+    // exponentially averaged duration of a draft model step relative to the main model step
+    float m_draft_cost_ratio = 0.0f;
+
     void drop_requests();
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
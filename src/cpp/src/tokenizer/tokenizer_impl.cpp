@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "tokenizer/tokenizer_impl.hpp"
+
+#include <cctype>
+
 #include "add_second_input_pass.hpp"
 #include "sampling/structured_output/structured_output_controller.hpp"
 
@@ -143,6 +146,28 @@ std::vector<std::string> read_vocab_from_detokenizer_model(const std::shared_ptr
     return vocab_vector;
 }
 
+// Restores bytes of a token which doesn't decode into valid UTF-8 alone, e.g. a part of a multibyte character
+std::string restore_token_bytes(const std::string& raw_token) {
+    // SentencePiece byte fallback tokens like <0xE2>
+    if (raw_token.size() == 6 && raw_token.compare(0, 3, "<0x") == 0 && raw_token.back() == '>' &&
+        std::isxdigit(static_cast<unsigned char>(raw_token[3])) && std::isxdigit(static_cast<unsigned char>(raw_token[4]))) {
+        return std::string(1, static_cast<char>(std::stoi(raw_token.substr(3, 2), nullptr, 16)));
+    }
+    // byte level BPE vocabularies keep either the bytes or characters of GPT-2 bytes to unicode mapping, which take up to 2 bytes
+    const auto& bytes_decoder = unicode_to_bytes();
+    std::string bytes;
+    for (size_t i = 0; i < raw_token.size(); ) {
+        const size_t char_length = (static_cast<unsigned char>(raw_token[i]) & 0xE0) == 0xC0 ? 2 : 1;
+        auto it = bytes_decoder.find(raw_token.substr(i, char_length));
+        if (it == bytes_decoder.end()) {
+            return raw_token;
+        }
+        bytes.push_back(static_cast<char>(it->second));
+        i += char_length;
+    }
+    return bytes;
+}
+
 template <typename T>
 void Tokenizer::TokenizerImpl::set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags) {
     // better to store which value is in the state locally so that get_state is not called every infer request
@@ -202,7 +227,14 @@ void Tokenizer::TokenizerImpl::set_state_if_necessary(CircularBufferQueueElement
 
     std::optional<bool> is_max_length_set_val = max_length_val.has_value();
 
-    ov::AnyMap& state_flags = m_request_to_state_flags[&infer_request_guard.get()];
+    ov::AnyMap* state_flags_ptr = nullptr;
+    {
+        // the map is shared by concurrent encode / decode calls, while flags of an infer request are used only by its holder;
+        // references to elements of unordered_map stay valid when other elements are inserted
+        std::lock_guard<std::mutex> lock(m_request_to_state_flags_mutex);
+        state_flags_ptr = &m_request_to_state_flags[&infer_request_guard.get()];
+    }
+    ov::AnyMap& state_flags = *state_flags_ptr;
 
     for (auto& state : infer_request_guard.get().query_state()) {
         auto name = state.get_name();
@@ -272,7 +304,7 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::filesystem::path& mode
 
     std::shared_ptr<ov::Model> ov_tokenizer = nullptr;
     std::shared_ptr<ov::Model> ov_detokenizer = nullptr;
-    auto [filtered_properties, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+    auto [filtered_properties, enable_save_ov_model] = utils::extract_gguf_properties(properties, models_path);
     if (is_gguf_model(models_path)) {
         std::map<std::string, GGUFMetaData> tokenizer_config{};
         std::tie(ov_tokenizer, ov_detokenizer, tokenizer_config) =
@@ -769,12 +801,58 @@ std::string Tokenizer::TokenizerImpl::get_chat_template() {
     return m_chat_template;
 }
 
-std::shared_ptr<StructuredOutputController> Tokenizer::TokenizerImpl::get_structured_output_controller(std::optional<int> vocab_size) {
-    if (m_structured_output_controller == nullptr || vocab_size.has_value()) {
-        if (m_structured_output_controller != nullptr && vocab_size.has_value() &&
-            m_structured_output_controller->get_vocab_size() == *vocab_size) {
-            return m_structured_output_controller;
+std::shared_ptr<const std::vector<std::string>> Tokenizer::TokenizerImpl::get_detokenized_vocab() {
+    std::call_once(m_detokenized_vocab_flag, [this] {
+        m_detokenized_vocab = build_detokenized_vocab();
+    });
+    return m_detokenized_vocab;
+}
+
+std::shared_ptr<const std::vector<std::string>> Tokenizer::TokenizerImpl::build_detokenized_vocab() {
+    if (m_vocab.empty() || !m_ireq_queue_tokenizer || !m_ireq_queue_detokenizer) {
+        return nullptr;
+    }
+    // tokens are decoded after a prefix, otherwise the detokenizer strips a leading space as at the beginning of text
+    const ov::Tensor prefix_tensor = encode("a", {ov::genai::add_special_tokens(false)}).input_ids;
+    const std::vector<int64_t> prefix(prefix_tensor.data<int64_t>(), prefix_tensor.data<int64_t>() + prefix_tensor.get_size());
+    if (prefix.empty()) {
+        return nullptr;
+    }
+    const std::string decoded_prefix = decode(prefix);
+    const std::string replacement_character = "\xEF\xBF\xBD";
+
+    constexpr size_t BATCH_SIZE = 1024;
+    auto vocab = std::make_shared<std::vector<std::string>>(m_vocab.size());
+    std::vector<std::vector<int64_t>> lines;
+    for (size_t batch_begin = 0; batch_begin < m_vocab.size(); batch_begin += BATCH_SIZE) {
+        const size_t batch_end = std::min(batch_begin + BATCH_SIZE, m_vocab.size());
+        lines.assign(batch_end - batch_begin, prefix);
+        for (size_t token_id = batch_begin; token_id < batch_end; ++token_id) {
+            lines[token_id - batch_begin].push_back(static_cast<int64_t>(token_id));
+        }
+        const std::vector<std::string> decoded = decode(lines);
+        for (size_t token_id = batch_begin; token_id < batch_end; ++token_id) {
+            const std::string& text = decoded[token_id - batch_begin];
+            if (text.compare(0, decoded_prefix.size(), decoded_prefix) != 0) {
+                // the prefix is changed by the following token, so text of tokens depends on their neighbours
+                return nullptr;
+            }
+            std::string token_text = text.substr(decoded_prefix.size());
+            const std::string& raw_token = m_vocab[token_id];
+            if (token_text.find(replacement_character) != std::string::npos &&
+                raw_token.find(replacement_character) == std::string::npos) {
+                token_text = restore_token_bytes(raw_token);
+            }
+            (*vocab)[token_id] = std::move(token_text);
         }
+    }
+    return vocab;
+}
+
+std::shared_ptr<StructuredOutputController> Tokenizer::TokenizerImpl::get_structured_output_controller(std::optional<int> vocab_size) {
+    std::lock_guard<std::mutex> lock(m_structured_output_controller_mutex);
+    if (m_structured_output_controller == nullptr ||
+        (vocab_size.has_value() && m_structured_output_controller->get_vocab_size() != vocab_size)) {
         m_structured_output_controller = std::make_shared<StructuredOutputController>(*this, vocab_size);
     }
     return m_structured_output_controller;
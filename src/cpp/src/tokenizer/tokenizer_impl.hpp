@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
 
 #include "minja/minja.hpp"
 #include "minja/chat-template.hpp"
@@ -32,6 +33,7 @@ public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_tokenizer;
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
     std::unordered_map<ov::InferRequest*, ov::AnyMap> m_request_to_state_flags;
+    std::mutex m_request_to_state_flags_mutex;
     std::shared_ptr<void> m_shared_object_ov_tokenizers = nullptr;
     bool is_paired_input = false;
     bool m_older_than_24_5 = false;
@@ -43,7 +45,6 @@ public:
     std::string m_eos_token = {};
     std::string m_chat_template = {};
     std::vector<std::string> m_vocab = {};
-    std::shared_ptr<StructuredOutputController> m_structured_output_controller = nullptr;
 
     template <typename T>
     void set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags);
@@ -78,7 +79,27 @@ public:
 
     void set_chat_template(const std::string& chat_template);
     std::string get_chat_template();
+    /**
+     * Returns the controller shared by all users of the tokenizer, it's created on the first call. The controller is
+     * recreated if a different vocab_size is requested, so pipelines create it with vocab size of the model at construction.
+     */
     std::shared_ptr<StructuredOutputController> get_structured_output_controller(std::optional<int> vocab_size = std::nullopt);
+
+    /**
+     * Bytes which each token contributes to decoded text, indexed by token id. Unlike m_vocab, word splitting symbols
+     * like SentencePiece "▁" are already replaced and skipped special tokens are empty. The table is built by
+     * the detokenizer on the first call, nullptr is returned if tokens can't be decoded independently of their neighbours.
+     */
+    std::shared_ptr<const std::vector<std::string>> get_detokenized_vocab();
+
+private:
+    std::shared_ptr<const std::vector<std::string>> build_detokenized_vocab();
+
+    std::shared_ptr<StructuredOutputController> m_structured_output_controller = nullptr;
+    std::mutex m_structured_output_controller_mutex;
+
+    std::once_flag m_detokenized_vocab_flag;
+    std::shared_ptr<const std::vector<std::string>> m_detokenized_vocab = nullptr;
 };
 
 }  // namespace genai
@@ -308,7 +308,8 @@ bool is_gguf_model(const std::filesystem::path& file_path) {
 
 } // namespace
 
-std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_properties) {
+std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_properties,
+                                                    const std::filesystem::path& models_path) {
     bool enable_save_ov_model = false;
     ov::AnyMap properties = external_properties;
 
@@ -318,6 +319,16 @@ std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_p
         properties.erase(it);
     }
 
+    it = properties.find(ov::genai::gguf_cache_dir.name());
+    if (it != properties.end()) {
+        const std::string cache_dir = it->second.as<std::string>();
+        properties.erase(it);
+        // compiled models are cached next to converted ones, models read from IR aren't cached implicitly
+        if (!cache_dir.empty() && is_gguf_model(models_path) && properties.find(ov::cache_dir.name()) == properties.end()) {
+            properties[ov::cache_dir.name()] = cache_dir;
+        }
+    }
+
     return {properties, enable_save_ov_model};
 }
 
@@ -340,7 +351,9 @@ std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  c
     auto [filtered_properties, enable_save_ov_model] = extract_gguf_properties(properties);
     if (is_gguf_model(model_dir)) {
 #ifdef ENABLE_GGUF
-        return create_from_gguf(model_dir.string(), enable_save_ov_model);
+        auto cache_dir_it = properties.find(ov::genai::gguf_cache_dir.name());
+        const std::string cache_dir = cache_dir_it != properties.end() ? cache_dir_it->second.as<std::string>() : "";
+        return create_from_gguf(model_dir.string(), enable_save_ov_model, cache_dir);
 #else
         OPENVINO_ASSERT("GGUF support is switched off. Please, recompile with 'cmake -DENABLE_GGUF=ON'");
 #endif
@@ -628,6 +641,15 @@ bool explicitly_requires_paged_attention(const ov::AnyMap& properties) {
             OPENVINO_THROW("Prompt lookup decoding requires PagedAttention operation support, which is available on x86_64 or ARM64 platforms only");
         }
     }
+
+    auto data_parallel_replicas_prop = properties.find(ov::genai::data_parallel_replicas.name());
+    if (data_parallel_replicas_prop != properties.end() && data_parallel_replicas_prop->second.as<size_t>() > 1) {
+        if (is_paged_attention_available()) {
+            return true;
+        } else {
+            OPENVINO_THROW("Data parallel replicas require PagedAttention operation support, which is available on x86_64 or ARM64 platforms only");
+        }
+    }
     return false;
 }
 
@@ -704,6 +726,17 @@ ov::Tensor merge_text_and_image_embeddings_llava(const ov::Tensor& input_ids, ov
     return inputs_embeds;
 }
 
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -102,7 +102,12 @@ void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model)
 
 ov::Core& singleton_core();
 
-std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_properties);
+/**
+ * @brief Removes GGUF specific properties and returns them with the value of enable_save_ov_model.
+ * If models_path is a GGUF file, gguf_cache_dir is also passed to plugins as ov::cache_dir unless it's already set.
+ */
+std::pair<ov::AnyMap, bool> extract_gguf_properties(const ov::AnyMap& external_properties,
+                                                    const std::filesystem::path& models_path = {});
 
 std::pair<ov::AnyMap, bool> extract_paired_input_props(const ov::AnyMap& external_properties);
 
@@ -256,6 +261,9 @@ void save_openvino_model(const std::shared_ptr<ov::Model>& model, const std::str
 
 ov::Tensor merge_text_and_image_embeddings_llava(const ov::Tensor& input_ids, ov::Tensor& text_embeds, const std::vector<ov::Tensor>& image_embeds, int64_t image_token_id);
 
+// FNV-1a, stable between runs and platforms, so hashes can be persisted
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed = 14695981039346656037ULL);
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -104,7 +104,13 @@ from .py_openvino_genai import (
 # RAG
 from .py_openvino_genai import (
     TextEmbeddingPipeline,
-    TextRerankPipeline
+    EmbeddingCacheMetrics,
+    TextRerankPipeline,
+    VectorIndex,
+    Retriever,
+    RetrievedDocument,
+    RetrievalMetrics,
+    RetrievalResults
 )
 
 # Speech generation
@@ -5,7 +5,7 @@ from __future__ import annotations
 import collections.abc
 import openvino._pyopenvino
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EmbeddingCacheMetrics', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LatencyHistogram', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'RetrievalMetrics', 'RetrievalResults', 'RetrievedDocument', 'Retriever', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'TextEmbeddingPipeline', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VectorIndex', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -481,6 +481,24 @@ class DecodedResults:
     @property
     def texts(self) -> list[str]:
         ...
+class EmbeddingCacheMetrics:
+    """
+    Hits, misses and size of the embedding cache
+    """
+    def get_hit_ratio(self) -> float:
+        ...
+    @property
+    def num_entries(self) -> int:
+        ...
+    @property
+    def num_hits(self) -> int:
+        ...
+    @property
+    def num_misses(self) -> int:
+        ...
+    @property
+    def size_bytes(self) -> int:
+        ...
 class EncodedGenerationResult:
     """
     
@@ -745,8 +763,13 @@ class GenerationConfig:
         top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
         do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
         num_return_sequences: the number of sequences to generate from a single prompt.
+
+        Continuous batching scheduling parameters:
+        priority:       scheduling priority of the request. Requests with higher priority are admitted to prefill first and are preempted last.
+        ttft_target_ms: target time to first token in milliseconds, requests with the smallest slack to the target are scheduled first. 0 means no target.
     """
     adapters: openvino_genai.py_openvino_genai.AdapterConfig | None
+    adaptive_num_assistant_tokens: bool
     apply_chat_template: bool
     do_sample: bool
     echo: bool
@@ -875,6 +898,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def repetition_penalty(self) -> float:
         ...
     @repetition_penalty.setter
@@ -916,6 +945,12 @@ class GenerationConfig:
     @top_p.setter
     def top_p(self, arg0: typing.SupportsFloat) -> None:
         ...
+    @property
+    def ttft_target_ms(self) -> int:
+        ...
+    @ttft_target_ms.setter
+    def ttft_target_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
 class GenerationFinishReason:
     """
     Members:
@@ -1594,6 +1629,10 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+
+            Continuous batching scheduling parameters:
+            priority:       scheduling priority of the request. Requests with higher priority are admitted to prefill first and are preempted last.
+            ttft_target_ms: target time to first token in milliseconds, requests with the smallest slack to the target are scheduled first. 0 means no target.
         """
     @typing.overload
     def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
@@ -1691,6 +1730,10 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+
+            Continuous batching scheduling parameters:
+            priority:       scheduling priority of the request. Requests with higher priority are admitted to prefill first and are preempted last.
+            ttft_target_ms: target time to first token in milliseconds, requests with the smallest slack to the target are scheduled first. 0 means no target.
         """
     def get_generation_config(self) -> GenerationConfig:
         ...
@@ -1700,6 +1743,45 @@ class LLMPipeline:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+class LatencyHistogram:
+    """
+    
+        Histogram of request latencies with fixed bucket boundaries in milliseconds.
+    
+        :param bucket_bounds_ms: Upper bounds of histogram buckets in milliseconds.
+        :type bucket_bounds_ms: list[float]
+    
+        :param bucket_counts: Number of values in each bucket, the last bucket counts values greater than the last bound.
+        :type bucket_counts: list[int]
+    
+        :param num_samples: Total number of registered values.
+        :type num_samples: int
+    
+        :param sum_ms: Sum of registered values in milliseconds.
+        :type sum_ms: float
+    
+        :param max_ms: Max registered value in milliseconds.
+        :type max_ms: float
+    """
+    def __init__(self) -> None:
+        ...
+    def get_mean_ms(self) -> float:
+        ...
+    @property
+    def bucket_bounds_ms(self) -> list[float]:
+        ...
+    @property
+    def bucket_counts(self) -> list[int]:
+        ...
+    @property
+    def max_ms(self) -> float:
+        ...
+    @property
+    def num_samples(self) -> int:
+        ...
+    @property
+    def sum_ms(self) -> float:
+        ...
 class MeanStdPair:
     def __init__(self) -> None:
         ...
@@ -1824,6 +1906,15 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param prefill_token_budget: Max number of prompt tokens allowed at the previous step by adaptive prefill chunking, 0 if it is disabled.
+        :type prefill_token_budget: int
+    
+        :param ttft_per_priority: Time to first token histograms during the lifetime of the pipeline, per request priority class.
+        :type ttft_per_priority: dict[int, openvino_genai.LatencyHistogram]
+    
+        :param e2e_latency_per_priority: End-to-end request latency histograms during the lifetime of the pipeline, per request priority class.
+        :type e2e_latency_per_priority: dict[int, openvino_genai.LatencyHistogram]
     """
     def __init__(self) -> None:
         ...
@@ -1834,14 +1925,23 @@ class PipelineMetrics:
     def cache_usage(self) -> float:
         ...
     @property
+    def e2e_latency_per_priority(self) -> dict[int, LatencyHistogram]:
+        ...
+    @property
     def max_cache_usage(self) -> float:
         ...
     @property
+    def prefill_token_budget(self) -> int:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
     def scheduled_requests(self) -> int:
         ...
+    @property
+    def ttft_per_priority(self) -> dict[int, LatencyHistogram]:
+        ...
 class RawImageGenerationPerfMetrics:
     """
     
@@ -1934,6 +2034,93 @@ class RawPerfMetrics:
     @property
     def tokenization_durations(self) -> list[float]:
         ...
+class RetrievalMetrics:
+    """
+    Durations of retrieval stages in microseconds
+    """
+    @property
+    def embedding_duration(self) -> float:
+        ...
+    @property
+    def rerank_duration(self) -> float:
+        ...
+    @property
+    def search_duration(self) -> float:
+        ...
+class RetrievalResults:
+    """
+    Documents found by Retriever and retrieval metrics
+    """
+    @property
+    def documents(self) -> list[RetrievedDocument]:
+        ...
+    @property
+    def metrics(self) -> RetrievalMetrics:
+        ...
+class RetrievedDocument:
+    """
+    Document found by Retriever
+    """
+    @property
+    def id(self) -> int:
+        ...
+    @property
+    def score(self) -> float:
+        ...
+    @property
+    def text(self) -> str:
+        ...
+class Retriever:
+    """
+    Finds documents relevant to a query with embedding, vector index search and optional reranking
+    """
+    class Config:
+        """
+        
+        Structure to keep Retriever configuration parameters.
+        Attributes:
+            top_k (int):
+                Number of documents found in the vector index. All of them are reranked if the retriever has a rerank pipeline.
+        """
+        def __init__(self) -> None:
+            ...
+        @property
+        def top_k(self) -> int:
+            ...
+        @top_k.setter
+        def top_k(self, arg0: typing.SupportsInt) -> None:
+            ...
+    @typing.overload
+    def __init__(self, embedding_pipeline: TextEmbeddingPipeline, index: VectorIndex, config: Retriever.Config, documents: collections.abc.Sequence[str] = []) -> None:
+        """
+        Constructs a retriever without reranking
+        embedding_pipeline (TextEmbeddingPipeline): Pipeline to embed documents and queries
+        index (VectorIndex): Vector index of documents
+        config (Retriever.Config): Retriever configuration
+        documents (list[str]): Texts of documents already in the index, id of a document is its position
+        """
+    @typing.overload
+    def __init__(self, embedding_pipeline: TextEmbeddingPipeline, index: VectorIndex, rerank_pipeline: TextRerankPipeline, config: Retriever.Config, documents: collections.abc.Sequence[str] = []) -> None:
+        """
+        Constructs a retriever which reranks documents found in the index
+        embedding_pipeline (TextEmbeddingPipeline): Pipeline to embed documents and queries
+        index (VectorIndex): Vector index of documents
+        rerank_pipeline (TextRerankPipeline): Pipeline to rerank found documents
+        config (Retriever.Config): Retriever configuration
+        documents (list[str]): Texts of documents already in the index, id of a document is its position
+        """
+    def add_documents(self, texts: collections.abc.Sequence[str]) -> list[int]:
+        """
+        Embeds documents and adds them to the index. Returns ids of added documents.
+        """
+    def remove_documents(self, ids: collections.abc.Sequence[typing.SupportsInt]) -> None:
+        """
+        Removes documents from the index
+        """
+    def retrieve(self, query: str) -> RetrievalResults:
+        """
+        Finds documents relevant to the query
+        """
 class SD3Transformer2DModel:
     """
     SD3Transformer2DModel class.
@@ -2129,6 +2316,10 @@ class SchedulerConfig:
         cache_size:                 total size of KV cache in GB.
         block_size:                 block size for KV cache.
         dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+        target_inter_token_latency_ms: if non-zero and dynamic_split_fuse is on, the number of prompt tokens scheduled per step is tuned
+            online from measured inference durations to keep step latency close to this value in milliseconds.
+        min_prefill_chunk_size:     min number of prompt tokens scheduled per step by adaptive prefill chunking.
+        max_prefill_chunk_size:     max number of prompt tokens scheduled per step by adaptive prefill chunking, 0 means max_num_batched_tokens.
     
         vLLM-like settings:
         max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -2138,6 +2329,11 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        enable_prompt_deduplication: Enable sharing of prompt KV-blocks between requests with identical or overlapping prompts.
+            A request waits until the common prompt prefix is computed by another running request and reuses its KV-blocks.
+        cold_cache_size:            size of host memory tier in GB, where prefix cache KV-blocks overwritten by other sequences are kept quantized
+            to be restored for new prompts with the same prefix. Requires enable_prefix_caching, CPU only, 0 turns the tier off.
+        cold_cache_bits:            number of bits per KV-cache element in cold tier, 8 or 4.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
@@ -2146,6 +2342,7 @@ class SchedulerConfig:
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    enable_prompt_deduplication: bool
     sparse_attention_config: SparseAttentionConfig
     use_cache_eviction: bool
     use_sparse_attention: bool
@@ -2158,6 +2355,18 @@ class SchedulerConfig:
     def cache_size(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def cold_cache_bits(self) -> int:
+        ...
+    @cold_cache_bits.setter
+    def cold_cache_bits(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def cold_cache_size(self) -> int:
+        ...
+    @cold_cache_size.setter
+    def cold_cache_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def max_num_batched_tokens(self) -> int:
         ...
     @max_num_batched_tokens.setter
@@ -2170,11 +2379,29 @@ class SchedulerConfig:
     def max_num_seqs(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def max_prefill_chunk_size(self) -> int:
+        ...
+    @max_prefill_chunk_size.setter
+    def max_prefill_chunk_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def min_prefill_chunk_size(self) -> int:
+        ...
+    @min_prefill_chunk_size.setter
+    def min_prefill_chunk_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def num_kv_blocks(self) -> int:
         ...
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def target_inter_token_latency_ms(self) -> float:
+        ...
+    @target_inter_token_latency_ms.setter
+    def target_inter_token_latency_ms(self, arg0: typing.SupportsFloat) -> None:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -2975,19 +3202,34 @@ class TextEmbeddingPipeline:
                 Useful for database population. If set, the pipeline will fix model shape for inference optimization.
                 Number of documents passed to pipeline should be equal to batch_size.
                 For query embeddings, batch_size should be set to 1 or not set.
+            max_batch_tokens (int, optional):
+                Maximum number of tokens, including padding, in one inference of embed_documents.
+                If set and batch_size is not set, documents are sorted by token length and split into micro-batches
+                within this budget, which are inferred concurrently.
+            max_cache_bytes (int, optional):
+                Budget in bytes of the cache of embeddings. If set, texts found in the cache are not embedded again.
+                The least recently used embeddings are evicted above the budget. Can't be used with batch_size.
+            cache_path (str, optional):
+                Path to the file of the embedding cache. If the file exists, the cache is filled from it at construction
+                of the pipeline. save_cache() writes the file. Requires max_cache_bytes.
             pooling_type (TextEmbeddingPipeline.PoolingType, optional):
                 Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
             normalize (bool, optional):
                 If True, L2 normalization is applied to embeddings. Defaults to True.
+            quantization_type (TextEmbeddingPipeline.QuantizationType, optional):
+                Quantization applied to embeddings inside the model. Defaults to QuantizationType.NONE.
+                INT8 quantization requires normalize to be True. BINARY quantization requires embedding size to be a multiple of 8.
             query_instruction (str, optional):
                 Instruction to use for embedding a query.
             embed_instruction (str, optional):
                 Instruction to use for embedding a document.
         """
+        cache_path: str | None
         embed_instruction: str | None
         normalize: bool
         pad_to_max_length: bool | None
         pooling_type: TextEmbeddingPipeline.PoolingType
+        quantization_type: TextEmbeddingPipeline.QuantizationType
         query_instruction: str | None
         @typing.overload
         def __init__(self) -> None:
@@ -3006,6 +3248,18 @@ class TextEmbeddingPipeline:
         def batch_size(self, arg0: typing.SupportsInt | None) -> None:
             ...
         @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
+        def max_cache_bytes(self) -> int | None:
+            ...
+        @max_cache_bytes.setter
+        def max_cache_bytes(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
@@ -3048,6 +3302,46 @@ class TextEmbeddingPipeline:
         @property
         def value(self) -> int:
             ...
+    class QuantizationType:
+        """
+        Members:
+        
+          NONE : Embeddings are returned as float values
+        
+          INT8 : Normalized embeddings are scaled by 127 and rounded to int8 values
+        
+          BINARY : Signs of embedding values are packed into uint8 values, 8 values per byte
+        """
+        BINARY: typing.ClassVar[TextEmbeddingPipeline.QuantizationType]  # value = <QuantizationType.BINARY: 2>
+        INT8: typing.ClassVar[TextEmbeddingPipeline.QuantizationType]  # value = <QuantizationType.INT8: 1>
+        NONE: typing.ClassVar[TextEmbeddingPipeline.QuantizationType]  # value = <QuantizationType.NONE: 0>
+        __members__: typing.ClassVar[dict[str, TextEmbeddingPipeline.QuantizationType]]  # value = {'NONE': <QuantizationType.NONE: 0>, 'INT8': <QuantizationType.INT8: 1>, 'BINARY': <QuantizationType.BINARY: 2>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
     def __init__(self, models_path: os.PathLike | str | bytes, device: str, config: openvino_genai.py_openvino_genai.TextEmbeddingPipeline.Config | None = None, **kwargs) -> None:
         """
         Constructs a pipeline from xml/bin files, tokenizer and configuration in the same dir
@@ -3060,10 +3354,22 @@ class TextEmbeddingPipeline:
         """
         Computes embeddings for a vector of texts
         """
+    def embed_documents_tensor(self, texts: collections.abc.Sequence[str]) -> openvino._pyopenvino.Tensor:
+        """
+        Computes embeddings for a vector of texts and returns them as a tensor of shape [number of texts, embedding size]
+        """
     def embed_query(self, text: str) -> list[float] | list[int] | list[int]:
         """
         Computes embeddings for a query
         """
+    def get_cache_metrics(self) -> EmbeddingCacheMetrics:
+        """
+        Returns hits and misses of the embedding cache since construction of the pipeline and its size
+        """
+    def save_cache(self) -> None:
+        """
+        Writes the embedding cache to Config.cache_path
+        """
     def start_embed_documents_async(self, texts: collections.abc.Sequence[str]) -> None:
         """
         Asynchronously computes embeddings for a vector of texts
@@ -3093,13 +3399,39 @@ class TextRerankPipeline:
                 Number of documents to return sorted by score.
             max_length (int, optional):
                 Maximum length of tokens passed to the embedding model.
-        """
+            max_batch_tokens (int, optional):
+                Maximum number of tokens, including padding, in one inference of rerank.
+                If set, texts are sorted by token length and split into micro-batches
+                within this budget, which are inferred concurrently.
+            early_stop_score (float, optional):
+                If set, reranking stops once top_n texts have score not less than this value.
+                Texts are split into micro-batches in the given order. Requires max_batch_tokens.
+            instruction (str, optional):
+                Instruction in the prompt of decoder rerankers, e.g. Qwen3-Reranker.
+        """
+        instruction: str | None
         @typing.overload
         def __init__(self) -> None:
             ...
         @typing.overload
         def __init__(self, **kwargs) -> None:
             ...
+        def validate(self) -> None:
+            """
+            Checks that are no conflicting parameters. Raises exception if config is invalid.
+            """
+        @property
+        def early_stop_score(self) -> float | None:
+            ...
+        @early_stop_score.setter
+        def early_stop_score(self, arg0: typing.SupportsFloat | None) -> None:
+            ...
+        @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
         @property
         def max_length(self) -> int | None:
             ...
@@ -3558,6 +3890,134 @@ class VLMRawPerfMetrics:
     @property
     def prepare_embeddings_durations(self) -> list[float]:
         ...
+class VectorIndex:
+    """
+    In-process approximate nearest neighbour index of embeddings based on HNSW graph
+    """
+    class Config:
+        """
+        
+        Structure to keep VectorIndex configuration parameters.
+        Attributes:
+            element_type (openvino.Type):
+                Element type of vectors: f32, i8 for QuantizationType.INT8 or u8 for QuantizationType.BINARY embeddings.
+            metric (VectorIndex.Metric):
+                Distance between vectors. HAMMING is used with u8 element type only, other metrics with f32 and i8.
+            max_neighbours (int):
+                Number of neighbours of a vector in upper graph layers, twice as many in the bottom layer.
+            ef_construction (int):
+                Number of candidates considered while linking an added vector.
+            ef_search (int):
+                Number of candidates considered by search, at least k of search is used.
+        """
+        element_type: openvino._pyopenvino.Type
+        metric: VectorIndex.Metric
+        def __init__(self) -> None:
+            ...
+        def validate(self) -> None:
+            """
+            Checks that are no conflicting parameters. Raises exception if config is invalid.
+            """
+        @property
+        def ef_construction(self) -> int:
+            ...
+        @ef_construction.setter
+        def ef_construction(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
+        def ef_search(self) -> int:
+            ...
+        @ef_search.setter
+        def ef_search(self, arg0: typing.SupportsInt) -> None:
+            ...
+        @property
+        def max_neighbours(self) -> int:
+            ...
+        @max_neighbours.setter
+        def max_neighbours(self, arg0: typing.SupportsInt) -> None:
+            ...
+    class Metric:
+        """
+        Members:
+        
+          INNER_PRODUCT : Dot product of vectors
+        
+          L2 : Squared euclidean distance
+        
+          HAMMING : Number of different bits
+        """
+        HAMMING: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.HAMMING: 2>
+        INNER_PRODUCT: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.INNER_PRODUCT: 0>
+        L2: typing.ClassVar[VectorIndex.Metric]  # value = <Metric.L2: 1>
+        __members__: typing.ClassVar[dict[str, VectorIndex.Metric]]  # value = {'INNER_PRODUCT': <Metric.INNER_PRODUCT: 0>, 'L2': <Metric.L2: 1>, 'HAMMING': <Metric.HAMMING: 2>}
+        def __eq__(self, other: typing.Any) -> bool:
+            ...
+        def __getstate__(self) -> int:
+            ...
+        def __hash__(self) -> int:
+            ...
+        def __index__(self) -> int:
+            ...
+        def __init__(self, value: typing.SupportsInt) -> None:
+            ...
+        def __int__(self) -> int:
+            ...
+        def __ne__(self, other: typing.Any) -> bool:
+            ...
+        def __repr__(self) -> str:
+            ...
+        def __setstate__(self, state: typing.SupportsInt) -> None:
+            ...
+        def __str__(self) -> str:
+            ...
+        @property
+        def name(self) -> str:
+            ...
+        @property
+        def value(self) -> int:
+            ...
+    @typing.overload
+    def __init__(self, dimension: typing.SupportsInt, config: VectorIndex.Config) -> None:
+        """
+        Constructs an empty index
+        dimension (int): Number of elements in a vector, number of bytes for u8 element type
+        config (VectorIndex.Config): Index configuration
+        """
+    @typing.overload
+    def __init__(self, dimension: typing.SupportsInt) -> None:
+        """
+        Constructs an empty index of f32 vectors with default configuration
+        """
+    @typing.overload
+    def __init__(self, path: os.PathLike | str | bytes) -> None:
+        """
+        Loads an index written by save(). Vectors are memory mapped from the file, not read to memory.
+        """
+    def add(self, ids: collections.abc.Sequence[typing.SupportsInt], vectors: openvino._pyopenvino.Tensor) -> None:
+        """
+        Adds vectors of [len(ids), dimension] shape to the index
+        """
+    def get_config(self) -> VectorIndex.Config:
+        ...
+    def get_dimension(self) -> int:
+        ...
+    def remove(self, ids: collections.abc.Sequence[typing.SupportsInt]) -> None:
+        """
+        Removes vectors from search results
+        """
+    def save(self, path: os.PathLike | str | bytes) -> None:
+        """
+        Writes the index to a file
+        """
+    def search(self, query: typing.Any, k: typing.SupportsInt) -> list[tuple[int, float]]:
+        """
+        Finds vectors nearest to the query embedding or tensor.
+        Returns pairs of ids and scores, most similar first. Higher score is more similar for all metrics.
+        """
+    def size(self) -> int:
+        """
+        Number of vectors in the index, except removed ones
+        """
 class WhisperDecodedResultChunk:
     """
     
@@ -30,6 +30,7 @@ using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
+using ov::genai::LatencyHistogram;
 using ov::genai::KVCrushAnchorPointMode;
 using ov::genai::KVCrushConfig;
 
@@ -110,6 +111,10 @@ auto scheduler_config_docstring = R"(
     cache_size:                 total size of KV cache in GB.
     block_size:                 block size for KV cache.
     dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+    target_inter_token_latency_ms: if non-zero and dynamic_split_fuse is on, the number of prompt tokens scheduled per step is tuned
+        online from measured inference durations to keep step latency close to this value in milliseconds.
+    min_prefill_chunk_size:     min number of prompt tokens scheduled per step by adaptive prefill chunking.
+    max_prefill_chunk_size:     max number of prompt tokens scheduled per step by adaptive prefill chunking, 0 means max_num_batched_tokens.
 
     vLLM-like settings:
     max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -119,6 +124,11 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    enable_prompt_deduplication: Enable sharing of prompt KV-blocks between requests with identical or overlapping prompts.
+        A request waits until the common prompt prefix is computed by another running request and reuses its KV-blocks.
+    cold_cache_size:            size of host memory tier in GB, where prefix cache KV-blocks overwritten by other sequences are kept quantized
+        to be restored for new prompts with the same prefix. Requires enable_prefix_caching, CPU only, 0 turns the tier off.
+    cold_cache_bits:            number of bits per KV-cache element in cold tier, 8 or 4.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -164,6 +174,34 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param prefill_token_budget: Max number of prompt tokens allowed at the previous step by adaptive prefill chunking, 0 if it is disabled.
+    :type prefill_token_budget: int
+
+    :param ttft_per_priority: Time to first token histograms during the lifetime of the pipeline, per request priority class.
+    :type ttft_per_priority: dict[int, openvino_genai.LatencyHistogram]
+
+    :param e2e_latency_per_priority: End-to-end request latency histograms during the lifetime of the pipeline, per request priority class.
+    :type e2e_latency_per_priority: dict[int, openvino_genai.LatencyHistogram]
+)";
+
+auto latency_histogram_docstring = R"(
+    Histogram of request latencies with fixed bucket boundaries in milliseconds.
+
+    :param bucket_bounds_ms: Upper bounds of histogram buckets in milliseconds.
+    :type bucket_bounds_ms: list[float]
+
+    :param bucket_counts: Number of values in each bucket, the last bucket counts values greater than the last bound.
+    :type bucket_counts: list[int]
+
+    :param num_samples: Total number of registered values.
+    :type num_samples: int
+
+    :param sum_ms: Sum of registered values in milliseconds.
+    :type sum_ms: float
+
+    :param max_ms: Max registered value in milliseconds.
+    :type max_ms: float
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -364,20 +402,38 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("num_kv_blocks", &SchedulerConfig::num_kv_blocks)
         .def_readwrite("cache_size", &SchedulerConfig::cache_size)
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
+        .def_readwrite("target_inter_token_latency_ms", &SchedulerConfig::target_inter_token_latency_ms)
+        .def_readwrite("min_prefill_chunk_size", &SchedulerConfig::min_prefill_chunk_size)
+        .def_readwrite("max_prefill_chunk_size", &SchedulerConfig::max_prefill_chunk_size)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("enable_prompt_deduplication", &SchedulerConfig::enable_prompt_deduplication)
+        .def_readwrite("cold_cache_size", &SchedulerConfig::cold_cache_size)
+        .def_readwrite("cold_cache_bits", &SchedulerConfig::cold_cache_bits)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
         .def_readwrite("sparse_attention_config", &SchedulerConfig::sparse_attention_config);
 
+    py::class_<LatencyHistogram>(m, "LatencyHistogram", latency_histogram_docstring)
+            .def(py::init<>())
+            .def_readonly("bucket_bounds_ms", &LatencyHistogram::bucket_bounds_ms)
+            .def_readonly("bucket_counts", &LatencyHistogram::bucket_counts)
+            .def_readonly("num_samples", &LatencyHistogram::num_samples)
+            .def_readonly("sum_ms", &LatencyHistogram::sum_ms)
+            .def_readonly("max_ms", &LatencyHistogram::max_ms)
+            .def("get_mean_ms", &LatencyHistogram::get_mean_ms);
+
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("prefill_token_budget", &PipelineMetrics::prefill_token_budget)
+            .def_readonly("ttft_per_priority", &PipelineMetrics::ttft_per_priority)
+            .def_readonly("e2e_latency_per_priority", &PipelineMetrics::e2e_latency_per_priority);
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config, 
@@ -408,7 +464,7 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const std::vector<ov::Tensor>&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("images"), py::arg("generation_config"))
-        .def("step", &ContinuousBatchingPipeline::step)
+        .def("step", &ContinuousBatchingPipeline::step, py::call_guard<py::gil_scoped_release>())
         .def("has_non_finished_requests", &ContinuousBatchingPipeline::has_non_finished_requests)
 
         .def("start_chat", &ContinuousBatchingPipeline::start_chat, py::arg("system_message") = "")
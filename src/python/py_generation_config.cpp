@@ -125,6 +125,10 @@ char generation_config_docstring[] = R"(
     top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
     do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
     num_return_sequences: the number of sequences to generate from a single prompt.
+
+    Continuous batching scheduling parameters:
+    priority:       scheduling priority of the request. Requests with higher priority are admitted to prefill first and are preempted last.
+    ttft_target_ms: target time to first token in milliseconds, requests with the smallest slack to the target are scheduled first. 0 means no target.
 )";
 
 
@@ -270,11 +274,14 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("assistant_confidence_threshold", &GenerationConfig::assistant_confidence_threshold)
         .def_readwrite("num_assistant_tokens", &GenerationConfig::num_assistant_tokens)
         .def_readwrite("max_ngram_size", &GenerationConfig::max_ngram_size)
+        .def_readwrite("adaptive_num_assistant_tokens", &GenerationConfig::adaptive_num_assistant_tokens)
         .def_readwrite("include_stop_str_in_output", &GenerationConfig::include_stop_str_in_output)
         .def_readwrite("stop_token_ids", &GenerationConfig::stop_token_ids)
         .def_readwrite("structured_output_config", &GenerationConfig::structured_output_config)
         .def_readwrite("adapters", &GenerationConfig::adapters)
         .def_readwrite("apply_chat_template", &GenerationConfig::apply_chat_template)
+        .def_readwrite("priority", &GenerationConfig::priority)
+        .def_readwrite("ttft_target_ms", &GenerationConfig::ttft_target_ms)
         .def("set_eos_token_id", &GenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("is_beam_search", &GenerationConfig::is_beam_search)
         .def("is_greedy_decoding", &GenerationConfig::is_greedy_decoding)
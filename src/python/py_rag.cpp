@@ -7,8 +7,10 @@
 #include <pybind11/stl/filesystem.h>
 #include <pybind11/stl_bind.h>
 
+#include "openvino/genai/rag/retriever.hpp"
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/rag/text_rerank_pipeline.hpp"
+#include "openvino/genai/rag/vector_index.hpp"
 #include "py_utils.hpp"
 #include "tokenizer/tokenizers_path.hpp"
 
@@ -17,6 +19,8 @@ using ov::genai::EmbeddingResult;
 using ov::genai::EmbeddingResults;
 using ov::genai::TextEmbeddingPipeline;
 using ov::genai::TextRerankPipeline;
+using ov::genai::VectorIndex;
+using ov::genai::Retriever;
 
 namespace pyutils = ov::genai::pybind::utils;
 
@@ -34,10 +38,23 @@ Attributes:
         Useful for database population. If set, the pipeline will fix model shape for inference optimization.
         Number of documents passed to pipeline should be equal to batch_size.
         For query embeddings, batch_size should be set to 1 or not set.
+    max_batch_tokens (int, optional):
+        Maximum number of tokens, including padding, in one inference of embed_documents.
+        If set and batch_size is not set, documents are sorted by token length and split into micro-batches
+        within this budget, which are inferred concurrently.
+    max_cache_bytes (int, optional):
+        Budget in bytes of the cache of embeddings. If set, texts found in the cache are not embedded again.
+        The least recently used embeddings are evicted above the budget. Can't be used with batch_size.
+    cache_path (str, optional):
+        Path to the file of the embedding cache. If the file exists, the cache is filled from it at construction
+        of the pipeline. save_cache() writes the file. Requires max_cache_bytes.
     pooling_type (TextEmbeddingPipeline.PoolingType, optional):
         Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
     normalize (bool, optional):
         If True, L2 normalization is applied to embeddings. Defaults to True.
+    quantization_type (TextEmbeddingPipeline.QuantizationType, optional):
+        Quantization applied to embeddings inside the model. Defaults to QuantizationType.NONE.
+        INT8 quantization requires normalize to be True. BINARY quantization requires embedding size to be a multiple of 8.
     query_instruction (str, optional):
         Instruction to use for embedding a query.
     embed_instruction (str, optional):
@@ -51,11 +68,59 @@ Attributes:
         Number of documents to return sorted by score.
     max_length (int, optional):
         Maximum length of tokens passed to the embedding model.
+    max_batch_tokens (int, optional):
+        Maximum number of tokens, including padding, in one inference of rerank.
+        If set, texts are sorted by token length and split into micro-batches
+        within this budget, which are inferred concurrently.
+    early_stop_score (float, optional):
+        If set, reranking stops once top_n texts have score not less than this value.
+        Texts are split into micro-batches in the given order. Requires max_batch_tokens.
+    instruction (str, optional):
+        Instruction in the prompt of decoder rerankers, e.g. Qwen3-Reranker.
 )";
 
+const auto vector_index_config_docstring = R"(
+Structure to keep VectorIndex configuration parameters.
+Attributes:
+    element_type (openvino.Type):
+        Element type of vectors: f32, i8 for QuantizationType.INT8 or u8 for QuantizationType.BINARY embeddings.
+    metric (VectorIndex.Metric):
+        Distance between vectors. HAMMING is used with u8 element type only, other metrics with f32 and i8.
+    max_neighbours (int):
+        Number of neighbours of a vector in upper graph layers, twice as many in the bottom layer.
+    ef_construction (int):
+        Number of candidates considered while linking an added vector.
+    ef_search (int):
+        Number of candidates considered by search, at least k of search is used.
+)";
+
+const auto retriever_config_docstring = R"(
+Structure to keep Retriever configuration parameters.
+Attributes:
+    top_k (int):
+        Number of documents found in the vector index. All of them are reranked if the retriever has a rerank pipeline.
+)";
+
+ov::genai::EmbeddingResult to_embedding_result(const py::object& query, const ov::element::Type& element_type) {
+    // python lists of ints are ambiguous for int8 and uint8, so the type is taken from the index
+    if (element_type == ov::element::i8) {
+        return query.cast<std::vector<int8_t>>();
+    } else if (element_type == ov::element::u8) {
+        return query.cast<std::vector<uint8_t>>();
+    }
+    return query.cast<std::vector<float>>();
+}
+
 }  // namespace
 
 void init_rag_pipelines(py::module_& m) {
+    py::class_<ov::genai::EmbeddingCacheMetrics>(m, "EmbeddingCacheMetrics", "Hits, misses and size of the embedding cache")
+        .def_readonly("num_hits", &ov::genai::EmbeddingCacheMetrics::num_hits)
+        .def_readonly("num_misses", &ov::genai::EmbeddingCacheMetrics::num_misses)
+        .def_readonly("num_entries", &ov::genai::EmbeddingCacheMetrics::num_entries)
+        .def_readonly("size_bytes", &ov::genai::EmbeddingCacheMetrics::size_bytes)
+        .def("get_hit_ratio", &ov::genai::EmbeddingCacheMetrics::get_hit_ratio);
+
     auto text_embedding_pipeline =
         py::class_<TextEmbeddingPipeline>(m, "TextEmbeddingPipeline", "Text embedding pipeline")
             .def(
@@ -92,6 +157,19 @@ void init_rag_pipelines(py::module_& m) {
                     return py::cast(res);
                 },
                 "Waits computed embeddings of a vector of texts")
+            .def(
+                "embed_documents_tensor",
+                [](TextEmbeddingPipeline& pipe, std::vector<std::string>& texts) -> py::typing::Union<ov::Tensor> {
+                    ov::Tensor res;
+                    {
+                        py::gil_scoped_release rel;
+                        res = pipe.embed_documents_tensor(texts);
+                    }
+                    return py::cast(res);
+                },
+                py::arg("texts"),
+                "List of texts ",
+                "Computes embeddings for a vector of texts and returns them as a tensor of shape [number of texts, embedding size]")
             .def(
                 "embed_query",
                 [](TextEmbeddingPipeline& pipe, std::string& text) -> py::typing::Union<EmbeddingResult> {
@@ -124,12 +202,24 @@ void init_rag_pipelines(py::module_& m) {
                     }
                     return py::cast(res);
                 },
-                "Waits computed embeddings for a query");
+                "Waits computed embeddings for a query")
+            .def("save_cache",
+                 &TextEmbeddingPipeline::save_cache,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Writes the embedding cache to Config.cache_path")
+            .def("get_cache_metrics",
+                 &TextEmbeddingPipeline::get_cache_metrics,
+                 "Returns hits and misses of the embedding cache since construction of the pipeline and its size");
 
     py::enum_<TextEmbeddingPipeline::PoolingType>(text_embedding_pipeline, "PoolingType")
         .value("CLS", TextEmbeddingPipeline::PoolingType::CLS, "First token embeddings")
         .value("MEAN", TextEmbeddingPipeline::PoolingType::MEAN, "The average of all token embeddings");
 
+    py::enum_<TextEmbeddingPipeline::QuantizationType>(text_embedding_pipeline, "QuantizationType")
+        .value("NONE", TextEmbeddingPipeline::QuantizationType::NONE, "Embeddings are returned as float values")
+        .value("INT8", TextEmbeddingPipeline::QuantizationType::INT8, "Normalized embeddings are scaled by 127 and rounded to int8 values")
+        .value("BINARY", TextEmbeddingPipeline::QuantizationType::BINARY, "Signs of embedding values are packed into uint8 values, 8 values per byte");
+
     py::class_<TextEmbeddingPipeline::Config>(text_embedding_pipeline, "Config", text_embedding_config_docstring)
         .def(py::init<>())
         .def(py::init([](py::kwargs kwargs) {
@@ -141,8 +231,12 @@ void init_rag_pipelines(py::module_& m) {
         .def_readwrite("max_length", &TextEmbeddingPipeline::Config::max_length)
         .def_readwrite("pad_to_max_length", &TextEmbeddingPipeline::Config::pad_to_max_length)
         .def_readwrite("batch_size", &TextEmbeddingPipeline::Config::batch_size)
+        .def_readwrite("max_batch_tokens", &TextEmbeddingPipeline::Config::max_batch_tokens)
+        .def_readwrite("max_cache_bytes", &TextEmbeddingPipeline::Config::max_cache_bytes)
+        .def_readwrite("cache_path", &TextEmbeddingPipeline::Config::cache_path)
         .def_readwrite("pooling_type", &TextEmbeddingPipeline::Config::pooling_type)
         .def_readwrite("normalize", &TextEmbeddingPipeline::Config::normalize)
+        .def_readwrite("quantization_type", &TextEmbeddingPipeline::Config::quantization_type)
         .def_readwrite("query_instruction", &TextEmbeddingPipeline::Config::query_instruction)
         .def_readwrite("embed_instruction", &TextEmbeddingPipeline::Config::embed_instruction);
 
@@ -221,8 +315,14 @@ kwargs: Plugin and/or config properties
         .def(py::init([](py::kwargs kwargs) {
             return ov::genai::TextRerankPipeline::Config(pyutils::kwargs_to_any_map(kwargs));
         }))
+        .def("validate",
+             &ov::genai::TextRerankPipeline::Config::validate,
+             "Checks that are no conflicting parameters. Raises exception if config is invalid.")
         .def_readwrite("top_n", &ov::genai::TextRerankPipeline::Config::top_n)
-        .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length);
+        .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length)
+        .def_readwrite("max_batch_tokens", &ov::genai::TextRerankPipeline::Config::max_batch_tokens)
+        .def_readwrite("early_stop_score", &ov::genai::TextRerankPipeline::Config::early_stop_score)
+        .def_readwrite("instruction", &ov::genai::TextRerankPipeline::Config::instruction);
 
     text_rerank_pipeline.def(
         py::init([](const std::filesystem::path& models_path,
@@ -254,4 +354,136 @@ device (str): Device to run the model on (e.g., CPU, GPU).
 config: (TextRerankPipeline.Config): Optional pipeline configuration
 kwargs: Plugin and/or config properties
 )");
+
+    auto vector_index =
+        py::class_<VectorIndex>(m, "VectorIndex", "In-process approximate nearest neighbour index of embeddings based on HNSW graph")
+            .def(py::init<size_t, const VectorIndex::Config&>(), py::arg("dimension"), py::arg("config"), R"(
+Constructs an empty index
+dimension (int): Number of elements in a vector, number of bytes for u8 element type
+config (VectorIndex.Config): Index configuration
+)")
+            .def(py::init<size_t>(), py::arg("dimension"), "Constructs an empty index of f32 vectors with default configuration")
+            .def(py::init<const std::filesystem::path&>(),
+                 py::arg("path"),
+                 "Loads an index written by save(). Vectors are memory mapped from the file, not read to memory.")
+            .def("add",
+                 &VectorIndex::add,
+                 py::call_guard<py::gil_scoped_release>(),
+                 py::arg("ids"),
+                 py::arg("vectors"),
+                 "Adds vectors of [len(ids), dimension] shape to the index")
+            .def("remove",
+                 &VectorIndex::remove,
+                 py::call_guard<py::gil_scoped_release>(),
+                 py::arg("ids"),
+                 "Removes vectors from search results")
+            .def(
+                "search",
+                [](const VectorIndex& index, const py::object& query, size_t k) {
+                    if (py::isinstance<ov::Tensor>(query)) {
+                        const auto tensor = query.cast<ov::Tensor>();
+                        py::gil_scoped_release rel;
+                        return index.search(tensor, k);
+                    }
+                    const auto embedding = to_embedding_result(query, index.get_config().element_type);
+                    py::gil_scoped_release rel;
+                    return index.search(embedding, k);
+                },
+                py::arg("query"),
+                py::arg("k"),
+                R"(
+Finds vectors nearest to the query embedding or tensor.
+Returns pairs of ids and scores, most similar first. Higher score is more similar for all metrics.
+)")
+            .def("save", &VectorIndex::save, py::arg("path"), "Writes the index to a file")
+            .def("size", &VectorIndex::size, "Number of vectors in the index, except removed ones")
+            .def("get_dimension", &VectorIndex::get_dimension)
+            .def("get_config", &VectorIndex::get_config);
+
+    py::enum_<VectorIndex::Metric>(vector_index, "Metric")
+        .value("INNER_PRODUCT", VectorIndex::Metric::INNER_PRODUCT, "Dot product of vectors")
+        .value("L2", VectorIndex::Metric::L2, "Squared euclidean distance")
+        .value("HAMMING", VectorIndex::Metric::HAMMING, "Number of different bits");
+
+    py::class_<VectorIndex::Config>(vector_index, "Config", vector_index_config_docstring)
+        .def(py::init<>())
+        .def("validate",
+             &VectorIndex::Config::validate,
+             "Checks that are no conflicting parameters. Raises exception if config is invalid.")
+        .def_readwrite("element_type", &VectorIndex::Config::element_type)
+        .def_readwrite("metric", &VectorIndex::Config::metric)
+        .def_readwrite("max_neighbours", &VectorIndex::Config::max_neighbours)
+        .def_readwrite("ef_construction", &VectorIndex::Config::ef_construction)
+        .def_readwrite("ef_search", &VectorIndex::Config::ef_search);
+
+    py::class_<ov::genai::RetrievedDocument>(m, "RetrievedDocument", "Document found by Retriever")
+        .def_readonly("id", &ov::genai::RetrievedDocument::id)
+        .def_readonly("text", &ov::genai::RetrievedDocument::text)
+        .def_readonly("score", &ov::genai::RetrievedDocument::score);
+
+    py::class_<ov::genai::RetrievalMetrics>(m, "RetrievalMetrics", "Durations of retrieval stages in microseconds")
+        .def_readonly("embedding_duration", &ov::genai::RetrievalMetrics::embedding_duration)
+        .def_readonly("search_duration", &ov::genai::RetrievalMetrics::search_duration)
+        .def_readonly("rerank_duration", &ov::genai::RetrievalMetrics::rerank_duration);
+
+    py::class_<ov::genai::RetrievalResults>(m, "RetrievalResults", "Documents found by Retriever and retrieval metrics")
+        .def_readonly("documents", &ov::genai::RetrievalResults::documents)
+        .def_readonly("metrics", &ov::genai::RetrievalResults::metrics);
+
+    auto retriever =
+        py::class_<Retriever>(m, "Retriever", "Finds documents relevant to a query with embedding, vector index search and optional reranking")
+            .def(py::init<TextEmbeddingPipeline&, VectorIndex&, const Retriever::Config&, const std::vector<std::string>&>(),
+                 py::arg("embedding_pipeline"),
+                 py::arg("index"),
+                 py::arg("config"),
+                 py::arg("documents") = std::vector<std::string>{},
+                 py::keep_alive<1, 2>(),
+                 py::keep_alive<1, 3>(),
+                 R"(
+Constructs a retriever without reranking
+embedding_pipeline (TextEmbeddingPipeline): Pipeline to embed documents and queries
+index (VectorIndex): Vector index of documents
+config (Retriever.Config): Retriever configuration
+documents (list[str]): Texts of documents already in the index, id of a document is its position
+)")
+            .def(py::init<TextEmbeddingPipeline&,
+                          VectorIndex&,
+                          TextRerankPipeline&,
+                          const Retriever::Config&,
+                          const std::vector<std::string>&>(),
+                 py::arg("embedding_pipeline"),
+                 py::arg("index"),
+                 py::arg("rerank_pipeline"),
+                 py::arg("config"),
+                 py::arg("documents") = std::vector<std::string>{},
+                 py::keep_alive<1, 2>(),
+                 py::keep_alive<1, 3>(),
+                 py::keep_alive<1, 4>(),
+                 R"(
+Constructs a retriever which reranks documents found in the index
+embedding_pipeline (TextEmbeddingPipeline): Pipeline to embed documents and queries
+index (VectorIndex): Vector index of documents
+rerank_pipeline (TextRerankPipeline): Pipeline to rerank found documents
+config (Retriever.Config): Retriever configuration
+documents (list[str]): Texts of documents already in the index, id of a document is its position
+)")
+            .def("add_documents",
+                 &Retriever::add_documents,
+                 py::call_guard<py::gil_scoped_release>(),
+                 py::arg("texts"),
+                 "Embeds documents and adds them to the index. Returns ids of added documents.")
+            .def("remove_documents",
+                 &Retriever::remove_documents,
+                 py::call_guard<py::gil_scoped_release>(),
+                 py::arg("ids"),
+                 "Removes documents from the index")
+            .def("retrieve",
+                 &Retriever::retrieve,
+                 py::call_guard<py::gil_scoped_release>(),
+                 py::arg("query"),
+                 "Finds documents relevant to the query");
+
+    py::class_<Retriever::Config>(retriever, "Config", retriever_config_docstring)
+        .def(py::init<>())
+        .def_readwrite("top_k", &Retriever::Config::top_k);
 }
@@ -183,6 +183,30 @@ TEST_F(PrefixCachingBlockAllocatorTest, AllocatesFromOverwriteableBlocksWhenFree
     }
 }
 
+TEST_F(PrefixCachingBlockAllocatorTest, TracksOverwrittenBlocksWhenEnabled) {
+    allocator.enable_overwritten_blocks_tracking();
+    allocator.allocate_block(0, cached_blocks_map);
+    size_t block_id = cached_blocks_map[0][0]->get_index();
+    allocator.free(cached_blocks_map[0]);
+
+    std::vector<ov::genai::BlocksPerLayer> block_to_release;
+    for (size_t i = 0; i < initial_num_free_blocks - 1; i++) {
+        block_to_release.push_back(allocator.allocate_block(1337 + i, cached_blocks_map));
+    }
+    EXPECT_TRUE(allocator.pull_overwritten_blocks().empty());
+
+    block_to_release.push_back(allocator.allocate_block(31337, cached_blocks_map));
+    auto overwritten_blocks = allocator.pull_overwritten_blocks();
+    ASSERT_EQ(overwritten_blocks.size(), 1);
+    EXPECT_EQ(overwritten_blocks[0].first, 0);
+    EXPECT_EQ(overwritten_blocks[0].second, block_id);
+    EXPECT_TRUE(allocator.pull_overwritten_blocks().empty());
+
+    for (auto& block : block_to_release) {
+        allocator.free(block);
+    }
+}
+
 TEST_F(PrefixCachingBlockAllocatorTest, ThrowsAtAllocationWhenFull) {
     std::vector<ov::genai::BlocksPerLayer> blocks_to_release;
     for (size_t i = 0; i < initial_num_free_blocks; i++) {
@@ -41,6 +41,47 @@ TEST(TestBlockManager, general_test) {
     bm.free_sequence(1);
 }
 
+TEST(TestBlockManager, fork_leading_blocks_to_another_sequence) {
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, 4, 2);
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7,8,9};
+
+    auto create_sequence_group = [&tokens] (uint64_t request_id) {
+        return std::make_shared<ov::genai::SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                          ov::genai::greedy(), 4);
+    };
+    auto leader = create_sequence_group(0);
+    auto follower = create_sequence_group(1);
+    auto leader_seq_id = leader->get_running_sequences()[0]->get_id();
+    auto follower_seq_id = follower->get_running_sequences()[0]->get_id();
+
+    bm.allocate(leader->get_running_sequences()[0], 3);
+    EXPECT_EQ(bm.num_free_blocks(), 5);
+
+    // only full blocks of the common prompt prefix are shared
+    bm.fork_sequence(leader_seq_id, follower_seq_id, 2);
+    EXPECT_EQ(bm.num_free_blocks(), 5);
+    for (size_t layer_idx = 0; layer_idx < 2; layer_idx++) {
+        const auto& leader_blocks = bm.get_block_table(leader_seq_id, layer_idx);
+        const auto& follower_blocks = bm.get_block_table(follower_seq_id, layer_idx);
+        ASSERT_EQ(follower_blocks.size(), 2);
+        EXPECT_EQ(follower_blocks[0], leader_blocks[0]);
+        EXPECT_EQ(follower_blocks[1], leader_blocks[1]);
+        EXPECT_EQ(leader_blocks[1]->get_references_count(), 2);
+        EXPECT_EQ(leader_blocks[2]->get_references_count(), 1);
+    }
+
+    // the rest of the prompt is computed in own blocks
+    bm.allocate(follower->get_running_sequences()[0], 1);
+    EXPECT_EQ(bm.get_block_table(follower_seq_id, 0).size(), 3);
+    EXPECT_NE(bm.get_block_table(follower_seq_id, 0).back(), bm.get_block_table(leader_seq_id, 0).back());
+    EXPECT_EQ(bm.num_free_blocks(), 4);
+
+    bm.free_sequence(leader_seq_id);
+    EXPECT_EQ(bm.num_free_blocks(), 5);
+    bm.free_sequence(follower_seq_id);
+    EXPECT_EQ(bm.num_free_blocks(), 8);
+}
+
 TEST(TestBlockManager, required_blocks_count) {
     ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, 4, 3);
 
@@ -47,10 +47,10 @@ TEST(EvictionScoreManager, CanRegisterNewScores) {
 
 struct EvictionScoreManagerAddWithSkipsTestStruct {
     size_t block_size;
-    std::vector<double> src;
+    std::vector<float> src;
     std::set<size_t> skipped_logical_block_ids;
-    std::vector<double> dst_before;
-    std::vector<double> ref_dst_after;
+    std::vector<float> dst_before;
+    std::vector<float> ref_dst_after;
 };
 
 using EvictionScoreManagerAddWithSkipsParameterizedTest = ::testing::TestWithParam<EvictionScoreManagerAddWithSkipsTestStruct>;
@@ -369,7 +369,7 @@ TEST_P(EvictionScoreManagerRegisterScoresParameterizedTest, ScoresAndCountersAft
     ASSERT_EQ(test_scores.size(), DEFAULT_NUM_DECODER_LAYERS);
     ASSERT_EQ(test_counters.size(), DEFAULT_NUM_DECODER_LAYERS);
 
-    float abs_tol = 1e-6;
+    float abs_tol = 1e-5;  // scores are accumulated in float
     for (size_t layer_idx = 0; layer_idx < DEFAULT_NUM_DECODER_LAYERS; layer_idx++) {
         EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::DoubleNear(abs_tol), test_struct.ref_scores[layer_idx]));
         EXPECT_EQ(mgr.get_counters(), test_struct.ref_counters);
@@ -554,7 +554,7 @@ TEST_P(EvictionScoreManagerRemoveScoresParameterizedTest, ScoresAndCountersAfter
     ASSERT_EQ(test_scores.size(), DEFAULT_NUM_DECODER_LAYERS);
     ASSERT_EQ(test_counters.size(), DEFAULT_NUM_DECODER_LAYERS);
 
-    float abs_tol = 1e-6;
+    float abs_tol = 1e-5;  // scores are accumulated in float
     for (size_t layer_idx = 0; layer_idx < DEFAULT_NUM_DECODER_LAYERS; layer_idx++) {
         EXPECT_THAT(test_scores[layer_idx], ::testing::Pointwise(::testing::DoubleNear(abs_tol), test_struct.ref_scores[layer_idx]));
         EXPECT_EQ(mgr.get_counters(), test_struct.ref_counters);
@@ -3,9 +3,14 @@
 //
 
 #include <gtest/gtest.h>
+
+#include <cstring>
+#include <new>
+
 #include "openvino/runtime/core.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "continuous_batching/cache_manager.hpp"
+#include "continuous_batching/host_memory.hpp"
 #include "helper.hpp"
 
 using namespace ov::genai;
@@ -106,3 +111,165 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+TEST(TestCacheManager, test_cache_increase_with_host_allocator) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    // NUMA node 0 exists on any Linux system, binding is best effort elsewhere
+    auto cache_manager = std::make_shared<CacheManager>(request, ov::Allocator(HostMemoryAllocator(0, true)));
+    size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+
+    cache_manager->allocate_cache_if_needed(100);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+
+    cache_manager->allocate_cache_if_needed(200);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
+}
+
+TEST(TestCacheManager, test_reserved_cache_increase_in_place) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+
+    cache_manager->reserve_cache(1000);
+    if (cache_manager->get_num_reserved_kv_blocks() == 0) {
+        GTEST_SKIP() << "KV cache memory reservation is not supported on the platform";
+    }
+
+    cache_manager->allocate_cache_if_needed(100);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+    ov::Tensor key_cache = cache_manager->get_key_cache(0);
+    std::memset(key_cache.data(), 42, key_cache.get_byte_size());
+
+    // existing blocks are neither moved nor copied
+    cache_manager->allocate_cache_if_needed(200);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
+    ov::Tensor grown_key_cache = cache_manager->get_key_cache(0);
+    ASSERT_EQ(grown_key_cache.data(), key_cache.data());
+    ASSERT_EQ(static_cast<uint8_t*>(grown_key_cache.data())[key_cache.get_byte_size() - 1], 42);
+
+    cache_manager->release_reserved_cache_pages();
+    ASSERT_EQ(static_cast<uint8_t*>(grown_key_cache.data())[0], 0);
+}
+
+TEST(TestCacheManager, test_reserved_cache_increase_beyond_reservation) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+
+    cache_manager->reserve_cache(100);
+    if (cache_manager->get_num_reserved_kv_blocks() == 0) {
+        GTEST_SKIP() << "KV cache memory reservation is not supported on the platform";
+    }
+
+    cache_manager->allocate_cache_if_needed(100);
+    ov::Tensor key_cache = cache_manager->get_key_cache(0);
+    std::memset(key_cache.data(), 42, key_cache.get_byte_size());
+
+    // the cache is copied to new tensors as without reservation
+    cache_manager->allocate_cache_if_needed(200);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
+    ASSERT_EQ(cache_manager->get_num_reserved_kv_blocks(), 0);
+    ov::Tensor grown_key_cache = cache_manager->get_key_cache(0);
+    ASSERT_NE(grown_key_cache.data(), key_cache.data());
+    ASSERT_EQ(static_cast<uint8_t*>(grown_key_cache.data())[0], 42);
+    ASSERT_EQ(static_cast<uint8_t*>(grown_key_cache.data())[key_cache.get_byte_size() - 1], 42);
+}
+
+namespace {
+
+// fails allocations larger than the limit, like an address space reservation rejected by the OS
+struct LimitedAllocator {
+    size_t max_bytes;
+
+    void* allocate(size_t bytes, size_t alignment) {
+        if (bytes > max_bytes) {
+            throw std::bad_alloc();
+        }
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    void deallocate(void* ptr, size_t, size_t alignment) {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    bool is_equal(const LimitedAllocator& other) const {
+        return max_bytes == other.max_bytes;
+    }
+};
+
+}  // namespace
+
+TEST(TestCacheManager, test_failed_reservation_falls_back_to_copy_on_growth) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    size_t block_size_in_bytes = CacheManager(request).get_block_size_in_bytes();
+    // a block of a single layer takes block_size_in_bytes / (2 * num_decoder_layers), so tensors of 100 blocks fit the limit
+    // and tensors of 1000 blocks do not
+    auto cache_manager = std::make_shared<CacheManager>(request, ov::Allocator(LimitedAllocator{10 * block_size_in_bytes}));
+
+    cache_manager->reserve_cache(1000);
+    ASSERT_EQ(cache_manager->get_num_reserved_kv_blocks(), 0);
+
+    cache_manager->allocate_cache_if_needed(50);
+    ov::Tensor key_cache = cache_manager->get_key_cache(0);
+    std::memset(key_cache.data(), 42, key_cache.get_byte_size());
+    cache_manager->allocate_cache_if_needed(100);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 100 * block_size_in_bytes);
+    ASSERT_EQ(static_cast<uint8_t*>(cache_manager->get_key_cache(0).data())[key_cache.get_byte_size() - 1], 42);
+}
+
+TEST(TestHostPlacementConfig, test_kv_cache_memory_shares) {
+    ov::AnyMap properties{{"kv_cache_memory_shares", size_t(4)}, {"other", 1}};
+    EXPECT_EQ(extract_host_placement_config(properties).kv_cache_memory_shares, 4);
+    EXPECT_EQ(properties.size(), 1);
+    EXPECT_EQ(extract_host_placement_config(properties).kv_cache_memory_shares, 1);
+}
+
+TEST(TestHostPlacementConfig, test_parse_cpu_list) {
+    EXPECT_EQ(parse_cpu_list("0-3,8,10-11"), std::vector<size_t>({0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parse_cpu_list("5"), std::vector<size_t>({5}));
+    EXPECT_TRUE(parse_cpu_list("").empty());
+    EXPECT_THROW(parse_cpu_list("3-1"), ov::Exception);
+    EXPECT_THROW(parse_cpu_list("a-b"), ov::Exception);
+}
+
+TEST(TestHostPlacementConfig, test_extract_from_properties) {
+    ov::AnyMap properties = {{"kv_cache_numa_node", 1}, {"sampler_cpu_ids", std::string("4-5")}, {"NUM_STREAMS", 2}};
+    HostPlacementConfig config = extract_host_placement_config(properties);
+    EXPECT_EQ(config.kv_cache_numa_node, 1);
+    EXPECT_FALSE(config.kv_cache_huge_pages);
+    EXPECT_EQ(config.sampler_cpu_ids, std::vector<size_t>({4, 5}));
+    EXPECT_EQ(properties.size(), 1u);
+}
+
+TEST(TestHostPlacementConfig, test_select_replica_host_placement) {
+    ov::AnyMap properties = {{"kv_cache_numa_node", std::string("0;1")}, {"sampler_cpu_ids", std::string("0-1;4-5")}, {"NUM_STREAMS", 2}};
+    for (size_t replica_idx = 0; replica_idx < 3; ++replica_idx) {
+        ov::AnyMap replica_properties = select_replica_host_placement(properties, replica_idx);
+        HostPlacementConfig config = extract_host_placement_config(replica_properties);
+        // replicas take values in round robin order
+        EXPECT_EQ(config.kv_cache_numa_node, static_cast<int>(replica_idx % 2));
+        EXPECT_EQ(config.sampler_cpu_ids, replica_idx % 2 == 0 ? std::vector<size_t>({0, 1}) : std::vector<size_t>({4, 5}));
+        EXPECT_EQ(replica_properties.size(), 1u);
+    }
+
+    // a single value is applied to all replicas
+    ov::AnyMap shared_properties = {{"kv_cache_numa_node", 1}, {"sampler_cpu_ids", std::string("4-5")}};
+    ov::AnyMap replica_properties = select_replica_host_placement(shared_properties, 1);
+    HostPlacementConfig config = extract_host_placement_config(replica_properties);
+    EXPECT_EQ(config.kv_cache_numa_node, 1);
+    EXPECT_EQ(config.sampler_cpu_ids, std::vector<size_t>({4, 5}));
+
+    EXPECT_THROW(select_replica_host_placement({{"kv_cache_numa_node", std::string("0;x")}}, 1), ov::Exception);
+}
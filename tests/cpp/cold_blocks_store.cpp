@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "continuous_batching/cold_blocks_store.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor get_cache(size_t num_blocks) {
+    // [num_blocks, num_heads, block_size, head_size]
+    ov::Tensor cache(ov::element::f32, {num_blocks, 2, 4, 8});
+    float* data = cache.data<float>();
+    for (size_t i = 0; i < cache.get_size(); ++i) {
+        data[i] = std::sin(static_cast<float>(i)) * (1.0f + i % 8);
+    }
+    return cache;
+}
+
+void check_round_trip(size_t bits, float max_error) {
+    ov::Tensor cache = get_cache(3);
+    ColdBlocksStore::QuantizedData quantized;
+    ColdBlocksStore::quantize_block(cache, 1, bits, quantized);
+    EXPECT_EQ(quantized.scales.size(), 2 * 4);
+    EXPECT_EQ(quantized.data.size(), 2 * 4 * 8 * bits / 8);
+
+    ov::Tensor restored = get_cache(3);
+    std::memset(restored.data<float>() + 64, 0, 64 * sizeof(float));
+    ColdBlocksStore::dequantize_block(quantized, bits, restored, 1);
+    for (size_t i = 0; i < cache.get_size(); ++i) {
+        EXPECT_NEAR(restored.data<float>()[i], cache.data<float>()[i], max_error) << "at " << i;
+    }
+}
+
+}  // namespace
+
+TEST(TestColdBlocksStore, quantizes_block_to_8_bits) {
+    // max row range is 16, so the step of levels is 16 / 255
+    check_round_trip(8, 16.0f / 255);
+}
+
+TEST(TestColdBlocksStore, quantizes_block_to_4_bits) {
+    check_round_trip(4, 16.0f / 15);
+}
+
+TEST(TestColdBlocksStore, keeps_quantized_cache_precision_as_is) {
+    ov::Tensor cache(ov::element::u8, {2, 1, 4, 4});
+    for (size_t i = 0; i < cache.get_size(); ++i) {
+        cache.data<uint8_t>()[i] = static_cast<uint8_t>(i * 7);
+    }
+    ColdBlocksStore::QuantizedData quantized;
+    ColdBlocksStore::quantize_block(cache, 1, 4, quantized);
+    EXPECT_TRUE(quantized.scales.empty());
+
+    ov::Tensor restored(ov::element::u8, {2, 1, 4, 4});
+    std::memset(restored.data(), 0, restored.get_byte_size());
+    ColdBlocksStore::dequantize_block(quantized, 4, restored, 1);
+    for (size_t i = 16; i < 32; ++i) {
+        EXPECT_EQ(restored.data<uint8_t>()[i], cache.data<uint8_t>()[i]);
+    }
+}
+
+TEST(TestColdBlocksStore, drops_oldest_blocks_when_full) {
+    ColdBlocksStore store(2, 8);
+    store.add(1);
+    store.add(2);
+    store.add(3);
+    EXPECT_EQ(store.num_blocks(), 2);
+    EXPECT_FALSE(store.contains(1));
+    EXPECT_TRUE(store.contains(2));
+
+    EXPECT_NE(store.take(3), nullptr);
+    EXPECT_FALSE(store.contains(3));
+    EXPECT_EQ(store.take(3), nullptr);
+    EXPECT_EQ(store.num_blocks(), 1);
+}
+
+TEST(TestColdBlocksStore, computes_block_size_in_bytes) {
+    ov::PartialShape shape{-1, 2, 4, 8};
+    EXPECT_EQ(ColdBlocksStore::get_quantized_size_in_bytes(ov::element::f16, shape, 8), 64 + 8 * 2 * sizeof(float));
+    EXPECT_EQ(ColdBlocksStore::get_quantized_size_in_bytes(ov::element::f16, shape, 4), 32 + 8 * 2 * sizeof(float));
+    EXPECT_EQ(ColdBlocksStore::get_quantized_size_in_bytes(ov::element::u8, shape, 4), 64);
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+
+#include "sampling/structured_output/compiled_grammar_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// compiled grammar is emulated by its key, compilation is controlled by the test through promises
+struct CompilationTasks {
+    std::map<std::string, std::promise<std::string>> promises;
+    size_t num_compilations = 0;
+
+    std::function<std::shared_future<std::string>()> compile(const std::string& key) {
+        return [this, key]() {
+            ++num_compilations;
+            promises[key] = std::promise<std::string>();
+            return promises[key].get_future().share();
+        };
+    }
+};
+
+StructuredOutputConfig json_schema_config(const std::string& json_schema) {
+    StructuredOutputConfig structured_output_config;
+    structured_output_config.json_schema = json_schema;
+    return structured_output_config;
+}
+
+}  // namespace
+
+TEST(CompiledGrammarCacheTest, returns_cached_grammar_on_hit) {
+    CompiledGrammarCache<std::string> cache(2);
+    CompilationTasks tasks;
+
+    auto first = cache.get_or_compile("a", tasks.compile("a"));
+    // grammar is shared while its compilation is still in progress
+    auto second = cache.get_or_compile("a", tasks.compile("a"));
+    EXPECT_EQ(tasks.num_compilations, 1);
+
+    tasks.promises["a"].set_value("compiled a");
+    EXPECT_EQ(first.get(), "compiled a");
+    EXPECT_EQ(second.get(), "compiled a");
+    EXPECT_EQ(cache.get_or_compile("a", tasks.compile("a")).get(), "compiled a");
+    EXPECT_EQ(tasks.num_compilations, 1);
+}
+
+TEST(CompiledGrammarCacheTest, evicts_least_recently_used_grammar) {
+    CompiledGrammarCache<std::string> cache(2);
+    CompilationTasks tasks;
+
+    cache.get_or_compile("a", tasks.compile("a"));
+    cache.get_or_compile("b", tasks.compile("b"));
+    // "a" becomes the most recently used one
+    cache.get_or_compile("a", tasks.compile("a"));
+    // evicted grammar is still in compilation, its future is kept by the caller
+    auto in_flight = cache.get_or_compile("b", tasks.compile("b"));
+    cache.get_or_compile("a", tasks.compile("a"));
+    cache.get_or_compile("c", tasks.compile("c"));
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.contains("a"));
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_TRUE(cache.contains("c"));
+    EXPECT_EQ(tasks.num_compilations, 3);
+
+    tasks.promises["b"].set_value("compiled b");
+    EXPECT_EQ(in_flight.get(), "compiled b");
+
+    cache.get_or_compile("b", tasks.compile("b"));
+    EXPECT_EQ(tasks.num_compilations, 4);
+    EXPECT_FALSE(cache.contains("a"));
+}
+
+TEST(CompiledGrammarCacheTest, recompiles_grammar_which_failed_to_compile) {
+    CompiledGrammarCache<std::string> cache(2);
+    CompilationTasks tasks;
+
+    auto failed = cache.get_or_compile("a", tasks.compile("a"));
+    tasks.promises["a"].set_exception(std::make_exception_ptr(std::runtime_error("compilation failed")));
+    EXPECT_THROW(failed.get(), std::runtime_error);
+
+    auto recompiled = cache.get_or_compile("a", tasks.compile("a"));
+    EXPECT_EQ(tasks.num_compilations, 2);
+    EXPECT_EQ(cache.size(), 1);
+    tasks.promises["a"].set_value("compiled a");
+    EXPECT_EQ(recompiled.get(), "compiled a");
+}
+
+TEST(CompiledGrammarCacheTest, failed_compilation_start_is_not_cached) {
+    CompiledGrammarCache<std::string> cache(2);
+    EXPECT_THROW(cache.get_or_compile("a", []() -> std::shared_future<std::string> {
+        throw std::runtime_error("invalid grammar");
+    }), std::runtime_error);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(CompiledGrammarCacheTest, json_schema_key_ignores_formatting_only) {
+    const auto key = get_grammar_key(json_schema_config(R"({"type": "object", "properties": {"a": {"type": "integer"}, "b": {"type": "string"}}})"));
+    EXPECT_EQ(key, get_grammar_key(json_schema_config(R"({
+        "type" : "object",
+        "properties" : { "a" : { "type" : "integer" }, "b" : { "type" : "string" } }
+    })")));
+    // order of properties defines order of fields in the generated JSON, so such schemas are compiled separately
+    EXPECT_NE(key, get_grammar_key(json_schema_config(R"({"type": "object", "properties": {"b": {"type": "string"}, "a": {"type": "integer"}}})")));
+}
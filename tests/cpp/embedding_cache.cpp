@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "rag/embedding_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::vector<float> get_embedding(float value) {
+    return std::vector<float>(4, value);
+}
+
+std::vector<float> get_cached(EmbeddingCache& cache, const std::string& text) {
+    std::vector<float> embedding(4);
+    if (!cache.get(cache.get_key(text), embedding.data(), embedding.size() * sizeof(float))) {
+        return {};
+    }
+    return embedding;
+}
+
+void put(EmbeddingCache& cache, const std::string& text, float value) {
+    const auto embedding = get_embedding(value);
+    cache.put(cache.get_key(text), embedding.data(), embedding.size() * sizeof(float));
+}
+
+}  // namespace
+
+TEST(TestEmbeddingCache, evicts_least_recently_used) {
+    // budget of 3 embeddings
+    EmbeddingCache cache(3 * 4 * sizeof(float), 1);
+    put(cache, "a", 1.0f);
+    put(cache, "b", 2.0f);
+    put(cache, "c", 3.0f);
+    EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+
+    // "b" is the least recently used
+    put(cache, "d", 4.0f);
+    EXPECT_TRUE(get_cached(cache, "b").empty());
+    EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+    EXPECT_EQ(get_cached(cache, "c"), get_embedding(3.0f));
+    EXPECT_EQ(get_cached(cache, "d"), get_embedding(4.0f));
+
+    const auto metrics = cache.get_metrics();
+    EXPECT_EQ(metrics.num_hits, 4);
+    EXPECT_EQ(metrics.num_misses, 1);
+    EXPECT_EQ(metrics.num_entries, 3);
+    EXPECT_EQ(metrics.size_bytes, 3 * 4 * sizeof(float));
+    EXPECT_FLOAT_EQ(metrics.get_hit_ratio(), 0.8f);
+
+    // embeddings of a cache have the same size
+    const std::vector<float> other_size(8);
+    EXPECT_THROW(cache.put(cache.get_key("e"), other_size.data(), other_size.size() * sizeof(float)), ov::Exception);
+}
+
+TEST(TestEmbeddingCache, keys_depend_on_model) {
+    EmbeddingCache cache(1024, 1), other_model_cache(1024, 2);
+    EXPECT_NE(cache.get_key("text"), other_model_cache.get_key("text"));
+    EXPECT_NE(cache.get_key("text"), cache.get_key("text "));
+    EXPECT_EQ(cache.get_key("text"), EmbeddingCache(1024, 1).get_key("text"));
+}
+
+TEST(TestEmbeddingCache, saves_and_loads_cache) {
+    const auto path = std::filesystem::temp_directory_path() / "test_embedding_cache.bin";
+    {
+        EmbeddingCache cache(1024, 1);
+        put(cache, "a", 1.0f);
+        put(cache, "b", 2.0f);
+        put(cache, "c", 3.0f);
+        get_cached(cache, "a");
+        cache.save(path);
+    }
+    {
+        EmbeddingCache cache(1024, 1);
+        cache.load(path);
+        EXPECT_EQ(cache.get_metrics().num_entries, 3);
+        EXPECT_EQ(get_cached(cache, "b"), get_embedding(2.0f));
+
+        // embeddings added after load are kept in memory next to mapped ones
+        put(cache, "d", 4.0f);
+        EXPECT_EQ(get_cached(cache, "d"), get_embedding(4.0f));
+        EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+    }
+    {
+        // the most recently used embeddings are loaded if the file doesn't fit the budget
+        EmbeddingCache cache(2 * 4 * sizeof(float), 1);
+        cache.load(path);
+        EXPECT_EQ(cache.get_metrics().num_entries, 2);
+        EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+        EXPECT_EQ(get_cached(cache, "c"), get_embedding(3.0f));
+        EXPECT_TRUE(get_cached(cache, "b").empty());
+    }
+    {
+        // file of another model is ignored
+        EmbeddingCache cache(1024, 2);
+        cache.load(path);
+        EXPECT_EQ(cache.get_metrics().num_entries, 0);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(TestEmbeddingCache, saves_to_loaded_file) {
+    const auto path = std::filesystem::temp_directory_path() / "test_resaved_embedding_cache.bin";
+    {
+        EmbeddingCache cache(1024, 1);
+        put(cache, "a", 1.0f);
+        put(cache, "b", 2.0f);
+        cache.save(path);
+    }
+    {
+        EmbeddingCache cache(1024, 1);
+        cache.load(path);
+        put(cache, "c", 3.0f);
+        cache.save(path);
+        // mapped embeddings are still available after the file is replaced
+        EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+        cache.save(path);
+    }
+    {
+        EmbeddingCache cache(1024, 1);
+        cache.load(path);
+        EXPECT_EQ(cache.get_metrics().num_entries, 3);
+        EXPECT_EQ(get_cached(cache, "a"), get_embedding(1.0f));
+        EXPECT_EQ(get_cached(cache, "b"), get_embedding(2.0f));
+        EXPECT_EQ(get_cached(cache, "c"), get_embedding(3.0f));
+    }
+    std::filesystem::remove(path);
+}
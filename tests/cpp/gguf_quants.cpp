@@ -0,0 +1,364 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_GGUF
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gguf_utils/gguf.hpp"
+
+namespace {
+
+constexpr size_t ROWS = 4;
+constexpr size_t COLUMNS = 512;
+
+struct QuantType {
+    gguf_tensor_type type;
+    size_t block_size;
+    size_t bytes_per_block;
+    size_t bits;
+    // weights are quantized again or the block min isn't a multiple of the scale, so values restored with the integer
+    // zero point match the reference up to half of the scale
+    bool is_rounded;
+};
+
+uint16_t to_f16_bits(float value) {
+    return ov::float16(value).to_bits();
+}
+
+float from_f16(const uint8_t* data) {
+    uint16_t bits;
+    std::memcpy(&bits, data, sizeof(bits));
+    return static_cast<float>(ov::float16::from_bits(bits));
+}
+
+// Random blocks with small positive f16 scales, so dequantized values are finite, and mins like the ones of quantized
+// weights
+std::vector<uint8_t> get_random_blocks(const QuantType& qtype, size_t num_blocks, uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::vector<uint8_t> data(num_blocks * qtype.bytes_per_block);
+    for (auto& byte : data) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    std::uniform_real_distribution<float> distribution(0.001f, 0.01f);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        uint8_t* block = data.data() + i * qtype.bytes_per_block;
+        auto set_f16 = [&](size_t offset, float value) {
+            const uint16_t bits = to_f16_bits(value);
+            std::memcpy(block + offset, &bits, sizeof(bits));
+        };
+        auto set_random_f16 = [&](size_t offset) {
+            set_f16(offset, distribution(engine));
+        };
+        switch (qtype.type) {
+        case GGUF_TYPE_Q4_0:
+        case GGUF_TYPE_Q5_0:
+        case GGUF_TYPE_Q8_0:
+            set_random_f16(0);
+            break;
+        case GGUF_TYPE_Q4_1:
+        case GGUF_TYPE_Q5_1: {
+            // the min of a block is a negative value, which is within the range of quantized weights
+            const float d = distribution(engine);
+            const float max_zero_point = static_cast<float>((1 << qtype.bits) - 1);
+            set_f16(0, d);
+            set_f16(2, -d * std::uniform_real_distribution<float>(0.f, max_zero_point)(engine));
+            break;
+        }
+        case GGUF_TYPE_Q2_K:
+            set_random_f16(80);
+            set_random_f16(82);
+            break;
+        case GGUF_TYPE_Q3_K:
+            set_random_f16(108);
+            break;
+        case GGUF_TYPE_Q4_K:
+        case GGUF_TYPE_Q5_K:
+            set_random_f16(0);
+            set_random_f16(2);
+            // 6-bit scales are at least 32 and mins are at most 15, so zero points are within the range of weights
+            for (size_t j = 0; j < 4; ++j) {
+                block[4 + j] |= 0xA0;
+                block[8 + j] &= 0x0F;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return data;
+}
+
+// Dequantization as it's done by llama.cpp
+std::vector<float> dequantize(const QuantType& qtype, const std::vector<uint8_t>& data) {
+    const size_t num_blocks = data.size() / qtype.bytes_per_block;
+    std::vector<float> values(num_blocks * qtype.block_size);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        const uint8_t* x = data.data() + i * qtype.bytes_per_block;
+        float* y = values.data() + i * qtype.block_size;
+        switch (qtype.type) {
+        case GGUF_TYPE_Q4_0: {
+            const float d = from_f16(x);
+            for (size_t j = 0; j < 16; ++j) {
+                y[j] = d * ((x[2 + j] & 0x0F) - 8);
+                y[j + 16] = d * ((x[2 + j] >> 4) - 8);
+            }
+            break;
+        }
+        case GGUF_TYPE_Q4_1: {
+            const float d = from_f16(x), m = from_f16(x + 2);
+            for (size_t j = 0; j < 16; ++j) {
+                y[j] = d * (x[4 + j] & 0x0F) + m;
+                y[j + 16] = d * (x[4 + j] >> 4) + m;
+            }
+            break;
+        }
+        case GGUF_TYPE_Q5_0: {
+            const float d = from_f16(x);
+            uint32_t qh;
+            std::memcpy(&qh, x + 2, sizeof(qh));
+            for (size_t j = 0; j < 16; ++j) {
+                const uint8_t xh_0 = ((qh >> j) << 4) & 0x10;
+                const uint8_t xh_1 = ((qh >> (j + 12))) & 0x10;
+                y[j] = d * (((x[6 + j] & 0x0F) | xh_0) - 16);
+                y[j + 16] = d * (((x[6 + j] >> 4) | xh_1) - 16);
+            }
+            break;
+        }
+        case GGUF_TYPE_Q5_1: {
+            const float d = from_f16(x), m = from_f16(x + 2);
+            uint32_t qh;
+            std::memcpy(&qh, x + 4, sizeof(qh));
+            for (size_t j = 0; j < 16; ++j) {
+                const uint8_t xh_0 = ((qh >> j) << 4) & 0x10;
+                const uint8_t xh_1 = ((qh >> (j + 12))) & 0x10;
+                y[j] = d * ((x[8 + j] & 0x0F) | xh_0) + m;
+                y[j + 16] = d * ((x[8 + j] >> 4) | xh_1) + m;
+            }
+            break;
+        }
+        case GGUF_TYPE_Q8_0: {
+            const float d = from_f16(x);
+            for (size_t j = 0; j < 32; ++j) {
+                y[j] = d * static_cast<int8_t>(x[2 + j]);
+            }
+            break;
+        }
+        case GGUF_TYPE_Q2_K: {
+            const float d = from_f16(x + 80), min = from_f16(x + 82);
+            const uint8_t* q = x + 16;
+            size_t is = 0;
+            for (size_t n = 0; n < 256; n += 128) {
+                for (size_t shift = 0; shift < 8; shift += 2) {
+                    uint8_t sc = x[is++];
+                    for (size_t l = 0; l < 16; ++l) {
+                        *y++ = d * (sc & 0xF) * ((q[l] >> shift) & 3) - min * (sc >> 4);
+                    }
+                    sc = x[is++];
+                    for (size_t l = 0; l < 16; ++l) {
+                        *y++ = d * (sc & 0xF) * ((q[l + 16] >> shift) & 3) - min * (sc >> 4);
+                    }
+                }
+                q += 32;
+            }
+            break;
+        }
+        case GGUF_TYPE_Q3_K: {
+            const uint32_t kmask1 = 0x03030303, kmask2 = 0x0f0f0f0f;
+            const float d_all = from_f16(x + 108);
+            const uint8_t* hm = x;
+            const uint8_t* q = x + 32;
+            uint32_t aux[4];
+            std::memcpy(aux, x + 96, 12);
+            const uint32_t tmp = aux[2];
+            aux[2] = ((aux[0] >> 4) & kmask2) | (((tmp >> 4) & kmask1) << 4);
+            aux[3] = ((aux[1] >> 4) & kmask2) | (((tmp >> 6) & kmask1) << 4);
+            aux[0] = (aux[0] & kmask2) | (((tmp >> 0) & kmask1) << 4);
+            aux[1] = (aux[1] & kmask2) | (((tmp >> 2) & kmask1) << 4);
+            const int8_t* scales = reinterpret_cast<const int8_t*>(aux);
+            size_t is = 0;
+            uint8_t m = 1;
+            for (size_t n = 0; n < 256; n += 128) {
+                for (size_t shift = 0; shift < 8; shift += 2, m <<= 1) {
+                    float dl = d_all * (scales[is++] - 32);
+                    for (size_t l = 0; l < 16; ++l) {
+                        *y++ = dl * (((q[l] >> shift) & 3) - ((hm[l] & m) ? 0 : 4));
+                    }
+                    dl = d_all * (scales[is++] - 32);
+                    for (size_t l = 0; l < 16; ++l) {
+                        *y++ = dl * (((q[l + 16] >> shift) & 3) - ((hm[l + 16] & m) ? 0 : 4));
+                    }
+                }
+                q += 32;
+            }
+            break;
+        }
+        case GGUF_TYPE_Q4_K:
+        case GGUF_TYPE_Q5_K: {
+            const bool has_high_bits = qtype.type == GGUF_TYPE_Q5_K;
+            const float d = from_f16(x), min = from_f16(x + 2);
+            const uint8_t* scales = x + 4;
+            const uint8_t* qh = x + 16;
+            const uint8_t* ql = x + (has_high_bits ? 48 : 16);
+            auto get_scale_min = [&](size_t j, uint8_t& sc, uint8_t& m) {
+                if (j < 4) {
+                    sc = scales[j] & 63;
+                    m = scales[j + 4] & 63;
+                } else {
+                    sc = (scales[j + 4] & 0xF) | ((scales[j - 4] >> 6) << 4);
+                    m = (scales[j + 4] >> 4) | ((scales[j - 0] >> 6) << 4);
+                }
+            };
+            uint8_t u1 = 1, u2 = 2;
+            for (size_t j = 0, is = 0; j < 256; j += 64, is += 2, ql += 32, u1 <<= 2, u2 <<= 2) {
+                uint8_t sc, m;
+                get_scale_min(is, sc, m);
+                const float d1 = d * sc, m1 = min * m;
+                get_scale_min(is + 1, sc, m);
+                const float d2 = d * sc, m2 = min * m;
+                for (size_t l = 0; l < 32; ++l) {
+                    const int high = has_high_bits && (qh[l] & u1) ? 16 : 0;
+                    *y++ = d1 * ((ql[l] & 0xF) + high) - m1;
+                }
+                for (size_t l = 0; l < 32; ++l) {
+                    const int high = has_high_bits && (qh[l] & u2) ? 16 : 0;
+                    *y++ = d2 * ((ql[l] >> 4) + high) - m2;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return values;
+}
+
+gguf_tensor get_tensor(const QuantType& qtype, std::vector<uint8_t>& data, size_t rows, size_t columns) {
+    static const char name[] = "blk.0.ffn_up.weight";
+    gguf_tensor tensor{};
+    tensor.name = name;
+    tensor.namelen = sizeof(name) - 1;
+    tensor.type = qtype.type;
+    tensor.ndim = 2;
+    tensor.dim[0] = columns;
+    tensor.dim[1] = rows;
+    tensor.bsize = data.size();
+    tensor.num_weights = rows * columns;
+    tensor.weights_data = data.data();
+    return tensor;
+}
+
+uint8_t get_weight(const ov::Tensor& weights, size_t bits, size_t index) {
+    const uint8_t* data = static_cast<const uint8_t*>(weights.data());
+    if (bits == 4) {
+        return (data[index / 2] >> (4 * (index % 2))) & 0x0F;
+    }
+    return data[index];
+}
+
+const std::vector<QuantType> QUANT_TYPES = {
+    {GGUF_TYPE_Q4_0, 32, 18, 4, false},
+    {GGUF_TYPE_Q4_1, 32, 20, 4, true},
+    {GGUF_TYPE_Q5_0, 32, 22, 8, false},
+    {GGUF_TYPE_Q5_1, 32, 24, 8, true},
+    {GGUF_TYPE_Q8_0, 32, 34, 8, false},
+    {GGUF_TYPE_Q2_K, 256, 84, 8, true},
+    {GGUF_TYPE_Q3_K, 256, 110, 8, true},
+    {GGUF_TYPE_Q4_K, 256, 144, 4, true},
+    {GGUF_TYPE_Q5_K, 256, 176, 8, true},
+};
+
+}  // namespace
+
+TEST(TestGGUFQuants, unpacked_weights_match_dequantized) {
+    for (const QuantType& qtype : QUANT_TYPES) {
+        const size_t num_blocks = ROWS * COLUMNS / qtype.block_size;
+        std::vector<uint8_t> data = get_random_blocks(qtype, num_blocks, qtype.type);
+        const std::vector<float> reference = dequantize(qtype, data);
+
+        std::unordered_map<std::string, ov::Tensor> parts;
+        std::unordered_map<std::string, gguf_tensor_type> qtypes;
+        gguf_load_quantized(parts, qtypes, get_tensor(qtype, data, ROWS, COLUMNS));
+        ASSERT_EQ(qtypes.at("blk.0.ffn_up.qtype"), qtype.type);
+
+        const ov::Tensor& weights = parts.at("blk.0.ffn_up.weight");
+        const ov::Tensor& scales = parts.at("blk.0.ffn_up.scales");
+        const ov::Tensor& biases = parts.at("blk.0.ffn_up.biases");
+        ASSERT_EQ(weights.get_byte_size(), ROWS * COLUMNS * qtype.bits / 8);
+        // GPU and CPU plugins support groups of 32 weights
+        ASSERT_EQ(scales.get_size(), ROWS * COLUMNS / 32);
+
+        for (size_t i = 0; i < reference.size(); ++i) {
+            const float scale = static_cast<float>(scales.data<ov::float16>()[i / 32]);
+            const float bias = static_cast<float>(biases.data<ov::float16>()[i / 32]);
+            // weights are restored with the zero point rounded to u8 like in the model
+            const float zero_point = std::round(-bias / scale);
+            ASSERT_GE(zero_point, 0.f) << "type " << qtype.type << ", weight " << i;
+            ASSERT_LT(zero_point, static_cast<float>(1 << qtype.bits)) << "type " << qtype.type << ", weight " << i;
+            const float value = scale * (get_weight(weights, qtype.bits, i) - zero_point);
+            const float tolerance = qtype.is_rounded
+                                        ? 0.51f * std::abs(scale) + 1e-3f * std::abs(reference[i])
+                                        : 1e-3f * (std::abs(reference[i]) + std::abs(bias) + 16 * std::abs(scale));
+            ASSERT_NEAR(value, reference[i], tolerance) << "type " << qtype.type << ", weight " << i;
+        }
+    }
+}
+
+TEST(TestGGUFQuants, throws_for_incompatible_shape) {
+    const QuantType& qtype = QUANT_TYPES.front();
+    std::vector<uint8_t> data = get_random_blocks(qtype, 1, 0);
+    std::unordered_map<std::string, ov::Tensor> parts;
+    std::unordered_map<std::string, gguf_tensor_type> qtypes;
+    EXPECT_THROW(gguf_load_quantized(parts, qtypes, get_tensor(qtype, data, 2, 16)), ov::Exception);
+}
+
+TEST(TestGGUFQuants, requantized_scales_are_normal_f16) {
+    const QuantType& qtype = *std::find_if(QUANT_TYPES.begin(), QUANT_TYPES.end(), [](const QuantType& qtype) {
+        return qtype.type == GGUF_TYPE_Q3_K;
+    });
+    std::vector<uint8_t> data = get_random_blocks(qtype, COLUMNS / qtype.block_size, 1);
+    // values of super-blocks are far below the smallest normal f16
+    for (size_t i = 0; i < data.size(); i += qtype.bytes_per_block) {
+        const uint16_t bits = to_f16_bits(1e-7f);
+        std::memcpy(data.data() + i + 108, &bits, sizeof(bits));
+    }
+    std::unordered_map<std::string, ov::Tensor> parts;
+    std::unordered_map<std::string, gguf_tensor_type> qtypes;
+    gguf_load_quantized(parts, qtypes, get_tensor(qtype, data, 1, COLUMNS));
+
+    const ov::Tensor& scales = parts.at("blk.0.ffn_up.scales");
+    for (size_t i = 0; i < scales.get_size(); ++i) {
+        EXPECT_GE(static_cast<float>(scales.data<ov::float16>()[i]), 6.103515625e-05f);
+    }
+}
+
+// Repack throughput in GB/s of GGUF data, run with --gtest_also_run_disabled_tests
+TEST(TestGGUFQuants, DISABLED_repack_throughput) {
+    constexpr size_t rows = 4096, columns = 4096, iterations = 5;
+    for (const QuantType& qtype : QUANT_TYPES) {
+        std::vector<uint8_t> data = get_random_blocks(qtype, rows * columns / qtype.block_size, 0);
+        const gguf_tensor tensor = get_tensor(qtype, data, rows, columns);
+        std::chrono::duration<double> best_time{std::numeric_limits<double>::max()};
+        for (size_t i = 0; i < iterations; ++i) {
+            std::unordered_map<std::string, ov::Tensor> parts;
+            std::unordered_map<std::string, gguf_tensor_type> qtypes;
+            const auto start_time = std::chrono::steady_clock::now();
+            gguf_load_quantized(parts, qtypes, tensor);
+            best_time = std::min<std::chrono::duration<double>>(best_time, std::chrono::steady_clock::now() - start_time);
+        }
+        std::cout << "type " << qtype.type << ": " << data.size() / best_time.count() / 1e9 << " GB/s" << std::endl;
+    }
+}
+
+#endif  // ENABLE_GGUF
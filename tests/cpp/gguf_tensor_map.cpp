@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_GGUF
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gguf_utils/gguf.hpp"
+
+namespace {
+
+constexpr size_t COLUMNS = 64;
+// Q4_0 block: |16 bit scale|32 x 4-bit weights|
+constexpr size_t Q4_0_BLOCK_SIZE = 32;
+constexpr size_t Q4_0_BYTES_PER_BLOCK = 18;
+
+// Synthetic tensor, its data is not mapped from a file
+struct TestTensor {
+    std::string name;
+    std::vector<uint8_t> data;
+
+    TestTensor(std::string tensor_name, uint32_t seed) : name{std::move(tensor_name)} {
+        std::mt19937 engine(seed);
+        data.resize(COLUMNS / Q4_0_BLOCK_SIZE * Q4_0_BYTES_PER_BLOCK);
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        const uint16_t scale = ov::float16(0.01f).to_bits();
+        for (size_t i = 0; i < data.size(); i += Q4_0_BYTES_PER_BLOCK) {
+            std::memcpy(data.data() + i, &scale, sizeof(scale));
+        }
+    }
+
+    GGUFTensorInfo get_info() {
+        gguf_tensor tensor{};
+        tensor.name = name.c_str();
+        tensor.namelen = name.size();
+        tensor.type = GGUF_TYPE_Q4_0;
+        tensor.ndim = 2;
+        tensor.dim[0] = COLUMNS;
+        tensor.dim[1] = 1;
+        tensor.bsize = data.size();
+        tensor.num_weights = COLUMNS;
+        tensor.weights_data = data.data();
+        return GGUFTensorInfo{nullptr, tensor};
+    }
+};
+
+bool is_equal(const ov::Tensor& lhs, const ov::Tensor& rhs) {
+    return lhs.get_shape() == rhs.get_shape() && lhs.get_byte_size() == rhs.get_byte_size() &&
+           std::memcmp(lhs.data(), rhs.data(), lhs.get_byte_size()) == 0;
+}
+
+}  // namespace
+
+TEST(TestGGUFTensorMap, split_files_are_merged_in_order_of_files) {
+    const std::vector<std::string> files = {"model-00001-of-00003.gguf",
+                                            "model-00002-of-00003.gguf",
+                                            "model-00003-of-00003.gguf"};
+    std::vector<TestTensor> tensors = {{"blk.0.ffn_up.weight", 0}, {"blk.1.ffn_up.weight", 1}, {"blk.2.ffn_up.weight", 2}};
+
+    auto [arrays, qtypes] = load_split_arrays(
+        files,
+        [&](size_t i,
+            std::unordered_map<std::string, GGUFTensorInfo>& file_arrays,
+            std::unordered_map<std::string, gguf_tensor_type>& file_qtypes) {
+            // files are listed in reverse order of their indices
+            std::this_thread::sleep_for(std::chrono::milliseconds(10 * (files.size() - i)));
+            file_arrays.emplace(tensors[i].name, tensors[i].get_info());
+            file_qtypes.emplace("blk." + std::to_string(i) + ".ffn_up.qtype", GGUF_TYPE_Q4_0);
+        });
+
+    ASSERT_EQ(arrays.size(), tensors.size());
+    ASSERT_EQ(qtypes.size(), tensors.size());
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        EXPECT_EQ(arrays.at(tensors[i].name).tensor.weights_data, tensors[i].data.data());
+        EXPECT_EQ(qtypes.at("blk." + std::to_string(i) + ".ffn_up.qtype"), GGUF_TYPE_Q4_0);
+    }
+}
+
+TEST(TestGGUFTensorMap, throws_for_tensor_in_several_split_files) {
+    const std::vector<std::string> files = {"model-00001-of-00002.gguf", "model-00002-of-00002.gguf"};
+    TestTensor tensor("blk.0.ffn_up.weight", 0);
+
+    try {
+        load_split_arrays(files,
+                          [&](size_t,
+                              std::unordered_map<std::string, GGUFTensorInfo>& file_arrays,
+                              std::unordered_map<std::string, gguf_tensor_type>&) {
+                              file_arrays.emplace(tensor.name, tensor.get_info());
+                          });
+        FAIL() << "Duplicate tensor is not detected";
+    } catch (const ov::Exception& exception) {
+        // the tensor is reported in the second file in any order of listing
+        EXPECT_NE(std::string(exception.what()).find(files[1]), std::string::npos) << exception.what();
+    }
+}
+
+TEST(TestGGUFSplitFiles, lists_files_of_split_model) {
+    EXPECT_EQ(get_split_files("models/qwen-00001-of-00003.gguf"),
+              (std::vector<std::string>{"models/qwen-00001-of-00003.gguf",
+                                        "models/qwen-00002-of-00003.gguf",
+                                        "models/qwen-00003-of-00003.gguf"}));
+    // any file of the model lists all files of it
+    EXPECT_EQ(get_split_files("qwen-00002-of-00002.gguf"),
+              (std::vector<std::string>{"qwen-00001-of-00002.gguf", "qwen-00002-of-00002.gguf"}));
+    for (const std::string file : {"qwen.gguf", "qwen-1-of-3.gguf", "qwen-0000a-of-00003.gguf", "qwen-00001-of-00003.bin"}) {
+        EXPECT_EQ(get_split_files(file), std::vector<std::string>{file});
+    }
+}
+
+TEST(TestGGUFTensorMap, prefetched_tensors_are_released_by_at) {
+    TestTensor up("blk.0.ffn_up.weight", 0), down("blk.0.ffn_down.weight", 1), other_layer("blk.1.ffn_up.weight", 2);
+    std::unordered_map<std::string, GGUFTensorInfo> infos;
+    for (auto [key, tensor] : {std::pair{"model.layers[0].mlp.up_proj", &up},
+                               std::pair{"model.layers[0].mlp.down_proj", &down},
+                               std::pair{"model.layers[1].mlp.up_proj", &other_layer}}) {
+        for (const std::string suffix : {".weight", ".scales", ".biases"}) {
+            infos.emplace(key + suffix, tensor->get_info());
+        }
+    }
+    const GGUFTensorMap consts(std::move(infos));
+
+    std::unordered_map<std::string, ov::Tensor> reference;
+    std::unordered_map<std::string, gguf_tensor_type> qtypes;
+    gguf_load_quantized(reference, qtypes, up.get_info().tensor);
+
+    consts.prefetch("model.layers[0].");
+    // only tensors of the selected layer are unpacked
+    const size_t prefetched_bytes = consts.get_unpacked_bytes();
+    EXPECT_EQ(prefetched_bytes, up.data.size() + down.data.size());
+    // prefetch skips tensors which are already unpacked
+    consts.prefetch("model.layers[0].");
+    EXPECT_EQ(consts.get_unpacked_bytes(), prefetched_bytes);
+
+    // parts of prefetched tensors are handed off without unpacking
+    EXPECT_TRUE(is_equal(consts.at("model.layers[0].mlp.up_proj.weight"), reference.at("blk.0.ffn_up.weight")));
+    EXPECT_TRUE(is_equal(consts.at("model.layers[0].mlp.up_proj.scales"), reference.at("blk.0.ffn_up.scales")));
+    EXPECT_TRUE(is_equal(consts.at("model.layers[0].mlp.up_proj.biases"), reference.at("blk.0.ffn_up.biases")));
+    EXPECT_EQ(consts.get_unpacked_bytes(), prefetched_bytes);
+
+    // handed off parts are erased, so they are unpacked again on the next request
+    EXPECT_TRUE(is_equal(consts.at("model.layers[0].mlp.up_proj.weight"), reference.at("blk.0.ffn_up.weight")));
+    EXPECT_EQ(consts.get_unpacked_bytes(), prefetched_bytes + up.data.size());
+}
+
+#endif  // ENABLE_GGUF
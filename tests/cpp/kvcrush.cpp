@@ -29,12 +29,12 @@ protected:
     }
 
     // Helper to create mock attention scores
-    std::vector<std::vector<double>> create_mock_scores(size_t num_layers, size_t sequence_length) {
-        std::vector<std::vector<double>> scores(num_layers);
+    std::vector<std::vector<float>> create_mock_scores(size_t num_layers, size_t sequence_length) {
+        std::vector<std::vector<float>> scores(num_layers);
         for (size_t i = 0; i < num_layers; i++) {
             scores[i].resize(sequence_length);
             for (size_t j = 0; j < sequence_length; j++) {
-                scores[i][j] = static_cast<double>(j % 10) / 10.0;  // Repeating pattern 0.0, 0.1, ..., 0.9
+                scores[i][j] = static_cast<float>(j % 10) / 10.0f;  // Repeating pattern 0.0, 0.1, ..., 0.9
             }
         }
         return scores;
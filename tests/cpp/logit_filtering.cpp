@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <numeric>
 #include <openvino/core/except.hpp>
 
 #include "sampling/logit_processor.hpp"
@@ -344,3 +345,73 @@ INSTANTIATE_TEST_SUITE_P(VariousInputs,
                          EOSPenaltyTransformTest,
                          testing::ValuesIn(EOS_PENALTY_TRANSFORM_TEST_CASES));
 
+
+TEST(PenaltyTransformTest, AllPenaltiesInSinglePass) {
+    float input[]{1.0f, -2.0f, 3.0f, 0.5f};
+    Logits logits(input, 4);
+    auto token_statistics = std::make_shared<TokenStatistics>();
+    token_statistics->set_prompt_token_ids({3, 0, 3});
+    auto transform = PenaltyTransform(1.5, 0.3, 0.2);
+    transform.set_token_statistics(token_statistics);
+    transform.apply(logits, {1, 2, 1});
+
+    // prompt tokens get repetition penalty only, generated ones get all penalties according to number of occurrences
+    float expected_output[]{0.6666667f, -2.3f, 1.5f, 0.3333333f};
+    for (size_t i = 0; i < logits.m_size; i++) {
+        EXPECT_NEAR(logits.m_data[i], expected_output[i], 1e-6);
+    }
+}
+
+TEST(TokenStatisticsTest, CountsGeneratedTokens) {
+    TokenStatistics token_statistics;
+    token_statistics.set_prompt_token_ids({5, 1, 5, 3});
+    EXPECT_EQ(token_statistics.get_unique_prompt_token_ids(), TokenIds({1, 3, 5}));
+    EXPECT_TRUE(token_statistics.is_prompt_token(3));
+    EXPECT_FALSE(token_statistics.is_prompt_token(4));
+
+    // enough distinct tokens to grow the hash table several times
+    for (int64_t token_id = 0; token_id < 1000; ++token_id) {
+        token_statistics.register_generated_token(token_id * 7);
+        token_statistics.register_generated_token(token_id * 7);
+    }
+    token_statistics.register_generated_token(14);
+    EXPECT_EQ(token_statistics.get_generated_token_ids().size(), 1000u);
+    EXPECT_EQ(token_statistics.get_generated_token_count(14), 3u);
+    EXPECT_EQ(token_statistics.get_generated_token_count(6993), 2u);
+    EXPECT_EQ(token_statistics.get_generated_token_count(15), 0u);
+
+    token_statistics.unregister_generated_token(14);
+    EXPECT_EQ(token_statistics.get_generated_token_count(14), 2u);
+    EXPECT_THROW(token_statistics.unregister_generated_token(15), ov::Exception);
+}
+
+TEST(TokenStatisticsTest, MemoryDependsOnUniqueTokensOnly) {
+    const size_t vocab_size = 32000, prompt_len = 100000;
+    TokenIds prompt_token_ids(prompt_len);
+    for (size_t i = 0; i < prompt_len; ++i) {
+        prompt_token_ids[i] = static_cast<int64_t>((i * 7919) % vocab_size);
+    }
+    TokenStatistics token_statistics;
+    token_statistics.set_prompt_token_ids(prompt_token_ids);
+    EXPECT_EQ(token_statistics.get_unique_prompt_token_ids().size(), vocab_size);
+    const size_t initial_byte_size = 16 * sizeof(size_t);
+    EXPECT_EQ(token_statistics.get_byte_size(), vocab_size * sizeof(int64_t) + initial_byte_size);
+
+    // repeated tokens do not consume memory
+    for (size_t i = 0; i < prompt_len; ++i) {
+        token_statistics.register_generated_token(prompt_token_ids[i] % 100);
+    }
+    const size_t byte_size = token_statistics.get_byte_size();
+    EXPECT_LE(byte_size, vocab_size * sizeof(int64_t) + 100 * (2 * sizeof(int64_t) + 2 * sizeof(size_t) + 4 * sizeof(size_t)));
+    const auto& generated_counts = token_statistics.get_generated_token_counts();
+    EXPECT_EQ(token_statistics.get_generated_token_ids().size(), 100u);
+    EXPECT_EQ(std::accumulate(generated_counts.begin(), generated_counts.end(), size_t(0)), prompt_len);
+
+    // hash table and dense arrays grow at most by factor of 2 of the number of unique generated tokens
+    const size_t num_unique_tokens = 10000;
+    for (size_t i = 0; i < num_unique_tokens; ++i) {
+        token_statistics.register_generated_token(static_cast<int64_t>(i));
+    }
+    EXPECT_LE(token_statistics.get_byte_size(),
+              vocab_size * sizeof(int64_t) + num_unique_tokens * (2 * sizeof(int64_t) + 2 * sizeof(size_t) + 4 * sizeof(size_t)));
+}
@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <functional>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "continuous_batching/pipeline_impl.hpp"
+#include "helper.hpp"
+
+using namespace ov::genai;
+
+class PromptDeduplicationTest : public testing::Test, public ContinuousBatchingPipeline {
+protected:
+    // runs scheduling part of the pipeline step, model inference and sampling are emulated
+    class PipelineTestInstance : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
+    public:
+        PipelineTestInstance() {
+            SchedulerConfig scheduler_config;
+            scheduler_config.num_kv_blocks = 16;
+            scheduler_config.max_num_batched_tokens = 32;
+            scheduler_config.dynamic_split_fuse = true;
+            scheduler_config.enable_prompt_deduplication = true;
+
+            ov::Core core;
+            ov::InferRequest request = core.compile_model(get_dummy_model(core, 2)).create_infer_request();
+            m_block_size = 4;
+            m_sampler = std::make_shared<Sampler>();
+            m_scheduler = std::make_shared<Scheduler>(m_block_size, std::make_shared<CacheManager>(request), scheduler_config);
+        }
+
+        SequenceGroup::Ptr add_request(uint64_t request_id, const std::vector<int64_t>& prompt) {
+            auto sequence_group = std::make_shared<SequenceGroup>(request_id,
+                                                                  ov::Tensor(ov::element::i64, {prompt.size()}, const_cast<int64_t*>(prompt.data())),
+                                                                  greedy(),
+                                                                  m_block_size);
+            std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+            m_awaiting_requests.push_back(sequence_group);
+            return sequence_group;
+        }
+
+        // returns number of scheduled tokens per request, the same token is generated by all requests
+        // @param during_inference called between scheduling and sampling, when inference of the step is in flight
+        std::map<uint64_t, size_t> step(int64_t generated_token = 100, const std::function<void()>& during_inference = {}) {
+            _pull_awaiting_requests();
+            _release_pending_prompt_forks();
+            m_scheduler->schedule(m_requests);
+            if (during_inference) {
+                during_inference();
+            }
+            std::map<uint64_t, size_t> num_scheduled_tokens;
+            for (const auto& request : m_requests) {
+                if (!request->is_scheduled()) {
+                    continue;
+                }
+                num_scheduled_tokens[request->get_request_id()] = request->get_num_scheduled_tokens();
+                const bool is_prompt_done = request->get_num_processed_tokens() + request->get_num_scheduled_tokens() >= request->get_prompt_len();
+                request->finish_iteration();
+                if (is_prompt_done) {
+                    request->get_running_sequences()[0]->append_token(generated_token, 0.5f);
+                }
+            }
+            return num_scheduled_tokens;
+        }
+
+        void finish_request(const SequenceGroup::Ptr& request) {
+            request->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+            _free_non_running_requests();
+        }
+
+        const std::vector<KVCacheBlock::Ptr>& get_block_table(const SequenceGroup::Ptr& request) const {
+            return m_scheduler->get_block_tables(*request->get_sequences()[0])[0];
+        }
+
+        bool has_block_table(const SequenceGroup::Ptr& request) const {
+            return m_scheduler->has_block_table(request->get_sequences()[0]->get_id());
+        }
+
+        size_t num_pending_prompt_forks() const {
+            return m_pending_prompt_forks.size();
+        }
+
+        void do_work_overlapped_with_inference() {
+            _do_work_overlapped_with_inference();
+        }
+    };
+
+    PipelineTestInstance m_pipeline;
+};
+
+namespace {
+
+// 3 full blocks of size 4 and a partial one
+const std::vector<int64_t> PROMPT = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+
+void expect_shared_blocks(const std::vector<KVCacheBlock::Ptr>& leader_blocks,
+                          const std::vector<KVCacheBlock::Ptr>& follower_blocks,
+                          size_t num_shared_blocks) {
+    ASSERT_GT(follower_blocks.size(), num_shared_blocks);
+    for (size_t i = 0; i < num_shared_blocks; ++i) {
+        EXPECT_EQ(follower_blocks[i], leader_blocks[i]);
+    }
+    // the rest of the prompt is computed in own blocks
+    for (size_t i = num_shared_blocks; i < follower_blocks.size(); ++i) {
+        EXPECT_EQ(follower_blocks[i]->get_references_count(), 1);
+    }
+}
+
+}  // namespace
+
+TEST_F(PromptDeduplicationTest, identical_prompts_arriving_together_share_blocks) {
+    auto leader = m_pipeline.add_request(0, PROMPT);
+    auto follower = m_pipeline.add_request(1, PROMPT);
+
+    // the follower waits until the leader computes the prompt
+    auto scheduled = m_pipeline.step();
+    EXPECT_EQ(scheduled.at(0), PROMPT.size());
+    EXPECT_FALSE(scheduled.count(1));
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 1);
+    EXPECT_FALSE(m_pipeline.has_block_table(follower));
+
+    // the last prompt token is computed by the follower itself to get its own logits
+    scheduled = m_pipeline.step();
+    EXPECT_EQ(scheduled.at(0), 1);
+    EXPECT_EQ(scheduled.at(1), PROMPT.size() - 12);
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 0);
+    expect_shared_blocks(m_pipeline.get_block_table(leader), m_pipeline.get_block_table(follower), 3);
+
+    scheduled = m_pipeline.step();
+    EXPECT_EQ(scheduled.at(0), 1);
+    EXPECT_EQ(scheduled.at(1), 1);
+    expect_shared_blocks(m_pipeline.get_block_table(leader), m_pipeline.get_block_table(follower), 3);
+
+    // shared blocks stay with the follower after the leader is finished
+    const auto shared_blocks = std::vector<KVCacheBlock::Ptr>(m_pipeline.get_block_table(leader).begin(),
+                                                              m_pipeline.get_block_table(leader).begin() + 3);
+    m_pipeline.finish_request(leader);
+    for (size_t i = 0; i < shared_blocks.size(); ++i) {
+        EXPECT_EQ(m_pipeline.get_block_table(follower)[i], shared_blocks[i]);
+        EXPECT_EQ(shared_blocks[i]->get_references_count(), 1);
+    }
+}
+
+TEST_F(PromptDeduplicationTest, identical_prompt_arriving_later_is_forked_immediately) {
+    auto leader = m_pipeline.add_request(0, PROMPT);
+    m_pipeline.step();
+    m_pipeline.step();
+
+    // leader has already computed the prompt, so the follower takes its blocks without waiting
+    auto follower = m_pipeline.add_request(1, PROMPT);
+    auto scheduled = m_pipeline.step();
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 0);
+    EXPECT_EQ(scheduled.at(1), PROMPT.size() - 12);
+    expect_shared_blocks(m_pipeline.get_block_table(leader), m_pipeline.get_block_table(follower), 3);
+}
+
+TEST_F(PromptDeduplicationTest, fork_arriving_during_inference_is_released_at_next_step) {
+    auto leader = m_pipeline.add_request(0, PROMPT);
+    m_pipeline.step();
+
+    SequenceGroup::Ptr follower;
+    std::vector<KVCacheBlock::Ptr> leader_blocks;
+    m_pipeline.step(100, [&] {
+        leader_blocks = m_pipeline.get_block_table(leader);
+        // leader has computed the prompt, but its blocks are in use by the inference, so the fork is deferred
+        follower = m_pipeline.add_request(1, PROMPT);
+        m_pipeline.do_work_overlapped_with_inference();
+        EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 1);
+        EXPECT_FALSE(m_pipeline.has_block_table(follower));
+        EXPECT_EQ(m_pipeline.get_block_table(leader), leader_blocks);
+        for (const auto& block : leader_blocks) {
+            EXPECT_EQ(block->get_references_count(), 1);
+        }
+    });
+
+    auto scheduled = m_pipeline.step();
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 0);
+    EXPECT_EQ(scheduled.at(1), PROMPT.size() - 12);
+    expect_shared_blocks(m_pipeline.get_block_table(leader), m_pipeline.get_block_table(follower), 3);
+}
+
+TEST_F(PromptDeduplicationTest, overlapping_prompts_share_common_full_blocks) {
+    auto leader = m_pipeline.add_request(0, PROMPT);
+    std::vector<int64_t> prompt(PROMPT.begin(), PROMPT.begin() + 6);
+    prompt.insert(prompt.end(), {50, 51, 52, 53, 54});
+    auto follower = m_pipeline.add_request(1, prompt);
+
+    m_pipeline.step();
+    auto scheduled = m_pipeline.step();
+    // only the first block is fully common
+    EXPECT_EQ(scheduled.at(1), prompt.size() - 4);
+    expect_shared_blocks(m_pipeline.get_block_table(leader), m_pipeline.get_block_table(follower), 1);
+}
+
+TEST_F(PromptDeduplicationTest, short_and_distinct_prompts_are_not_deduplicated) {
+    auto first = m_pipeline.add_request(0, PROMPT);
+    // prompt fits a single block, the last token is never shared
+    auto short_prompt = m_pipeline.add_request(1, {0, 1, 2, 3});
+    auto distinct_prompt = m_pipeline.add_request(2, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    auto scheduled = m_pipeline.step();
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 0);
+    EXPECT_EQ(scheduled.at(1), 4);
+    EXPECT_EQ(scheduled.at(2), 9);
+    EXPECT_NE(m_pipeline.get_block_table(first)[0], m_pipeline.get_block_table(short_prompt)[0]);
+    EXPECT_NE(m_pipeline.get_block_table(first)[0], m_pipeline.get_block_table(distinct_prompt)[0]);
+}
+
+TEST_F(PromptDeduplicationTest, follower_computes_prompt_if_leader_is_dropped) {
+    auto leader = m_pipeline.add_request(0, PROMPT);
+    auto follower = m_pipeline.add_request(1, PROMPT);
+    // leader is scheduled first and the follower waits for it
+    m_pipeline.step();
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 1);
+
+    // KV cache of a finished leader is released before the follower is forked
+    m_pipeline.finish_request(leader);
+    auto scheduled = m_pipeline.step();
+    EXPECT_EQ(m_pipeline.num_pending_prompt_forks(), 0);
+    EXPECT_EQ(scheduled.at(1), PROMPT.size());
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "data_parallel/request_router.hpp"
+
+using namespace ov::genai;
+
+TEST(TestRequestRouter, balances_requests_without_common_prefix) {
+    const size_t block_size = 4;
+    RequestRouter router(2, block_size);
+    std::vector<ReplicaLoad> loads(2);
+
+    for (int64_t request_idx = 0; request_idx < 4; ++request_idx) {
+        std::vector<int64_t> prompt_ids(block_size * 2, request_idx + 1);
+        size_t replica_idx = router.route(prompt_ids, loads);
+        loads[replica_idx].num_requests += 1;
+    }
+    EXPECT_EQ(loads[0].num_requests, 2u);
+    EXPECT_EQ(loads[1].num_requests, 2u);
+}
+
+TEST(TestRequestRouter, routes_common_prefix_to_same_replica) {
+    const size_t block_size = 4;
+    RequestRouter router(2, block_size);
+    std::vector<ReplicaLoad> loads(2);
+    loads[0].num_requests = 1;
+
+    std::vector<int64_t> prompt_ids = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    size_t replica_idx = router.route(prompt_ids, loads);
+    EXPECT_EQ(replica_idx, 1u);
+    loads[replica_idx].num_requests += 1;
+
+    // shares the first block only, the least loaded replica is 0 now
+    std::vector<int64_t> other_prompt_ids = {1, 2, 3, 4, 10, 11, 12, 13};
+    EXPECT_EQ(router.route(other_prompt_ids, loads), 1u);
+    EXPECT_EQ(router.get_num_tracked_blocks(), 3u);
+}
+
+TEST(TestRequestRouter, ignores_affinity_of_overloaded_replica) {
+    const size_t block_size = 4;
+    RequestRouter router(2, block_size);
+    std::vector<ReplicaLoad> loads(2);
+
+    std::vector<int64_t> prompt_ids = {1, 2, 3, 4, 5, 6, 7, 8};
+    size_t replica_idx = router.route(prompt_ids, loads);
+    loads[replica_idx].cache_usage = 90.0f;
+    EXPECT_NE(router.route(prompt_ids, loads), replica_idx);
+}
+
+TEST(TestRequestRouter, forgets_oldest_prefixes) {
+    const size_t block_size = 2;
+    RequestRouter router(2, block_size, /* max_tracked_blocks = */ 2);
+    std::vector<ReplicaLoad> loads(2);
+
+    router.route({1, 2, 3, 4}, loads);
+    EXPECT_EQ(router.get_num_tracked_blocks(), 2u);
+    router.route({5, 6, 7, 8}, loads);
+    EXPECT_EQ(router.get_num_tracked_blocks(), 2u);
+}
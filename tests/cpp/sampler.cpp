@@ -32,6 +32,49 @@ TEST(SamplerStopTokenIdsTest, multiple_stop_sequence_no_match) {
     ASSERT_FALSE(is_stop_token_id_hit(generated_tokens.back(), stop_token_ids));
 }
 
+const std::vector<std::string> stop_string_test_vocab = {"Hello", " wor", "ld", " ST", "OP", "\n", "ab", "c", "a"};
+
+TEST(StopStringAutomatonTest, stop_string_split_between_tokens) {
+    StopStringAutomaton automaton({"STOP"});
+    TokenIds generated_tokens = {0, 1, 2, 3, 4};
+    // stop string and word splitting symbols before it are removed
+    auto result = automaton.match(generated_tokens, stop_string_test_vocab, false);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 2);
+
+    result = automaton.match(generated_tokens, stop_string_test_vocab, true);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 0);
+}
+
+TEST(StopStringAutomatonTest, stop_string_in_previous_tokens_is_not_matched) {
+    StopStringAutomaton automaton({"STOP"});
+    ASSERT_FALSE(automaton.match({0, 3, 4, 2}, stop_string_test_vocab, false).is_matched);
+    ASSERT_FALSE(automaton.match({0, 1, 2}, stop_string_test_vocab, false).is_matched);
+}
+
+TEST(StopStringAutomatonTest, stop_string_in_multiple_new_tokens) {
+    StopStringAutomaton automaton({"STOP"});
+    auto result = automaton.match({0, 3, 4, 5, 6}, stop_string_test_vocab, false, 2);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 4);
+}
+
+TEST(StopStringAutomatonTest, overlapping_stop_strings) {
+    auto result = StopStringAutomaton({"bc", "abc"}).match({6, 7}, stop_string_test_vocab, false);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 2);
+
+    result = StopStringAutomaton({"bc"}).match({6, 7}, stop_string_test_vocab, false);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 1);
+
+    // "aab" is found in "a" + "a" + "ab" after a mismatch on the third byte
+    result = StopStringAutomaton({"aab"}).match({8, 8, 6}, stop_string_test_vocab, false);
+    ASSERT_TRUE(result.is_matched);
+    ASSERT_EQ(result.to_remove, 2);
+}
+
 TEST(SamplerValidationMode, gen_phase_to_cut_whole_seq) {
     auto sampling_config = ov::genai::greedy();
     // create sequence group with prompt [0, 1, 2, 3, 4]
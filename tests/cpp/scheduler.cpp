@@ -1114,3 +1114,211 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
 }
 
 
+
+TEST(TestScheduler, test_priority_preempts_lower_priority_requests) {
+    std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).max_num_batched_tokens = 32;
+    configs.at(0).num_kv_blocks = 2;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(0).max_num_seqs = 5;
+    configs.at(1).max_num_batched_tokens = 32;
+    configs.at(1).num_kv_blocks = 2;
+    configs.at(1).dynamic_split_fuse = true;
+    configs.at(1).max_num_seqs = 5;
+    for (auto scheduler_config: configs) {
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+        ov::genai::GenerationConfig low_priority_config = ov::genai::greedy();
+        low_priority_config.priority = 0;
+        ov::genai::GenerationConfig high_priority_config = ov::genai::greedy();
+        high_priority_config.priority = 1;
+
+        SequenceGroup::Ptr low_priority_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                                  low_priority_config, 4);
+        auto low_priority_seq_id = (*low_priority_group)[0]->get_id();
+        std::vector<SequenceGroup::Ptr> requests = {low_priority_group};
+
+        // low priority request occupies the whole KV cache
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out1 = scheduler.schedule(requests);
+        EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size());
+        for (auto seq: requests) {
+            seq->finish_iteration();
+        }
+
+        // high priority request arrives later, but is moved in front of the queue and takes KV blocks from low priority request
+        SequenceGroup::Ptr high_priority_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                                   high_priority_config, 4);
+        auto high_priority_seq_id = (*high_priority_group)[0]->get_id();
+        requests.push_back(high_priority_group);
+
+        auto out2 = scheduler.schedule(requests);
+        EXPECT_EQ(requests[0], high_priority_group);
+        EXPECT_EQ(requests[1], low_priority_group);
+
+        std::vector<uint64_t> ref_ids = {0};
+        EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
+        EXPECT_EQ(out2.m_total_num_scheduled_tokens, tokens.size());
+        EXPECT_EQ(out2.m_block_tables[high_priority_seq_id][0].size(), 2);
+        EXPECT_FALSE(scheduler.has_block_table(low_priority_seq_id));
+        EXPECT_EQ(low_priority_group->get_num_processed_tokens(), 0);
+
+        for (auto& req : requests) {
+            for (auto& seq : req->get_sequences()) {
+                if (scheduler.has_block_table(seq->get_id())) {
+                    scheduler.free_sequence(seq->get_id());
+                }
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, test_equal_priority_keeps_arrival_order) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<SequenceGroup::Ptr> requests;
+    for (uint64_t request_id = 0; request_id < 3; ++request_id) {
+        requests.push_back(std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                           ov::genai::greedy(), 4));
+    }
+    auto ref_requests = requests;
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out = scheduler.schedule(requests);
+    EXPECT_EQ(requests, ref_requests);
+
+    std::vector<uint64_t> ref_ids = {0, 1, 2};
+    EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+TEST(TestScheduler, test_adaptive_prefill_chunk_size) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 256;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.target_inter_token_latency_ms = 10.06f;
+    scheduler_config.min_prefill_chunk_size = 16;
+
+    std::vector<uint64_t> tokens(200);
+    std::iota(tokens.begin(), tokens.end(), 0);
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                         ov::genai::greedy(), 4);
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // no latency observations yet, whole batch can be used for prompt
+    std::vector<SequenceGroup::Ptr> requests1 = {sequence_group1};
+    auto out1 = scheduler.schedule(requests1);
+    EXPECT_EQ(out1.m_prefill_token_budget, scheduler_config.max_num_batched_tokens);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size());
+    scheduler.free_sequence((*sequence_group1)[0]->get_id());
+
+    // latency model: 2 ms + 0.125 ms per token, so 64 tokens fit into the target step latency
+    scheduler.register_step_latency(8, 3.0f);
+    scheduler.register_step_latency(64, 10.0f);
+
+    std::vector<SequenceGroup::Ptr> requests2 = {sequence_group2};
+    auto out2 = scheduler.schedule(requests2);
+    EXPECT_EQ(out2.m_prefill_token_budget, 64);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 64);
+    scheduler.free_sequence((*sequence_group2)[0]->get_id());
+}
+
+namespace {
+
+// emulates inference, which writes the same byte to a block of all layers
+void fill_cache_block(const std::shared_ptr<CacheManager>& cache_manager, size_t block_id, uint8_t value) {
+    for (size_t layer_id = 0; layer_id < cache_manager->get_num_decoder_layers(); ++layer_id) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(layer_id), cache_manager->get_value_cache(layer_id)}) {
+            const size_t block_byte_size = cache.get_byte_size() / cache.get_shape()[0];
+            std::memset(static_cast<uint8_t*>(cache.data()) + block_id * block_byte_size, value, block_byte_size);
+        }
+    }
+}
+
+bool is_cache_block_filled(const std::shared_ptr<CacheManager>& cache_manager, size_t block_id, uint8_t value) {
+    for (size_t layer_id = 0; layer_id < cache_manager->get_num_decoder_layers(); ++layer_id) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(layer_id), cache_manager->get_value_cache(layer_id)}) {
+            const size_t block_byte_size = cache.get_byte_size() / cache.get_shape()[0];
+            const uint8_t* data = static_cast<const uint8_t*>(cache.data()) + block_id * block_byte_size;
+            if (std::any_of(data, data + block_byte_size, [value](uint8_t byte) { return byte != value; })) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(TestScheduler, test_cold_blocks_stored_on_overwrite_and_restored) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 4;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    scheduler_config.cold_cache_size = 1;
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config);
+
+    auto schedule_prompt = [&](uint64_t request_id, std::vector<uint64_t> tokens, size_t expected_num_scheduled_tokens) {
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                            ov::genai::greedy(), 4);
+        scheduler.restore_cached_blocks(sequence_group);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, expected_num_scheduled_tokens);
+        return sequence_group;
+    };
+    auto finish = [&](const SequenceGroup::Ptr& sequence_group) {
+        sequence_group->finish_iteration();
+        auto sequence = (*sequence_group)[0];
+        sequence->set_status(SequenceStatus::FINISHED);
+        scheduler.free_sequence(sequence->get_id());
+    };
+
+    // values of 3 full blocks of the first prompt, constant blocks are restored from 8 bit cold tier exactly
+    const std::vector<uint8_t> block_values = {0x11, 0x22, 0x33};
+    std::vector<uint64_t> prompt = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    auto first_group = schedule_prompt(0, prompt, prompt.size());
+    const auto first_block_table = scheduler.get_block_tables(*(*first_group)[0])[0];
+    ASSERT_EQ(first_block_table.size(), block_values.size());
+    for (size_t i = 0; i < block_values.size(); ++i) {
+        fill_cache_block(cache_manager, first_block_table[i]->get_index(), block_values[i]);
+    }
+    finish(first_group);
+    EXPECT_EQ(scheduler.get_num_cold_blocks(), 0);
+
+    // distinct prompt reuses cached blocks of the first one, which are moved to cold tier before being overwritten
+    auto second_group = schedule_prompt(1, {100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115}, 16);
+    EXPECT_EQ(scheduler.get_num_cold_blocks(), block_values.size());
+    for (const auto& block : scheduler.get_block_tables(*(*second_group)[0])[0]) {
+        fill_cache_block(cache_manager, block->get_index(), 0x77);
+    }
+    finish(second_group);
+
+    // the first prompt continued by 2 tokens is restored from cold tier, so only new tokens are computed
+    prompt.insert(prompt.end(), {12, 13});
+    auto third_group = schedule_prompt(2, prompt, 2);
+    const auto third_block_table = scheduler.get_block_tables(*(*third_group)[0])[0];
+    ASSERT_EQ(third_block_table.size(), block_values.size() + 1);
+    for (size_t i = 0; i < block_values.size(); ++i) {
+        EXPECT_TRUE(is_cache_block_filled(cache_manager, third_block_table[i]->get_index(), block_values[i])) << "block " << i;
+    }
+    EXPECT_EQ(third_group->get_num_processed_tokens(), block_values.size() * 4);
+    finish(third_group);
+}
@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 
 #include "speculative_decoding/continuous_batching_for_speculative_decoding_impl.hpp"
+#include "speculative_decoding/adaptive_draft_length_controller.hpp"
 
 class CBForSDTest : public testing::Test, public ov::genai::ContinuousBatchingPipeline {
 protected:
@@ -426,3 +427,37 @@ TEST_F(CBForSDTest, add_tokens__two_sequence) {
     ASSERT_EQ(after.at(0).at(1).log_probs, log_probs);
 }
 
+TEST(AdaptiveDraftLengthControllerTest, follows_acceptance_rate) {
+    ov::genai::AdaptiveDraftLengthController controller(8);
+    // no statistics, max number of candidates
+    EXPECT_EQ(controller.get_num_assistant_tokens(0.1f), 8);
+
+    // all candidates are accepted
+    for (size_t i = 0; i < 10; ++i) {
+        controller.register_validation(8, 8);
+    }
+    EXPECT_FLOAT_EQ(controller.get_acceptance_probability(), 1.0f);
+    EXPECT_EQ(controller.get_num_assistant_tokens(0.1f), 8);
+
+    // the first candidate is rejected at each step
+    for (size_t i = 0; i < 50; ++i) {
+        controller.register_validation(8, 0);
+    }
+    EXPECT_LT(controller.get_acceptance_probability(), 0.01f);
+    EXPECT_EQ(controller.get_num_assistant_tokens(0.1f), 1);
+}
+
+TEST(AdaptiveDraftLengthControllerTest, accounts_for_draft_cost) {
+    ov::genai::AdaptiveDraftLengthController controller(16);
+    // 3 of 4 candidates accepted at each step
+    for (size_t i = 0; i < 20; ++i) {
+        controller.register_validation(4, 3);
+    }
+    EXPECT_NEAR(controller.get_acceptance_probability(), 0.75f, 1e-5f);
+
+    // more expensive draft steps lead to shorter candidates chains
+    size_t cheap_draft_num_tokens = controller.get_num_assistant_tokens(0.01f);
+    size_t expensive_draft_num_tokens = controller.get_num_assistant_tokens(0.5f);
+    EXPECT_GT(cheap_draft_num_tokens, expensive_draft_num_tokens);
+    EXPECT_GE(expensive_draft_num_tokens, 1);
+}
@@ -0,0 +1,309 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+
+#include "openvino/genai/rag/vector_index.hpp"
+#include "rag/distance.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+ov::Tensor get_normalized_vectors(size_t num_vectors, size_t dimension, uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::normal_distribution<float> distribution;
+    ov::Tensor vectors(ov::element::f32, {num_vectors, dimension});
+    float* data = vectors.data<float>();
+    for (size_t i = 0; i < num_vectors; ++i) {
+        float norm = 0.0f;
+        for (size_t j = 0; j < dimension; ++j) {
+            data[i * dimension + j] = distribution(engine);
+            norm += data[i * dimension + j] * data[i * dimension + j];
+        }
+        for (size_t j = 0; j < dimension; ++j) {
+            data[i * dimension + j] /= std::sqrt(norm);
+        }
+    }
+    return vectors;
+}
+
+std::vector<size_t> get_ids(size_t num_vectors) {
+    std::vector<size_t> ids(num_vectors);
+    // ids differ from positions of vectors
+    std::iota(ids.begin(), ids.end(), 1000);
+    return ids;
+}
+
+std::set<size_t> get_exact_nearest(const ov::Tensor& vectors, const std::vector<float>& query, size_t k) {
+    const size_t dimension = vectors.get_shape()[1];
+    std::vector<std::pair<float, size_t>> scores;
+    for (size_t i = 0; i < vectors.get_shape()[0]; ++i) {
+        scores.emplace_back(-distance::inner_product_f32(vectors.data<float>() + i * dimension, query.data(), dimension),
+                            1000 + i);
+    }
+    std::partial_sort(scores.begin(), scores.begin() + k, scores.end());
+    std::set<size_t> nearest;
+    for (size_t i = 0; i < k; ++i) {
+        nearest.insert(scores[i].second);
+    }
+    return nearest;
+}
+
+std::vector<float> get_row(const ov::Tensor& vectors, size_t row) {
+    const size_t dimension = vectors.get_shape()[1];
+    return std::vector<float>(vectors.data<float>() + row * dimension, vectors.data<float>() + (row + 1) * dimension);
+}
+
+std::vector<char> read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::filesystem::path& path, const std::vector<char>& content) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), content.size());
+}
+
+template <typename T>
+std::vector<char> patch(std::vector<char> content, size_t offset, T value) {
+    std::memcpy(content.data() + offset, &value, sizeof(T));
+    return content;
+}
+
+template <typename T>
+T read_at(const std::vector<char>& content, size_t offset) {
+    T value;
+    std::memcpy(&value, content.data() + offset, sizeof(T));
+    return value;
+}
+
+}  // namespace
+
+TEST(TestDistance, matches_naive_computation) {
+    std::vector<float> lhs(37), rhs(37);
+    std::iota(lhs.begin(), lhs.end(), -18.0f);
+    std::iota(rhs.begin(), rhs.end(), 3.0f);
+    float inner_product = 0.0f, l2_squared = 0.0f;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        inner_product += lhs[i] * rhs[i];
+        l2_squared += (lhs[i] - rhs[i]) * (lhs[i] - rhs[i]);
+    }
+    EXPECT_FLOAT_EQ(distance::inner_product_f32(lhs.data(), rhs.data(), lhs.size()), inner_product);
+    EXPECT_FLOAT_EQ(distance::l2_squared_f32(lhs.data(), rhs.data(), lhs.size()), l2_squared);
+
+    const std::vector<int8_t> lhs_i8{-127, 5, 127, 0}, rhs_i8{127, 5, 127, -3};
+    EXPECT_EQ(distance::inner_product_i8(lhs_i8.data(), rhs_i8.data(), 4), -127 * 127 + 25 + 127 * 127);
+    EXPECT_EQ(distance::l2_squared_i8(lhs_i8.data(), rhs_i8.data(), 4), 254 * 254 + 9);
+
+    const std::vector<uint8_t> lhs_bits{0xFF, 0x00, 0x0F, 0xAA, 0x01, 0x02, 0x04, 0x08, 0x10};
+    const std::vector<uint8_t> rhs_bits{0x00, 0x00, 0xFF, 0x55, 0x01, 0x02, 0x04, 0x08, 0x11};
+    EXPECT_EQ(distance::hamming(lhs_bits.data(), rhs_bits.data(), lhs_bits.size()), 8 + 0 + 4 + 8 + 1);
+}
+
+TEST(TestVectorIndex, finds_nearest_vectors) {
+    const size_t num_vectors = 2000, dimension = 32, k = 10;
+    const ov::Tensor vectors = get_normalized_vectors(num_vectors, dimension, 1);
+    VectorIndex::Config config;
+    config.ef_search = 128;
+    VectorIndex index(dimension, config);
+    index.add(get_ids(num_vectors), vectors);
+    EXPECT_EQ(index.size(), num_vectors);
+
+    const ov::Tensor queries = get_normalized_vectors(50, dimension, 2);
+    size_t num_found = 0;
+    for (size_t i = 0; i < 50; ++i) {
+        const std::vector<float> query = get_row(queries, i);
+        const auto exact_nearest = get_exact_nearest(vectors, query, k);
+        const auto results = index.search(EmbeddingResult{query}, k);
+        ASSERT_EQ(results.size(), k);
+        for (size_t j = 0; j < results.size(); ++j) {
+            num_found += exact_nearest.count(results[j].first);
+            if (j > 0) {
+                EXPECT_GE(results[j - 1].second, results[j].second);
+            }
+        }
+    }
+    // approximate search, but recall is high for small data
+    EXPECT_GE(num_found, 50 * k * 95 / 100);
+}
+
+TEST(TestVectorIndex, doesnt_return_removed_vectors) {
+    const size_t num_vectors = 500, dimension = 16;
+    const ov::Tensor vectors = get_normalized_vectors(num_vectors, dimension, 3);
+    const auto ids = get_ids(num_vectors);
+    VectorIndex index(dimension);
+    index.add(ids, vectors);
+
+    std::vector<size_t> removed_ids;
+    for (size_t i = 0; i < num_vectors; i += 2) {
+        removed_ids.push_back(ids[i]);
+    }
+    index.remove(removed_ids);
+    EXPECT_EQ(index.size(), num_vectors / 2);
+
+    for (size_t i = 0; i < 20; ++i) {
+        const auto results = index.search(EmbeddingResult{get_row(vectors, i)}, 5);
+        EXPECT_EQ(results.size(), 5);
+        for (const auto& [id, score] : results) {
+            EXPECT_EQ(id % 2, 1);
+        }
+        // vector itself is found if it's not removed
+        EXPECT_EQ(results[0].first == ids[i], i % 2 == 1);
+    }
+
+    EXPECT_THROW(index.remove({ids[0]}), ov::Exception);
+    EXPECT_THROW(index.add({ids[1]}, get_normalized_vectors(1, dimension, 4)), ov::Exception);
+}
+
+TEST(TestVectorIndex, rejects_duplicated_ids_in_batch) {
+    const size_t dimension = 8;
+    VectorIndex index(dimension);
+    index.add({1}, get_normalized_vectors(1, dimension, 7));
+
+    EXPECT_THROW(index.add({5, 5}, get_normalized_vectors(2, dimension, 8)), ov::Exception);
+    // the batch is rejected as a whole, even ids which are valid on their own are not added
+    EXPECT_THROW(index.add({2, 3, 2}, get_normalized_vectors(3, dimension, 9)), ov::Exception);
+    EXPECT_EQ(index.size(), 1);
+    index.add({2, 3, 5}, get_normalized_vectors(3, dimension, 10));
+    EXPECT_EQ(index.size(), 4);
+}
+
+TEST(TestVectorIndex, saves_and_loads_index) {
+    const size_t num_vectors = 300, dimension = 24;
+    const ov::Tensor vectors = get_normalized_vectors(num_vectors, dimension, 5);
+    const auto ids = get_ids(num_vectors);
+    VectorIndex index(dimension);
+    index.add(ids, vectors);
+    index.remove({ids[7]});
+
+    const auto path = std::filesystem::temp_directory_path() / "test_vector_index.bin";
+    index.save(path);
+    {
+        VectorIndex loaded(path);
+        EXPECT_EQ(loaded.size(), index.size());
+        EXPECT_EQ(loaded.get_dimension(), dimension);
+        for (size_t i = 0; i < 20; ++i) {
+            const EmbeddingResult query{get_row(vectors, i)};
+            EXPECT_EQ(loaded.search(query, 10), index.search(query, 10));
+        }
+
+        // vectors added after load are kept in memory next to mapped ones
+        const ov::Tensor new_vectors = get_normalized_vectors(10, dimension, 6);
+        std::vector<size_t> new_ids(10);
+        std::iota(new_ids.begin(), new_ids.end(), 0);
+        loaded.add(new_ids, new_vectors);
+        EXPECT_EQ(loaded.search(EmbeddingResult{get_row(new_vectors, 3)}, 1)[0].first, 3);
+        EXPECT_EQ(loaded.search(EmbeddingResult{get_row(vectors, 3)}, 1)[0].first, ids[3]);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(TestVectorIndex, saves_to_loaded_file) {
+    const size_t num_vectors = 100, dimension = 16;
+    const ov::Tensor vectors = get_normalized_vectors(num_vectors, dimension, 11);
+    const auto ids = get_ids(num_vectors);
+    const auto path = std::filesystem::temp_directory_path() / "test_resaved_vector_index.bin";
+    {
+        VectorIndex index(dimension);
+        index.add(ids, vectors);
+        index.save(path);
+    }
+    {
+        VectorIndex loaded(path);
+        loaded.add({0}, get_normalized_vectors(1, dimension, 12));
+        loaded.save(path);
+        // mapped vectors are still available after the file is replaced
+        EXPECT_EQ(loaded.search(EmbeddingResult{get_row(vectors, 5)}, 1)[0].first, ids[5]);
+        loaded.save(path);
+    }
+    VectorIndex reloaded(path);
+    EXPECT_EQ(reloaded.size(), num_vectors + 1);
+    EXPECT_EQ(reloaded.search(EmbeddingResult{get_row(vectors, 5)}, 1)[0].first, ids[5]);
+    std::filesystem::remove(path);
+}
+
+TEST(TestVectorIndex, searches_binary_vectors) {
+    const size_t num_vectors = 200, dimension = 16;
+    std::mt19937 engine(7);
+    ov::Tensor vectors(ov::element::u8, {num_vectors, dimension});
+    std::generate_n(vectors.data<uint8_t>(), vectors.get_size(), [&engine]() {
+        return static_cast<uint8_t>(engine());
+    });
+
+    VectorIndex::Config config;
+    config.element_type = ov::element::u8;
+    config.metric = VectorIndex::Metric::HAMMING;
+    VectorIndex index(dimension, config);
+    index.add(get_ids(num_vectors), vectors);
+
+    ov::Tensor query(ov::element::u8, {1, dimension});
+    std::copy_n(vectors.data<uint8_t>() + 42 * dimension, dimension, query.data<uint8_t>());
+    // flip one bit
+    query.data<uint8_t>()[0] ^= 1;
+    const auto results = index.search(query, 1);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0].first, 1042);
+    EXPECT_EQ(results[0].second, -1.0f);
+}
+
+TEST(TestVectorIndex, validates_config) {
+    VectorIndex::Config config;
+    config.metric = VectorIndex::Metric::HAMMING;
+    EXPECT_THROW(config.validate(), ov::Exception);
+
+    config.element_type = ov::element::u8;
+    EXPECT_NO_THROW(config.validate());
+
+    config.element_type = ov::element::f16;
+    EXPECT_THROW(VectorIndex(8, config), ov::Exception);
+
+    VectorIndex index(8);
+    EXPECT_THROW(index.add({0}, ov::Tensor(ov::element::i8, {1, 8})), ov::Exception);
+    EXPECT_THROW(index.add({0, 1}, ov::Tensor(ov::element::f32, {1, 8})), ov::Exception);
+    EXPECT_TRUE(index.search(EmbeddingResult{std::vector<float>(8, 0.0f)}, 3).empty());
+}
+
+TEST(TestVectorIndex, rejects_corrupted_file) {
+    const size_t num_vectors = 100, dimension = 8;
+    VectorIndex index(dimension);
+    index.add(get_ids(num_vectors), get_normalized_vectors(num_vectors, dimension, 8));
+
+    const auto path = std::filesystem::temp_directory_path() / "test_corrupted_vector_index.bin";
+    index.save(path);
+    const auto content = read_file(path);
+    EXPECT_NO_THROW(VectorIndex{path});
+
+    // offsets of header fields
+    const size_t metric = 16, max_level = 20, dimension_offset = 24, num_nodes = 56, entry_point = 64, graph_offset = 80;
+    const size_t first_link = read_at<uint64_t>(content, graph_offset) + sizeof(uint64_t) + sizeof(uint8_t) + 2 * sizeof(uint32_t);
+    ASSERT_GT(read_at<uint32_t>(content, first_link - sizeof(uint32_t)), 0);
+
+    const std::vector<std::vector<char>> corrupted_files = {
+        std::vector<char>(content.begin(), content.end() - 1),
+        patch<uint32_t>(content, metric, 3),
+        patch<uint64_t>(content, dimension_offset, uint64_t{1} << 62),
+        patch<uint64_t>(content, num_nodes, uint64_t{1} << 40),
+        patch<uint64_t>(content, num_nodes, num_vectors + 1),
+        patch<uint64_t>(content, entry_point, num_vectors),
+        patch<int32_t>(content, max_level, -1),
+        patch<int32_t>(content, max_level, read_at<int32_t>(content, max_level) + 1),
+        patch<uint32_t>(content, first_link, num_vectors),
+    };
+    for (const auto& corrupted_file : corrupted_files) {
+        write_file(path, corrupted_file);
+        EXPECT_THROW(VectorIndex{path}, ov::Exception);
+    }
+    std::filesystem::remove(path);
+}
@@ -2,14 +2,17 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import os
+import json
 import pytest
 import math
 import sys
+import threading
+import time
 
 from pathlib import Path
 from shutil import rmtree
 
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, draft_model, GenerationFinishReason
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig, StructuredOutputConfig, draft_model, GenerationFinishReason
 
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
 
@@ -451,6 +454,106 @@ def test_dynamic_split_fuse_doesnt_affect_generated_text(pipeline_type):
     assert generated == reference
 
 
+@pytest.mark.parametrize("arrive_together", [True, False], ids=["arrive_together", "arrive_apart"])
+@pytest.mark.precommit
+def test_prompt_deduplication_doesnt_affect_generated_text(arrive_together):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id)
+
+    # prompt spans several KV cache blocks, so its prefix is shared between requests
+    prompt = "OpenVINO is an open-source toolkit for optimizing and deploying deep learning models. " * 6
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=20, ignore_eos=True)
+
+    def generate(enable_prompt_deduplication: bool):
+        scheduler_config = dict_to_scheduler_config({"enable_prompt_deduplication": enable_prompt_deduplication})
+        cb_pipe = ContinuousBatchingPipeline(models_path, scheduler_config, "CPU")
+        handles = [cb_pipe.add_request(0, prompt, generation_config)]
+        if not arrive_together:
+            # the first request has computed its prompt and generates tokens when others arrive
+            for _ in range(3):
+                cb_pipe.step()
+        handles += [cb_pipe.add_request(request_id, prompt, generation_config) for request_id in (1, 2)]
+        while cb_pipe.has_non_finished_requests():
+            cb_pipe.step()
+        return [handle.read_all()[0].generated_ids for handle in handles]
+
+    reference = generate(enable_prompt_deduplication=False)
+    generated = generate(enable_prompt_deduplication=True)
+    assert generated == reference
+    assert generated[0] == generated[1] == generated[2]
+
+@pytest.mark.precommit
+def test_structured_output_requests_added_during_step():
+    model_id : str = "katuni4ka/tiny-random-phi3"
+    _, _, models_path = download_and_convert_model(model_id)
+
+    prompts = ["Generate a json about a person.", "Generate a date", "Generate a json about a REST API response.", "What is OpenVINO?"]
+    structured_output_configs = [
+        StructuredOutputConfig(regex=r'\{"city":"(Dublin|Dubai|Munich)"\}'),
+        StructuredOutputConfig(regex=r'[0-9]{4}-[0-9]{2}-[0-9]{2}'),
+        StructuredOutputConfig(json_schema=json.dumps({"type": "object", "properties": {"status": {"enum": ["success", "error"]}}, "required": ["status"]})),
+        None,
+    ]
+    generation_configs = []
+    for structured_output_config in structured_output_configs:
+        generation_config = GenerationConfig(do_sample=False, max_new_tokens=30)
+        if structured_output_config is not None:
+            generation_config.structured_output_config = structured_output_config
+        generation_configs.append(generation_config)
+
+    cb_pipe = ContinuousBatchingPipeline(models_path, dict_to_scheduler_config(), "CPU")
+
+    # serial path: each request is generated alone
+    reference = []
+    for request_id, (prompt, generation_config) in enumerate(zip(prompts, generation_configs)):
+        handle = cb_pipe.add_request(request_id, prompt, generation_config)
+        while cb_pipe.has_non_finished_requests():
+            cb_pipe.step()
+        reference.append(handle.read_all()[0].generated_ids)
+
+    # requests are added from another thread, so they arrive while previous requests are scheduled or inferred
+    # and are pulled from the awaiting queue in overlap with inference
+    handles = {}
+    def add_requests():
+        for request_id in range(1, len(prompts)):
+            time.sleep(0.02)
+            handles[request_id] = cb_pipe.add_request(request_id, prompts[request_id], generation_configs[request_id])
+
+    handles[0] = cb_pipe.add_request(0, prompts[0], generation_configs[0])
+    producer = threading.Thread(target=add_requests)
+    producer.start()
+    while producer.is_alive() or cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+    producer.join()
+
+    generated = [handles[request_id].read_all()[0].generated_ids for request_id in range(len(prompts))]
+    assert generated == reference
+
+
+@pytest.mark.precommit
+def test_data_parallel_replicas_with_structured_output_and_stop_strings():
+    model_id : str = "katuni4ka/tiny-random-phi3"
+    _, _, models_path = download_and_convert_model(model_id)
+
+    prompts = ["Generate a json about a person.", "Generate a date", "What is OpenVINO?", "Why is the Sun yellow?"] * 2
+    single_pipe = ContinuousBatchingPipeline(models_path, dict_to_scheduler_config(), "CPU")
+
+    # stop strings are taken from texts generated without them, so they are matched by the replicas
+    generation_configs = [GenerationConfig(do_sample=False, max_new_tokens=30) for _ in prompts]
+    texts = [result.m_generation_ids[0] for result in single_pipe.generate(prompts, generation_configs)]
+    for request_id, generation_config in enumerate(generation_configs):
+        if request_id % 2 == 0:
+            generation_config.structured_output_config = StructuredOutputConfig(regex=r'[0-9]{4}-[0-9]{2}-[0-9]{2}')
+        if request_id % 4 != 0 and len(texts[request_id]) > 10:
+            generation_config.stop_strings = {texts[request_id][6:10]}
+
+    reference = single_pipe.generate(prompts, generation_configs)
+    # replicas share the tokenizer, its structured output controller and detokenized vocabulary used for stop strings
+    dp_pipe = ContinuousBatchingPipeline(models_path, dict_to_scheduler_config(), "CPU", {"data_parallel_replicas": 2})
+    generated = dp_pipe.generate(prompts, generation_configs)
+    assert [result.m_generation_ids for result in generated] == [result.m_generation_ids for result in reference]
+
+
 def get_data_by_pipeline_type(model_path: Path, pipeline_type: str, generation_config: GenerationConfig):
     device = "CPU"
     prompt = "Prompt example is"
@@ -136,3 +136,39 @@ def test_full_gguf_qwen3_pipeline(pipeline_type, model_ids):
     res_string_input_2 = ov_pipe_gguf.generate(prompt, generation_config=ov_generation_config)
 
     assert res_string_input_1 == res_string_input_2
+
+
+@pytest.mark.parametrize("model_ids", get_gguf_model_list())
+@pytest.mark.precommit
+def test_gguf_cache_dir(model_ids, tmp_path):
+    if sys.platform == 'darwin':
+        pytest.skip(reason="168882: Sporadic segmentation fault failure on MacOS.")
+    gguf_model_id = model_ids["gguf_model_id"]
+    gguf_filename = model_ids["gguf_filename"]
+    prompt = 'Why is the Sun yellow?'
+
+    ov_generation_config = ov_genai.GenerationConfig()
+    ov_generation_config.max_new_tokens = 30
+    ov_generation_config.apply_chat_template = False
+
+    gguf_full_path = download_gguf_model(gguf_model_id, gguf_filename)
+    cache_dir = tmp_path / "gguf_cache"
+
+    # the first pipeline converts the model and saves it to the cache
+    ov_pipe_converted = ov_genai.LLMPipeline(gguf_full_path, "CPU", gguf_cache_dir=str(cache_dir))
+    res_string_converted = ov_pipe_converted.generate(prompt, generation_config=ov_generation_config)
+    del ov_pipe_converted
+    gc.collect()
+
+    cached_models = list(cache_dir.glob("*/openvino_model.xml"))
+    assert len(cached_models) == 1
+    assert cached_models[0].with_suffix(".bin").exists()
+
+    # the next pipeline reads the cached model
+    ov_pipe_cached = ov_genai.LLMPipeline(gguf_full_path, "CPU", gguf_cache_dir=str(cache_dir))
+    res_string_cached = ov_pipe_cached.generate(prompt, generation_config=ov_generation_config)
+    del ov_pipe_cached
+    gc.collect()
+
+    assert list(cache_dir.glob("*/openvino_model.xml")) == cached_models
+    assert res_string_converted == res_string_cached
@@ -2,15 +2,17 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import numpy as np
+import torch
 import pytest
 import gc
 from pathlib import Path
-from openvino_genai import TextEmbeddingPipeline, TextRerankPipeline
-from utils.hugging_face import download_and_convert_embeddings_models, download_and_convert_rerank_model
+from openvino_genai import TextEmbeddingPipeline, TextRerankPipeline, VectorIndex, Retriever
+from utils.hugging_face import download_and_convert_embeddings_models, download_and_convert_rerank_model, download_and_convert_model
 from langchain_core.documents.base import Document
 from langchain_community.embeddings import OpenVINOBgeEmbeddings
 from langchain_community.document_compressors.openvino_rerank import OpenVINOReranker
 from typing import Literal, Union
+from concurrent.futures import ThreadPoolExecutor
 import sys
 import platform
 
@@ -24,6 +26,18 @@ RERANK_TEST_MODELS = [
     # "answerdotai/ModernBERT-base",  # 2 classes output, softmax applied. Skip until langchain OpenVINORerank supports it.
 ]
 
+# *ForCausalLM models scored by the probability of "yes" answer like Qwen3-Reranker
+DECODER_RERANK_TEST_MODELS = [
+    "fxmarty/tiny-dummy-qwen2",
+]
+
+DECODER_PROMPT_PREFIX = (
+    "<|im_start|>system\nJudge whether the Document meets the requirements based on the Query and the Instruct "
+    'provided. Note that the answer can only be "yes" or "no".<|im_end|>\n<|im_start|>user\n'
+)
+DECODER_PROMPT_SUFFIX = "<|im_end|>\n<|im_start|>assistant\n<think>\n\n</think>\n\n"
+DEFAULT_DECODER_INSTRUCTION = "Given a web search query, retrieve relevant passages that answer the query"
+
 TEXT_DATASET = f"The commercial PC market is propelled by premium\
 computing solutions that drive user productivity and help\
 service organizations protect and maintain devices.\
@@ -201,6 +215,25 @@ def run_text_rerank_genai(
     return async_result
 
 
+def run_decoder_rerank_ref(opt_model, hf_tokenizer, query: str, documents: list[str]):
+    """
+    Scores each document by a separate inference of the whole prompt, without the shared prefix KV cache and padding.
+    """
+    prefix = f"{DECODER_PROMPT_PREFIX}<Instruct>: {DEFAULT_DECODER_INSTRUCTION}\n<Query>: {query}\n<Document>: "
+    prefix_ids = hf_tokenizer(prefix, add_special_tokens=False).input_ids
+    suffix_ids = hf_tokenizer(DECODER_PROMPT_SUFFIX, add_special_tokens=False).input_ids
+    yes_id = hf_tokenizer.convert_tokens_to_ids("yes")
+    no_id = hf_tokenizer.convert_tokens_to_ids("no")
+
+    scores = []
+    for document in documents:
+        input_ids = prefix_ids + hf_tokenizer(document, add_special_tokens=False).input_ids + suffix_ids
+        logits = opt_model(input_ids=torch.tensor([input_ids]), attention_mask=torch.ones(1, len(input_ids), dtype=torch.int64)).logits
+        yes_no_logits = logits[0, -1, [no_id, yes_id]].float()
+        scores.append(float(torch.softmax(yes_no_logits, dim=0)[1]))
+    return scores
+
+
 def run_text_rerank_pipeline_with_ref(
     models_path: Path,
     query: str,
@@ -330,6 +363,137 @@ def test_fixed_shapes_configs(download_and_convert_embeddings_models, dataset_do
     validate_embedding_results(refs_to_validate, result)
 
 
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextEmbeddingPipeline.Config(max_batch_tokens=1),
+        TextEmbeddingPipeline.Config(max_batch_tokens=128),
+        TextEmbeddingPipeline.Config(max_batch_tokens=128, pooling_type=TextEmbeddingPipeline.PoolingType.MEAN),
+        TextEmbeddingPipeline.Config(max_batch_tokens=128, max_length=50, pad_to_max_length=True),
+    ],
+)
+@pytest.mark.precommit
+def test_micro_batches(download_and_convert_embeddings_models, dataset_documents, config):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    # documents of different lengths end up in different micro-batches
+    docs_to_embed = [document[: 10 + (i * 37) % len(document)] for i, document in enumerate(dataset_documents)]
+    result = run_text_embedding_genai(models_path, docs_to_embed, config, "embed_documents")
+
+    ref_config = TextEmbeddingPipeline.Config(pooling_type=config.pooling_type)
+    ref_config.max_length = config.max_length
+    ref_config.pad_to_max_length = config.pad_to_max_length
+    refs = run_text_embedding_genai(models_path, docs_to_embed, ref_config, "embed_documents")
+    validate_embedding_results(refs, result)
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextEmbeddingPipeline.Config(),
+        TextEmbeddingPipeline.Config(max_batch_tokens=128),
+    ],
+)
+@pytest.mark.precommit
+def test_concurrent_embed(download_and_convert_embeddings_models, dataset_documents, config):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config, PERFORMANCE_HINT="THROUGHPUT")
+    chunks = [dataset_documents[i : i + 3] for i in range(0, len(dataset_documents), 3)]
+    refs = [pipeline.embed_documents(chunk) for chunk in chunks]
+
+    # the pipeline is shared by threads
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(pipeline.embed_documents, chunks))
+        query_results = list(executor.map(pipeline.embed_query, dataset_documents[:4]))
+
+    for ref, result in zip(refs, results):
+        validate_embedding_results(ref, result)
+    for document, result in zip(dataset_documents[:4], query_results):
+        validate_embedding_results(pipeline.embed_query(document), result)
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.precommit
+def test_embedding_cache(download_and_convert_embeddings_models, dataset_documents, tmp_path):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    refs = run_text_embedding_genai(models_path, dataset_documents, TextEmbeddingPipeline.Config(), "embed_documents")
+    cache_path = str(tmp_path / "embedding_cache.bin")
+    config = TextEmbeddingPipeline.Config(max_cache_bytes=1 << 20, cache_path=cache_path)
+
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config)
+    validate_embedding_results(refs[:5], pipeline.embed_documents(dataset_documents[:5]))
+    # first five documents are cached
+    validate_embedding_results(refs, pipeline.embed_documents(dataset_documents))
+    validate_embedding_results(refs[0], pipeline.embed_query(dataset_documents[0]))
+    metrics = pipeline.get_cache_metrics()
+    assert metrics.num_hits == 6
+    assert metrics.num_misses == len(dataset_documents)
+    assert metrics.num_entries == len(set(dataset_documents))
+    pipeline.save_cache()
+
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config)
+    validate_embedding_results(refs, pipeline.embed_documents(dataset_documents))
+    assert pipeline.get_cache_metrics().get_hit_ratio() == 1.0
+
+    # cache of another configuration isn't used
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", TextEmbeddingPipeline.Config(max_cache_bytes=1 << 20, cache_path=cache_path, normalize=False))
+    pipeline.embed_documents(dataset_documents[:1])
+    assert pipeline.get_cache_metrics().num_hits == 0
+
+    with pytest.raises(RuntimeError):
+        TextEmbeddingPipeline.Config(max_cache_bytes=1024, batch_size=2).validate()
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextEmbeddingPipeline.Config(),
+        TextEmbeddingPipeline.Config(quantization_type=TextEmbeddingPipeline.QuantizationType.INT8),
+        TextEmbeddingPipeline.Config(quantization_type=TextEmbeddingPipeline.QuantizationType.BINARY, max_batch_tokens=128),
+    ],
+)
+@pytest.mark.precommit
+def test_embed_documents_tensor(download_and_convert_embeddings_models, dataset_documents, config):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", config)
+    tensor = pipeline.embed_documents_tensor(dataset_documents)
+    result = pipeline.embed_documents(dataset_documents)
+
+    assert list(tensor.shape) == [len(dataset_documents), len(result[0])]
+    assert np.array_equal(tensor.data, np.array(result, dtype=tensor.data.dtype))
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "quantization_type",
+    [TextEmbeddingPipeline.QuantizationType.INT8, TextEmbeddingPipeline.QuantizationType.BINARY],
+)
+@pytest.mark.precommit
+def test_quantized_embeddings(download_and_convert_embeddings_models, dataset_documents, quantization_type):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    refs = np.array(run_text_embedding_genai(models_path, dataset_documents, TextEmbeddingPipeline.Config()))
+    config = TextEmbeddingPipeline.Config(quantization_type=quantization_type)
+    result = np.array(run_text_embedding_genai(models_path, dataset_documents, config))
+
+    if quantization_type == TextEmbeddingPipeline.QuantizationType.INT8:
+        assert result.min() >= -127 and result.max() <= 127
+        expected = np.clip(np.round(refs * 127), -127, 127)
+        assert np.abs(result.astype(np.int32) - expected).max() <= 1
+    else:
+        assert result.shape == (refs.shape[0], refs.shape[1] // 8)
+        bits = np.unpackbits(result.astype(np.uint8), axis=1).astype(bool)
+        # values close to zero may have any sign after inference on different shapes
+        significant = np.abs(refs) > MAX_EMBEDDING_ERROR
+        assert np.array_equal(bits[significant], (refs > 0)[significant])
+
+
 @pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
 @pytest.mark.parametrize(
     "config",
@@ -423,3 +587,122 @@ def test_rerank_constructors(download_and_convert_rerank_model):
 def test_rerank_documents(download_and_convert_rerank_model, dataset_documents, query, config):
     _, _, models_path = download_and_convert_rerank_model
     run_text_rerank_pipeline_with_ref(models_path, query, dataset_documents, config)
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", RERANK_TEST_MODELS, indirect=True)
+@pytest.mark.parametrize("query", ["What are the main features of Intel Core Ultra processors?"])
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextRerankPipeline.Config(max_batch_tokens=1),
+        TextRerankPipeline.Config(max_batch_tokens=256, top_n=10),
+    ],
+)
+@pytest.mark.precommit
+def test_rerank_micro_batches(download_and_convert_rerank_model, dataset_documents, query, config):
+    _, _, models_path = download_and_convert_rerank_model
+
+    # documents of different lengths end up in different micro-batches
+    docs_to_rerank = [document[: 10 + (i * 37) % len(document)] for i, document in enumerate(dataset_documents)]
+    result = run_text_rerank_genai(models_path, query, docs_to_rerank, config)
+    refs = run_text_rerank_genai(models_path, query, docs_to_rerank, TextRerankPipeline.Config(top_n=config.top_n))
+
+    assert [idx for idx, _ in result] == [idx for idx, _ in refs]
+    assert np.allclose([score for _, score in result], [score for _, score in refs], atol=1e-5)
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", [RERANK_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize("query", ["What are the main features of Intel Core Ultra processors?"])
+@pytest.mark.precommit
+def test_rerank_early_stop(download_and_convert_rerank_model, dataset_documents, query):
+    _, _, models_path = download_and_convert_rerank_model
+
+    refs = run_text_rerank_genai(models_path, query, dataset_documents, TextRerankPipeline.Config(top_n=len(dataset_documents)))
+    scores = dict(refs)
+    # every document reaches the lowest score, scores of single text batches may differ from the reference ones slightly
+    config = TextRerankPipeline.Config(top_n=2, max_batch_tokens=1, early_stop_score=refs[-1][1] - 1e-3)
+    result = TextRerankPipeline(models_path, "CPU", config, PERFORMANCE_HINT="LATENCY", PERFORMANCE_HINT_NUM_REQUESTS=1).rerank(query, dataset_documents)
+
+    # documents are scored one by one in the given order, so only the first two are scored
+    expected = sorted([0, 1], key=lambda idx: scores[idx], reverse=True)
+    assert [idx for idx, _ in result] == expected
+
+    with pytest.raises(RuntimeError):
+        TextRerankPipeline.Config(early_stop_score=0.5).validate()
+
+
+@pytest.mark.parametrize("model_id", DECODER_RERANK_TEST_MODELS)
+@pytest.mark.parametrize("query", ["What are the main features of Intel Core Ultra processors?"])
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextRerankPipeline.Config(top_n=100),
+        TextRerankPipeline.Config(top_n=100, max_batch_tokens=256),
+    ],
+    ids=[
+        "single_batch",
+        "micro_batches",
+    ],
+)
+@pytest.mark.precommit
+def test_decoder_rerank(model_id, dataset_documents, query, config):
+    opt_model, hf_tokenizer, models_path = download_and_convert_model(model_id)
+
+    # documents of different lengths are left padded in a batch
+    docs_to_rerank = [document[: 10 + (i * 37) % len(document)] for i, document in enumerate(dataset_documents)]
+    result = run_text_rerank_genai(models_path, query, docs_to_rerank, config)
+    ref_scores = run_decoder_rerank_ref(opt_model, hf_tokenizer, query, docs_to_rerank)
+
+    assert sorted(idx for idx, _ in result) == list(range(len(docs_to_rerank)))
+    for idx, score in result:
+        assert abs(score - ref_scores[idx]) < 1e-4, f"Scores do not match for document ID {idx}: {score} != {ref_scores[idx]}"
+
+
+@pytest.mark.parametrize("download_and_convert_rerank_model", [RERANK_TEST_MODELS[0]], indirect=True)
+@pytest.mark.parametrize("query", ["What are the main features of Intel Core Ultra processors?"])
+@pytest.mark.precommit
+def test_concurrent_rerank(download_and_convert_rerank_model, dataset_documents, query):
+    _, _, models_path = download_and_convert_rerank_model
+
+    reranker = TextRerankPipeline(models_path, "CPU", PERFORMANCE_HINT="THROUGHPUT")
+    chunks = [dataset_documents[i : i + 5] for i in range(0, len(dataset_documents), 5)]
+    refs = [reranker.rerank(query, chunk) for chunk in chunks]
+
+    # the pipeline is shared by threads
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(lambda chunk: reranker.rerank(query, chunk), chunks))
+
+    for ref, result in zip(refs, results):
+        assert_rerank_results(ref, result)
+
+
+@pytest.mark.parametrize("download_and_convert_embeddings_models", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.precommit
+def test_retriever(download_and_convert_embeddings_models, dataset_documents, tmp_path):
+    _, _, models_path = download_and_convert_embeddings_models
+
+    pipeline = TextEmbeddingPipeline(models_path, "CPU", TextEmbeddingPipeline.Config(normalize=True))
+    query_embedding = pipeline.embed_query(dataset_documents[3])
+    index = VectorIndex(len(query_embedding))
+    config = Retriever.Config()
+    config.top_k = 5
+    retriever = Retriever(pipeline, index, config)
+
+    ids = retriever.add_documents(dataset_documents)
+    assert ids == list(range(len(dataset_documents)))
+    assert index.size() == len(dataset_documents)
+
+    # a document is the most similar to itself
+    results = retriever.retrieve(dataset_documents[3])
+    assert len(results.documents) == 5
+    assert results.documents[0].id == 3
+    assert results.documents[0].text == dataset_documents[3]
+    assert results.metrics.embedding_duration > 0
+
+    retriever.remove_documents([3])
+    assert all(document.id != 3 for document in retriever.retrieve(dataset_documents[3]).documents)
+
+    index.save(tmp_path / "index.bin")
+    loaded = VectorIndex(tmp_path / "index.bin")
+    assert loaded.size() == index.size()
+    assert loaded.search(query_embedding, 5) == index.search(query_embedding, 5)
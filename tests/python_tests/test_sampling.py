@@ -42,7 +42,10 @@ def test_basic_stop_criteria(generation_config, prompt):
                           (dict(max_new_tokens=30, stop_strings={ "machines" }, include_stop_str_in_output=True), 'facebook/opt-125m'),
                           (dict(max_new_tokens=30, stop_strings={ "machines", "manage" }, include_stop_str_in_output=False), 'facebook/opt-125m'),
                           (dict(max_new_tokens=30, stop_strings={ "machines", "manage" }, include_stop_str_in_output=True), 'facebook/opt-125m'),
-                          (dict(max_new_tokens=30, stop_strings={ "software toolkit developed 1 by", "Intel" }, include_stop_str_in_output=False), 'TinyLlama/TinyLlama-1.1B-Chat-v1.0')],
+                          (dict(max_new_tokens=30, stop_strings={ "software toolkit developed 1 by", "Intel" }, include_stop_str_in_output=False), 'TinyLlama/TinyLlama-1.1B-Chat-v1.0'),
+                          # Metaspace tokenizer, spaces in stop strings are "▁" in the vocabulary
+                          (dict(max_new_tokens=30, stop_strings={ "is an", "is a" }, include_stop_str_in_output=False), 'TinyLlama/TinyLlama-1.1B-Chat-v1.0'),
+                          (dict(max_new_tokens=30, stop_strings={ "is an", "is a" }, include_stop_str_in_output=True), 'TinyLlama/TinyLlama-1.1B-Chat-v1.0')],
                          ids=["single_stop_string",
                               "multiple_stop_strings_match",
                               "multiple_stop_strings_no_match",
@@ -50,7 +53,9 @@ def test_basic_stop_criteria(generation_config, prompt):
                               "single_stop_string_include_to_output",
                               "multiple_stop_strings_exclude_from_output",
                               "multiple_stop_strings_include_to_output",
-                              "multiple_stop_strings_one_no_match_and_long_exclude_from_output"])
+                              "multiple_stop_strings_one_no_match_and_long_exclude_from_output",
+                              "multi_word_stop_strings_metaspace_exclude_from_output",
+                              "multi_word_stop_strings_metaspace_include_to_output"])
 @pytest.mark.parametrize("pipeline_type", get_main_pipeline_types())
 def test_stop_strings(generation_config, model_id, pipeline_type):
     prompts = [ "What is OpenVINO?" ]
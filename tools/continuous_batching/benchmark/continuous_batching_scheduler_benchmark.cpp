@@ -0,0 +1,427 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures CPU cost of scheduling in continuous batching without running a model: requests of a synthetic or recorded
+// trace are replayed through Scheduler, BlockManager and cache eviction code, tokens are "generated" right after
+// scheduling. CacheManager is created over a stub model with the smallest KV cache inputs, so KV cache blocks
+// cost almost no memory and no inference is done.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <cxxopts.hpp>
+
+#include "openvino/op/concat.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/genai/cache_eviction.hpp"
+#include "openvino/genai/scheduler_config.hpp"
+#include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/scheduler.hpp"
+#include "sequence_group.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct TraceRequest {
+    size_t arrival_step = 0;
+    size_t prompt_len = 0;
+    size_t output_len = 0;
+    // requests with the same prefix ID start with the same prefix_len tokens
+    size_t prefix_id = 0;
+    size_t prefix_len = 0;
+};
+
+std::vector<TraceRequest> read_trace(const std::string& trace_path) {
+    std::ifstream trace_file(trace_path);
+    OPENVINO_ASSERT(trace_file.is_open(), "Cannot open trace file ", trace_path);
+    nlohmann::json json_trace = nlohmann::json::parse(trace_file);
+
+    std::vector<TraceRequest> trace;
+    for (const auto& json_request : json_trace) {
+        TraceRequest request;
+        request.arrival_step = json_request.value("arrival_step", size_t{0});
+        request.prompt_len = json_request.at("prompt_len").get<size_t>();
+        request.output_len = json_request.at("output_len").get<size_t>();
+        OPENVINO_ASSERT(request.prompt_len > 0, "Trace request ", trace.size(), " has empty prompt");
+        request.prefix_id = json_request.value("prefix_id", size_t{0});
+        request.prefix_len = std::min(json_request.value("prefix_len", size_t{0}), request.prompt_len);
+        trace.push_back(request);
+    }
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceRequest& lhs, const TraceRequest& rhs) {
+        return lhs.arrival_step < rhs.arrival_step;
+    });
+    return trace;
+}
+
+void write_trace(const std::string& trace_path, const std::vector<TraceRequest>& trace) {
+    nlohmann::json json_trace = nlohmann::json::array();
+    for (const auto& request : trace) {
+        json_trace.push_back({{"arrival_step", request.arrival_step}, {"prompt_len", request.prompt_len}, {"output_len", request.output_len},
+                              {"prefix_id", request.prefix_id}, {"prefix_len", request.prefix_len}});
+    }
+    std::ofstream trace_file(trace_path);
+    OPENVINO_ASSERT(trace_file.is_open(), "Cannot open trace file ", trace_path);
+    trace_file << json_trace.dump(2) << std::endl;
+}
+
+// request_rate is a mean number of arriving requests per step, arrivals follow Poisson process; all requests arrive at step 0 if it is not positive
+std::vector<TraceRequest> generate_trace(size_t num_requests, double request_rate, size_t min_prompt_len, size_t max_prompt_len,
+                                         size_t min_output_len, size_t max_output_len, size_t num_prefixes, size_t prefix_len, std::mt19937& rng) {
+    std::uniform_int_distribution<size_t> prompt_len_distribution(min_prompt_len, max_prompt_len);
+    std::uniform_int_distribution<size_t> output_len_distribution(min_output_len, max_output_len);
+    std::uniform_int_distribution<size_t> prefix_id_distribution(0, std::max<size_t>(num_prefixes, 1) - 1);
+    std::exponential_distribution<double> interarrival_distribution(request_rate > 0 ? request_rate : 1.0);
+
+    std::vector<TraceRequest> trace(num_requests);
+    double arrival_time = 0.0;
+    for (auto& request : trace) {
+        if (request_rate > 0) {
+            arrival_time += interarrival_distribution(rng);
+        }
+        request.arrival_step = static_cast<size_t>(arrival_time);
+        request.prompt_len = prompt_len_distribution(rng);
+        request.output_len = output_len_distribution(rng);
+        request.prefix_id = prefix_id_distribution(rng);
+        request.prefix_len = num_prefixes > 0 ? std::min(prefix_len, request.prompt_len) : 0;
+    }
+    return trace;
+}
+
+// model with KV cache inputs only, which is enough for CacheManager to allocate and bind KV cache tensors
+std::shared_ptr<ov::Model> get_kv_cache_stub_model(ov::Core& core, size_t num_layers) {
+    ov::NodeVector keys, values;
+    ov::ParameterVector params;
+    ov::element::Type kv_cache_type = core.get_property("CPU", ov::hint::kv_cache_precision);
+
+    auto shape = ov::PartialShape::dynamic(4);
+    shape[1] = 1;
+    shape[2] = 1;
+    shape[3] = 1;
+
+    for (size_t i = 0; i < num_layers; i++) {
+        auto key = std::make_shared<ov::op::v0::Parameter>(kv_cache_type, shape);
+        auto value = std::make_shared<ov::op::v0::Parameter>(kv_cache_type, shape);
+        key->get_output_tensor(0).set_names({"key_cache." + std::to_string(i)});
+        value->get_output_tensor(0).set_names({"value_cache." + std::to_string(i)});
+        keys.push_back(key);
+        values.push_back(value);
+        params.push_back(key);
+        params.push_back(value);
+    }
+    const auto& concat1 = std::make_shared<ov::op::v0::Concat>(keys, 1);
+    const auto& concat2 = std::make_shared<ov::op::v0::Concat>(values, 1);
+    return std::make_shared<ov::Model>(ov::NodeVector{concat1, concat2}, params);
+}
+
+// peak resident set size of the process in bytes, 0 if it is not known
+size_t get_peak_memory_usage() {
+#ifdef __linux__
+    std::ifstream status_file("/proc/self/status");
+    std::string line;
+    while (std::getline(status_file, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+#endif
+    return 0;
+}
+
+struct DurationStatistics {
+    std::vector<double> m_durations_ns;
+
+    void add(Clock::duration duration) {
+        m_durations_ns.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+    double total_sec() const {
+        double total_ns = 0.0;
+        for (double duration_ns : m_durations_ns) {
+            total_ns += duration_ns;
+        }
+        return total_ns / 1e9;
+    }
+
+    void print(const std::string& name, const std::string& unit) {
+        if (m_durations_ns.empty()) {
+            return;
+        }
+        std::sort(m_durations_ns.begin(), m_durations_ns.end());
+        auto percentile = [this] (double p) {
+            return m_durations_ns[std::min(m_durations_ns.size() - 1, static_cast<size_t>(p * m_durations_ns.size()))];
+        };
+        std::cout << name << ": " << m_durations_ns.size() << " calls, mean " << total_sec() * 1e9 / m_durations_ns.size()
+                  << " ns / " << unit << ", p50 " << percentile(0.5) << " ns, p99 " << percentile(0.99) << " ns, max "
+                  << m_durations_ns.back() << " ns" << std::endl;
+    }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("continuous_batching_scheduler_benchmark", "Benchmark of continuous batching scheduling without a model");
+
+    options.add_options()
+    ("n,num_requests", "A number of requests in a synthetic trace", cxxopts::value<size_t>()->default_value("1000"))
+    ("trace", "Path to a recorded trace .json file: an array of {\"arrival_step\", \"prompt_len\", \"output_len\", \"prefix_id\", \"prefix_len\"} objects. A synthetic trace is used if it is not set", cxxopts::value<std::string>()->default_value(""))
+    ("dump_trace", "Path to a .json file to write the replayed trace to", cxxopts::value<std::string>()->default_value(""))
+    ("request_rate", "Mean number of requests arriving per step in a synthetic trace, Poisson process is used. If this is inf, then all the requests arrive at step 0", cxxopts::value<std::string>()->default_value("inf"))
+    ("min_prompt_len", "Min prompt length in a synthetic trace", cxxopts::value<size_t>()->default_value("128"))
+    ("max_prompt_len", "Max prompt length in a synthetic trace", cxxopts::value<size_t>()->default_value("1024"))
+    ("min_output_len", "Min output length in a synthetic trace", cxxopts::value<size_t>()->default_value("16"))
+    ("max_output_len", "Max output length in a synthetic trace", cxxopts::value<size_t>()->default_value("512"))
+    ("num_prefixes", "A number of distinct shared prompt prefixes in a synthetic trace, 0 means no shared prefixes", cxxopts::value<size_t>()->default_value("0"))
+    ("prefix_len", "Length of shared prompt prefixes in a synthetic trace", cxxopts::value<size_t>()->default_value("256"))
+    ("num_layers", "A number of decoder layers", cxxopts::value<size_t>()->default_value("32"))
+    ("num_kv_blocks", "A number of KV cache blocks", cxxopts::value<size_t>()->default_value("4096"))
+    ("b,max_batch_size", "A maximum number of batched tokens", cxxopts::value<size_t>()->default_value("256"))
+    ("max_num_seqs", "A maximum number of batched sequences", cxxopts::value<size_t>()->default_value("256"))
+    ("dynamic_split_fuse", "Whether to use dynamic split-fuse or vLLM scheduling", cxxopts::value<bool>()->default_value("true"))
+    ("enable_prefix_caching", "Whether to use prefix caching", cxxopts::value<bool>()->default_value("false"))
+    ("use_cache_eviction", "Whether to use cache eviction with random attention scores", cxxopts::value<bool>()->default_value("false"))
+    ("seed", "Seed of the synthetic trace, prompt tokens and attention scores", cxxopts::value<size_t>()->default_value("42"))
+    ("h,help", "Print usage");
+
+    cxxopts::ParseResult result;
+    try {
+        result = options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception& e) {
+        std::cout << e.what() << "\n\n";
+        std::cout << options.help() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string trace_path = result["trace"].as<std::string>();
+    const std::string dump_trace_path = result["dump_trace"].as<std::string>();
+    const std::string request_rate = result["request_rate"].as<std::string>();
+    const size_t num_layers = result["num_layers"].as<size_t>();
+    const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(result["seed"].as<size_t>()));
+
+    std::vector<TraceRequest> trace;
+    if (!trace_path.empty()) {
+        trace = read_trace(trace_path);
+    } else {
+        const double numeric_request_rate = request_rate == "inf" ? -1.0 : std::stod(request_rate);
+        trace = generate_trace(result["num_requests"].as<size_t>(), numeric_request_rate,
+                               result["min_prompt_len"].as<size_t>(), result["max_prompt_len"].as<size_t>(),
+                               result["min_output_len"].as<size_t>(), result["max_output_len"].as<size_t>(),
+                               result["num_prefixes"].as<size_t>(), result["prefix_len"].as<size_t>(), rng);
+    }
+    OPENVINO_ASSERT(!trace.empty(), "Trace has no requests to benchmark");
+    if (!dump_trace_path.empty()) {
+        write_trace(dump_trace_path, trace);
+    }
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = result["max_batch_size"].as<size_t>();
+    scheduler_config.num_kv_blocks = result["num_kv_blocks"].as<size_t>();
+    scheduler_config.dynamic_split_fuse = result["dynamic_split_fuse"].as<bool>();
+    scheduler_config.max_num_seqs = result["max_num_seqs"].as<size_t>();
+    scheduler_config.enable_prefix_caching = result["enable_prefix_caching"].as<bool>();
+    size_t snapkv_window_size = 1;
+    if (use_cache_eviction) {
+        scheduler_config.use_cache_eviction = true;
+        scheduler_config.cache_eviction_config = ov::genai::CacheEvictionConfig(32, 32, 128, ov::genai::AggregationMode::NORM_SUM, false, 8, ov::genai::KVCrushConfig(0, ov::genai::KVCrushAnchorPointMode::MEAN));
+        snapkv_window_size = scheduler_config.cache_eviction_config.snapkv_window_size;
+    }
+
+    std::cout << "Benchmarking parameters: " << std::endl;
+    std::cout << "\tNum requests: " << trace.size() << (trace_path.empty() ? " (synthetic trace)" : " (recorded trace)") << std::endl;
+    std::cout << "\tNum decoder layers: " << num_layers << std::endl;
+    std::cout << "\tNum KV blocks: " << scheduler_config.num_kv_blocks << std::endl;
+    std::cout << "\tMax number of batched tokens: " << scheduler_config.max_num_batched_tokens << std::endl;
+    std::cout << "\tScheduling type: " << (scheduler_config.dynamic_split_fuse ? "dynamic split-fuse" : "vLLM") << std::endl;
+    std::cout << "\tPrefix caching: " << (scheduler_config.enable_prefix_caching ? "on" : "off") << std::endl;
+    std::cout << "\tCache eviction: " << (use_cache_eviction ? "on" : "off") << std::endl;
+
+    ov::Core core;
+    ov::InferRequest request = core.compile_model(get_kv_cache_stub_model(core, num_layers), "CPU").create_infer_request();
+    auto cache_manager = std::make_shared<ov::genai::CacheManager>(request);
+    const size_t block_size = cache_manager->get_block_size();
+    ov::genai::Scheduler scheduler(block_size, cache_manager, scheduler_config, num_layers, true, snapkv_window_size);
+
+    constexpr int64_t VOCAB_SIZE = 32000;
+    std::uniform_int_distribution<int64_t> token_distribution(0, VOCAB_SIZE - 1);
+    std::uniform_real_distribution<float> score_distribution(0.0f, 1.0f);
+
+    DurationStatistics schedule_stats, restore_stats, free_stats, eviction_stats;
+    size_t num_steps = 0, num_scheduled_tokens = 0, num_allocated_blocks = 0, num_oom_requests = 0;
+    std::unordered_map<uint64_t, size_t> seq_id_to_num_blocks;
+    std::unordered_map<uint64_t, ov::genai::CacheEvictionAlgorithm> seq_id_to_cache_eviction_algo;
+    std::vector<ov::genai::SequenceGroup::Ptr> requests;
+
+    size_t next_request = 0;
+    for (size_t step = 0; next_request < trace.size() || !requests.empty(); ++step) {
+        if (requests.empty() && trace[next_request].arrival_step > step) {
+            // nothing to schedule until the next arrival
+            step = trace[next_request].arrival_step;
+        }
+        for (; next_request < trace.size() && trace[next_request].arrival_step <= step; ++next_request) {
+            const TraceRequest& trace_request = trace[next_request];
+            std::vector<int64_t> prompt(trace_request.prompt_len);
+            for (size_t i = 0; i < prompt.size(); ++i) {
+                prompt[i] = i < trace_request.prefix_len ? static_cast<int64_t>((trace_request.prefix_id * 7919 + i) % VOCAB_SIZE) : token_distribution(rng);
+            }
+            ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+            generation_config.max_new_tokens = trace_request.output_len;
+            generation_config.ignore_eos = true;
+            auto sequence_group = std::make_shared<ov::genai::SequenceGroup>(next_request, ov::Tensor(ov::element::i64, {prompt.size()}, prompt.data()),
+                                                                             generation_config, block_size);
+            if (scheduler_config.enable_prefix_caching) {
+                const auto restore_start = Clock::now();
+                scheduler.restore_cached_blocks(sequence_group);
+                restore_stats.add(Clock::now() - restore_start);
+            }
+            requests.push_back(sequence_group);
+        }
+
+        const auto schedule_start = Clock::now();
+        ov::genai::Scheduler::Output scheduler_output = scheduler.schedule(requests);
+        schedule_stats.add(Clock::now() - schedule_start);
+        ++num_steps;
+        num_scheduled_tokens += scheduler_output.m_total_num_scheduled_tokens;
+
+        for (const auto& seq_id_and_block_tables : scheduler_output.m_block_tables) {
+            size_t num_blocks = seq_id_and_block_tables.second[0].size();
+            size_t& prev_num_blocks = seq_id_to_num_blocks[seq_id_and_block_tables.first];
+            num_allocated_blocks += num_blocks > prev_num_blocks ? num_blocks - prev_num_blocks : 0;
+            prev_num_blocks = num_blocks;
+        }
+
+        if (scheduler_output.m_total_num_scheduled_tokens == 0) {
+            // out of memory, unlike the pipeline waiting requests are dropped as well, so the replay always progresses
+            for (const auto& sequence_group : requests) {
+                for (const auto& sequence : sequence_group->get_not_finished_sequences()) {
+                    sequence->set_status(ov::genai::SequenceStatus::OUT_OF_MEMORY);
+                }
+                ++num_oom_requests;
+            }
+        } else {
+            if (use_cache_eviction) {
+                // attention scores are generated before the measurement, as they would come from the model
+                std::vector<std::pair<ov::genai::SequenceGroup::Ptr, std::map<uint64_t, AttentionScoresForEachDecoderLayer>>> attention_scores;
+                for (const auto& sequence_group : requests) {
+                    if (!sequence_group->is_scheduled()) {
+                        continue;
+                    }
+                    attention_scores.push_back({sequence_group, {}});
+                    const size_t num_scores = sequence_group->get_context_len() - sequence_group->get_num_evicted_tokens();
+                    for (const auto& sequence : sequence_group->get_running_sequences()) {
+                        auto& scores = attention_scores.back().second[sequence->get_id()];
+                        for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
+                            ov::Tensor layer_scores(ov::element::f32, {num_scores});
+                            std::generate_n(layer_scores.data<float>(), num_scores, [&] { return score_distribution(rng); });
+                            scores.push_back(layer_scores);
+                        }
+                    }
+                }
+
+                const auto eviction_start = Clock::now();
+                for (const auto& group_and_scores : attention_scores) {
+                    const auto& sequence_group = group_and_scores.first;
+                    size_t num_blocks_evicted = 0;
+                    for (const auto& seq_id_and_scores : group_and_scores.second) {
+                        const uint64_t seq_id = seq_id_and_scores.first;
+                        auto algo_it = seq_id_to_cache_eviction_algo.find(seq_id);
+                        if (algo_it == seq_id_to_cache_eviction_algo.end()) {
+                            constexpr size_t MAX_POOL_WINDOW_SIZE = 7;
+                            algo_it = seq_id_to_cache_eviction_algo.emplace(seq_id, ov::genai::CacheEvictionAlgorithm(scheduler_config.cache_eviction_config, block_size, num_layers, MAX_POOL_WINDOW_SIZE)).first;
+                        }
+                        algo_it->second.register_new_token_scores(seq_id_and_scores.second, std::set<size_t>{}, scheduler_output.m_score_aggregation_windows.at(seq_id));
+                        if (!sequence_group->can_generate_tokens()) {
+                            continue;
+                        }
+                        auto logical_blocks_to_evict = algo_it->second.evict_logical_blocks();
+                        scheduler.free_blocks_from_sequence(seq_id, logical_blocks_to_evict);
+                        num_blocks_evicted = logical_blocks_to_evict[0].size();
+                    }
+                    sequence_group->register_token_eviction(num_blocks_evicted * block_size);
+                }
+                eviction_stats.add(Clock::now() - eviction_start);
+            }
+
+            // sampling stub: each scheduled sequence, which completed its prompt, gets a random token
+            for (const auto& sequence_group : requests) {
+                if (!sequence_group->is_scheduled()) {
+                    continue;
+                }
+                if (sequence_group->requires_sampling()) {
+                    for (const auto& sequence : sequence_group->get_running_sequences()) {
+                        sequence->append_token(token_distribution(rng), 0.0f);
+                        if (sequence->get_generated_len() >= sequence_group->get_max_new_tokens()) {
+                            sequence->set_status(ov::genai::SequenceStatus::FINISHED);
+                            sequence->set_finish_reason(ov::genai::GenerationFinishReason::LENGTH);
+                        }
+                    }
+                }
+                sequence_group->finish_iteration();
+            }
+        }
+
+        // free finished requests
+        auto requests_it = requests.begin();
+        while (requests_it != requests.end()) {
+            const auto& sequence_group = *requests_it;
+            if (!sequence_group->has_finished()) {
+                ++requests_it;
+                continue;
+            }
+            for (const auto& sequence : sequence_group->get_sequences()) {
+                const uint64_t seq_id = sequence->get_id();
+                if (scheduler.has_block_table(seq_id)) {
+                    const auto free_start = Clock::now();
+                    scheduler.free_sequence(seq_id);
+                    free_stats.add(Clock::now() - free_start);
+                }
+                seq_id_to_num_blocks.erase(seq_id);
+                seq_id_to_cache_eviction_algo.erase(seq_id);
+            }
+            requests_it = requests.erase(requests_it);
+        }
+    }
+
+    std::cout << "Benchmark results: " << std::endl;
+    std::cout << "Number of steps: " << num_steps << std::endl;
+    std::cout << "Number of scheduled tokens: " << num_scheduled_tokens << std::endl;
+    std::cout << "Number of requests dropped by out of memory: " << num_oom_requests << std::endl;
+    schedule_stats.print("Scheduler::schedule", "schedule call");
+    restore_stats.print("Scheduler::restore_cached_blocks", "request");
+    free_stats.print("Scheduler::free_sequence", "sequence");
+    eviction_stats.print("Cache eviction", "step");
+    if (schedule_stats.total_sec() > 0) {
+        std::cout << "Allocated KV blocks: " << num_allocated_blocks << ", " << num_allocated_blocks / schedule_stats.total_sec()
+                  << " blocks / s of scheduling time" << std::endl;
+        std::cout << "Scheduled tokens: " << num_scheduled_tokens / schedule_stats.total_sec() << " tokens / s of scheduling time" << std::endl;
+    }
+    const size_t peak_memory_usage = get_peak_memory_usage();
+    if (peak_memory_usage > 0) {
+        std::cout << "Peak memory usage: " << peak_memory_usage / (1024 * 1024) << " MiB" << std::endl;
+    }
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {}
+    return EXIT_FAILURE;
+}